@@ -0,0 +1,64 @@
+#!/bin/sh
+##
+## bench.sh - decode-throughput benchmark for cpuid.
+##
+## Replays the bundled corpus of raw dumps (bench/corpus/*.raw) through the
+## -f path in a loop and reports dumps/second and ns per leaf.  The corpus
+## covers the main decode chains: Intel, AMD, Hygon, and a hypervisor guest.
+##
+## Phases are attributed differentially: a -r replay exercises only the dump
+## parser and raw printing (the file-mode analogue of the gather phase),
+## while a full replay adds the decode_* machinery and formatted printing.
+## The difference between the two is reported as decode+print.
+##
+## Usage: bench.sh [cpuid-binary]
+## Environment: ITERATIONS  passes over the corpus (default 2000)
+##
+## Run via "make bench".
+
+CPUID=${1:-./cpuid}
+ITERATIONS=${ITERATIONS:-2000}
+
+dir=`dirname "$0"`/corpus
+files=`ls "$dir"/*.raw`
+if [ -z "$files" ]; then
+   echo "bench.sh: no corpus files in $dir" >&2
+   exit 1
+fi
+
+dump_count=`echo "$files" | wc -l`
+leaf_count=`cat $files | grep -c 'eax=0x'`
+
+list=`mktemp` || exit 1
+trap 'rm -f "$list"' 0
+i=0
+while [ $i -lt $ITERATIONS ]; do
+   echo "$files"
+   i=`expr $i + 1`
+done > "$list"
+
+# time_replay <extra cpuid args...>: seconds for one full pass over $list
+time_replay()
+{
+   start=`date +%s%N`
+   "$CPUID" "$@" --files-from="$list" > /dev/null
+   end=`date +%s%N`
+   echo `expr $end - $start`
+}
+
+echo "corpus: $dump_count dumps, $leaf_count leaves, $ITERATIONS iterations"
+
+raw_ns=`time_replay -r`
+full_ns=`time_replay`
+
+awk "BEGIN {
+   dumps  = $dump_count * $ITERATIONS;
+   leaves = $leaf_count * $ITERATIONS;
+   full   = $full_ns;
+   raw    = $raw_ns;
+   if (full < raw) raw = full;
+   printf(\"full replay:    %10.0f dumps/sec, %8.1f ns/leaf\n\",
+          dumps * 1e9 / full, full / leaves);
+   printf(\"parse (gather): %35.1f ns/leaf\n\", raw / leaves);
+   printf(\"decode+print:   %35.1f ns/leaf\n\", (full - raw) / leaves);
+}"
@@ -0,0 +1,86 @@
+/*
+** cpuid-dump.h - on-disk dump formats shared by cpuid and cpuid-merge.
+**
+** The binary raw dump format (cpuid --raw-binary) is a compact, versioned
+** alternative to the -r text format: a fixed-size header followed by
+** fixed-size (cpu, leaf, subleaf, 4 words) records.  All fields are
+** little-endian; since these tools run only on x86, which is little-endian,
+** they are simply written natively.
+**
+** The columnar index format (built by cpuid-merge) merges many per-host
+** binary dumps into one file keyed by (leaf, subleaf, register), so a
+** fleet-wide predicate over a single register is answered by one
+** sequential scan of one column.  Layout:
+**
+**    columnar_header_t
+**    host names            name_bytes of NUL-terminated names, host order
+**    tuple directory       tuple_count columnar_tuple_t, sorted by
+**                          (leaf, subleaf)
+**    per-tuple blocks      in directory order, each:
+**                             presence bitmap   (host_count+31)/32 words
+**                             eax column        host_count words
+**                             ebx column        host_count words
+**                             ecx column        host_count words
+**                             edx column        host_count words
+**
+** All blocks are the same size, so the block for directory entry i is at a
+** computable offset; a column is host_count consecutive words.
+*/
+
+/*
+** Copyright 2020 by Todd Allen.
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307,
+** USA.
+*/
+
+#ifndef CPUID_DUMP_H
+#define CPUID_DUMP_H
+
+#define BINARY_DUMP_MAGIC    "cpuidbin"
+#define BINARY_DUMP_VERSION  1
+
+typedef struct {
+   char          magic[8];
+   unsigned int  version;
+   unsigned int  cpu_count;
+   unsigned int  record_count;
+   unsigned int  reserved;
+} binary_dump_header_t;
+
+typedef struct {
+   unsigned int  cpu;
+   unsigned int  reg;        /* leaf */
+   unsigned int  try;        /* subleaf */
+   unsigned int  words[4];   /* eax, ebx, ecx, edx */
+} binary_dump_record_t;
+
+#define COLUMNAR_MAGIC    "cpuidcol"
+#define COLUMNAR_VERSION  1
+
+typedef struct {
+   char          magic[8];
+   unsigned int  version;
+   unsigned int  host_count;
+   unsigned int  tuple_count;
+   unsigned int  name_bytes;
+} columnar_header_t;
+
+typedef struct {
+   unsigned int  reg;        /* leaf */
+   unsigned int  try;        /* subleaf */
+} columnar_tuple_t;
+
+#endif
@@ -0,0 +1,432 @@
+/*
+** cpuid-merge - merge per-host cpuid binary dumps into a columnar index.
+**
+** Fleet capability questions ("which hosts lack AVX-512?") are usually
+** answered by re-decoding every host's dump, which costs minutes at fleet
+** scale.  cpuid-merge reads many --raw-binary dumps (one per host) and
+** writes a single columnar file, keyed by (leaf, subleaf, register), in
+** which all hosts' values for one register are contiguous; a fleet-wide
+** predicate over e.g. leaf 7 EBX then becomes one sequential scan of one
+** column.  The formats are defined in cpuid-dump.h, shared with cpuid
+** itself.
+**
+** Only the first CPU of each dump is indexed: capability queries are
+** per-host, and a host's CPUs answer the capability leaves identically.
+*/
+
+/*
+** Copyright 2020 by Todd Allen.
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307,
+** USA.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "cpuid-dump.h"
+
+typedef int   boolean;
+#define TRUE  1
+#define FALSE 0
+
+typedef const char*  cstring;
+typedef const char* const  ccstring;
+
+static cstring  program = NULL;
+
+typedef struct {
+   cstring                      name;
+   const binary_dump_record_t*  records;   /* first CPU's records only */
+   unsigned int                 count;
+} host_t;
+
+static const void*
+map_file(ccstring  filename,
+         size_t*   size)
+{
+   int  fd = open(filename, O_RDONLY);
+   if (fd == -1) {
+      fprintf(stderr,
+              "%s: unable to open %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+
+   struct stat  st;
+   if (fstat(fd, &st) == -1) {
+      fprintf(stderr,
+              "%s: unable to stat %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+   *size = st.st_size;
+
+   void*  base = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (base == MAP_FAILED) {
+      fprintf(stderr,
+              "%s: unable to mmap %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+   close(fd);
+   return base;
+}
+
+/*
+** Validate a binary dump and return the records belonging to its first
+** CPU; the same checks do_file() applies before replaying such a dump.
+*/
+static void
+load_dump(ccstring  filename,
+          host_t*   host)
+{
+   size_t       size;
+   const void*  base = map_file(filename, &size);
+
+   if (size < sizeof(binary_dump_header_t)
+       || memcmp(base, BINARY_DUMP_MAGIC, 8) != 0) {
+      fprintf(stderr,
+              "%s: %s is not a cpuid binary dump\n", program, filename);
+      exit(1);
+   }
+   const binary_dump_header_t*  header = (const binary_dump_header_t*)base;
+   if (header->version != BINARY_DUMP_VERSION) {
+      fprintf(stderr,
+              "%s: binary dump %s has unsupported version %u\n",
+              program, filename, header->version);
+      exit(1);
+   }
+   if (sizeof(binary_dump_header_t)
+       + (size_t)header->record_count * sizeof(binary_dump_record_t) > size) {
+      fprintf(stderr, "%s: binary dump %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   const binary_dump_record_t*  records
+      = (const binary_dump_record_t*)((const char*)base
+                                      + sizeof(binary_dump_header_t));
+
+   unsigned int  count = 0;
+   while (count < header->record_count
+          && records[count].cpu == records[0].cpu) {
+      count++;
+   }
+
+   if (count == 0) {
+      fprintf(stderr, "%s: binary dump %s is empty\n", program, filename);
+      exit(1);
+   }
+
+   host->name    = filename;
+   host->records = records;
+   host->count   = count;
+}
+
+static int
+compare_tuples(const void*  left,
+               const void*  right)
+{
+   const columnar_tuple_t*  l = (const columnar_tuple_t*)left;
+   const columnar_tuple_t*  r = (const columnar_tuple_t*)right;
+   if (l->reg != r->reg) return (l->reg < r->reg ? -1 : 1);
+   if (l->try != r->try) return (l->try < r->try ? -1 : 1);
+   return 0;
+}
+
+static const binary_dump_record_t*
+find_record(const host_t*  host,
+            unsigned int   reg,
+            unsigned int   try)
+{
+   unsigned int  i;
+   for (i = 0; i < host->count; i++) {
+      if (host->records[i].reg == reg && host->records[i].try == try) {
+         return &host->records[i];
+      }
+   }
+   return NULL;
+}
+
+static void
+write_block(FILE*        file,
+            const void*  data,
+            size_t       size,
+            ccstring     filename)
+{
+   if (size > 0 && fwrite(data, size, 1, file) != 1) {
+      fprintf(stderr,
+              "%s: unable to write %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+}
+
+static void
+do_build(ccstring      output,
+         char* const*  inputs,
+         unsigned int  input_count)
+{
+   host_t*  hosts = calloc(input_count, sizeof(host_t));
+   if (hosts == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+
+   unsigned int  host;
+   for (host = 0; host < input_count; host++) {
+      load_dump(inputs[host], &hosts[host]);
+   }
+
+   /* The directory is the sorted union of every host's (leaf, subleaf)s. */
+   unsigned int       tuple_allocated = 256;
+   unsigned int       tuple_count     = 0;
+   columnar_tuple_t*  tuples = malloc(tuple_allocated * sizeof(*tuples));
+   if (tuples == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+   for (host = 0; host < input_count; host++) {
+      unsigned int  r;
+      for (r = 0; r < hosts[host].count; r++) {
+         unsigned int  t;
+         for (t = 0; t < tuple_count; t++) {
+            if (tuples[t].reg == hosts[host].records[r].reg
+                && tuples[t].try == hosts[host].records[r].try) {
+               break;
+            }
+         }
+         if (t < tuple_count) continue;
+         if (tuple_count == tuple_allocated) {
+            tuple_allocated *= 2;
+            columnar_tuple_t*  grown
+               = realloc(tuples, tuple_allocated * sizeof(*tuples));
+            if (grown == NULL) {
+               fprintf(stderr, "%s: out of memory\n", program);
+               exit(1);
+            }
+            tuples = grown;
+         }
+         tuples[tuple_count].reg = hosts[host].records[r].reg;
+         tuples[tuple_count].try = hosts[host].records[r].try;
+         tuple_count++;
+      }
+   }
+   qsort(tuples, tuple_count, sizeof(*tuples), compare_tuples);
+
+   unsigned int  name_bytes = 0;
+   for (host = 0; host < input_count; host++) {
+      name_bytes += strlen(hosts[host].name) + 1;
+   }
+
+   FILE*  file = fopen(output, "w");
+   if (file == NULL) {
+      fprintf(stderr,
+              "%s: unable to open %s; errno = %d (%s)\n",
+              program, output, errno, strerror(errno));
+      exit(1);
+   }
+
+   columnar_header_t  header;
+   memcpy(header.magic, COLUMNAR_MAGIC, sizeof(header.magic));
+   header.version     = COLUMNAR_VERSION;
+   header.host_count  = input_count;
+   header.tuple_count = tuple_count;
+   header.name_bytes  = name_bytes;
+   write_block(file, &header, sizeof(header), output);
+
+   for (host = 0; host < input_count; host++) {
+      write_block(file, hosts[host].name,
+                  strlen(hosts[host].name) + 1, output);
+   }
+
+   write_block(file, tuples, tuple_count * sizeof(*tuples), output);
+
+   unsigned int   bitmap_words = (input_count + 31) / 32;
+   unsigned int*  bitmap = calloc(bitmap_words, sizeof(unsigned int));
+   unsigned int*  column = calloc(input_count,  sizeof(unsigned int));
+   if (bitmap == NULL || column == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+
+   unsigned int  t;
+   for (t = 0; t < tuple_count; t++) {
+      memset(bitmap, 0, bitmap_words * sizeof(unsigned int));
+      for (host = 0; host < input_count; host++) {
+         if (find_record(&hosts[host], tuples[t].reg, tuples[t].try)) {
+            bitmap[host / 32] |= 1U << (host % 32);
+         }
+      }
+      write_block(file, bitmap, bitmap_words * sizeof(unsigned int), output);
+
+      unsigned int  word;
+      for (word = 0; word < 4; word++) {
+         for (host = 0; host < input_count; host++) {
+            const binary_dump_record_t*  record
+               = find_record(&hosts[host], tuples[t].reg, tuples[t].try);
+            column[host] = (record != NULL ? record->words[word] : 0);
+         }
+         write_block(file, column, input_count * sizeof(unsigned int),
+                     output);
+      }
+   }
+
+   if (fclose(file) == EOF) {
+      fprintf(stderr,
+              "%s: unable to write %s; errno = %d (%s)\n",
+              program, output, errno, strerror(errno));
+      exit(1);
+   }
+
+   free(bitmap);
+   free(column);
+   free(tuples);
+   free(hosts);
+}
+
+/*
+** -q LEAF[:SUBLEAF]:REG dumps one column as "host value" lines, "absent"
+** for hosts whose dumps lack the tuple; predicates are then one grep or
+** awk away.
+*/
+static void
+do_query(ccstring  spec,
+         ccstring  filename)
+{
+   static ccstring  reg_names[4] = { "eax", "ebx", "ecx", "edx" };
+
+   unsigned int  reg     = 0;
+   unsigned int  try     = 0;
+   unsigned int  word    = 0;
+   char          name[3+1];
+
+   if (sscanf(spec, "%i:%i:%3s", &reg, &try, name) != 3
+       && (try = 0, sscanf(spec, "%i:%3s", &reg, name)) != 2) {
+      fprintf(stderr,
+              "%s: query not understood: %s\n", program, spec);
+      exit(1);
+   }
+   for (word = 0; word < 4; word++) {
+      if (strcmp(name, reg_names[word]) == 0) break;
+   }
+   if (word == 4) {
+      fprintf(stderr,
+              "%s: register not understood: %s\n", program, name);
+      exit(1);
+   }
+
+   size_t       size;
+   const char*  base = (const char*)map_file(filename, &size);
+
+   if (size < sizeof(columnar_header_t)
+       || memcmp(base, COLUMNAR_MAGIC, 8) != 0) {
+      fprintf(stderr,
+              "%s: %s is not a cpuid columnar index\n", program, filename);
+      exit(1);
+   }
+   const columnar_header_t*  header = (const columnar_header_t*)base;
+   if (header->version != COLUMNAR_VERSION) {
+      fprintf(stderr,
+              "%s: columnar index %s has unsupported version %u\n",
+              program, filename, header->version);
+      exit(1);
+   }
+
+   unsigned int  bitmap_words = (header->host_count + 31) / 32;
+   size_t        block_size   = (bitmap_words + 4ULL * header->host_count)
+                                * sizeof(unsigned int);
+   size_t        names_at     = sizeof(columnar_header_t);
+   size_t        tuples_at    = names_at + header->name_bytes;
+   size_t        blocks_at    = tuples_at
+                                + header->tuple_count * sizeof(columnar_tuple_t);
+   if (blocks_at + header->tuple_count * block_size > size) {
+      fprintf(stderr,
+              "%s: columnar index %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   const columnar_tuple_t*  tuples
+      = (const columnar_tuple_t*)(base + tuples_at);
+   unsigned int  t;
+   for (t = 0; t < header->tuple_count; t++) {
+      if (tuples[t].reg == reg && tuples[t].try == try) break;
+   }
+   if (t == header->tuple_count) {
+      fprintf(stderr,
+              "%s: no such (leaf, subleaf) in %s: 0x%x:0x%x\n",
+              program, filename, reg, try);
+      exit(1);
+   }
+
+   const unsigned int*  bitmap
+      = (const unsigned int*)(base + blocks_at + t * block_size);
+   const unsigned int*  column
+      = bitmap + bitmap_words + word * header->host_count;
+
+   cstring       name_ptr = base + names_at;
+   unsigned int  host;
+   for (host = 0; host < header->host_count; host++) {
+      if (bitmap[host / 32] & (1U << (host % 32))) {
+         printf("%s 0x%08x\n", name_ptr, column[host]);
+      } else {
+         printf("%s absent\n", name_ptr);
+      }
+      name_ptr += strlen(name_ptr) + 1;
+   }
+}
+
+static void
+usage(void)
+{
+   printf("usage: %s -o INDEX DUMP...\n", program);
+   printf("       %s -q LEAF[:SUBLEAF]:REG INDEX\n", program);
+   printf("\n");
+   printf("Merges cpuid --raw-binary dumps (one per host) into a columnar"
+          " index keyed\n");
+   printf("by (leaf, subleaf, register), or dumps one column of such an"
+          " index as\n");
+   printf("\"host value\" lines.  REG is one of eax, ebx, ecx, edx;"
+          " LEAF and SUBLEAF\n");
+   printf("accept 0x prefixes.\n");
+   exit(0);
+}
+
+int
+main(int     argc,
+     char**  argv)
+{
+   program = argv[0];
+
+   if (argc >= 4 && strcmp(argv[1], "-o") == 0) {
+      do_build(argv[2], &argv[3], argc - 3);
+   } else if (argc == 4 && strcmp(argv[1], "-q") == 0) {
+      do_query(argv[2], argv[3]);
+   } else if (argc == 2 && (strcmp(argv[1], "-h") == 0
+                            || strcmp(argv[1], "--help") == 0)) {
+      usage();
+   } else {
+      fprintf(stderr, "%s: try -h for usage\n", program);
+      exit(1);
+   }
+
+   return 0;
+}
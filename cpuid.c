@@ -67,10 +67,19 @@
 #define USE_CPUID_COUNT
 #endif
 
+/*
+** COLD marks the per-vendor uarch & synth decode chains, which are the
+** bulk of the binary but are reached only when a full decode is printed.
+** GCC groups such functions contiguously in .text.unlikely, away from the
+** gather & raw-output path, so invocations that never decode (cpuid -r on
+** a cold, demand-paged binary, most notably) fault in almost none of them.
+*/
 #if defined(__GNUC__)
 #define UNUSED __attribute((unused))
+#define COLD   __attribute((cold))
 #else
 #define UNUSED
+#define COLD
 #endif
 
 #define _GNU_SOURCE
@@ -85,6 +94,18 @@
 #include <string.h>
 #include <regex.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <time.h>
+#include <signal.h>
+
+#include "libcpuid.h"
+#include "cpuid-dump.h"
 
 #if defined(__sun)
 #include <sys/processor.h>
@@ -142,39 +163,336 @@ typedef const char* const  ccstring;
 
 const char*  program = NULL;
 
+/*
+** Buffered output engine.
+**
+** A full decode emits thousands of short lines per CPU, and issuing a stdio
+** call for each decoded bitfield is measurably slow when the output is piped
+** (e.g. to ssh or a collector).  Instead, everything destined for stdout is
+** formatted into one large append buffer, which grows geometrically and is
+** flushed with a single write per CPU (and once at exit, via atexit).
+**
+** Every print routine in this file writes through printf, so rather than
+** touch thousands of call sites, printf itself is redirected here.  Output
+** to stderr is unaffected.
+*/
+static char*    out_buffer    = NULL;
+static size_t   out_allocated = 0;
+static size_t   out_length    = 0;
+static boolean  out_muted     = FALSE;  /* library decode: discard output */
+
+static void
+out_flush(void)
+{
+   size_t  offset = 0;
+   while (offset < out_length) {
+      ssize_t  written = write(STDOUT_FILENO,
+                               out_buffer + offset, out_length - offset);
+      if (written == -1) {
+         if (errno == EINTR) continue;
+         fprintf(stderr,
+                 "%s: unable to write to stdout; errno = %d (%s)\n",
+                 program, errno, strerror(errno));
+         exit(1);
+      }
+      offset += written;
+   }
+   out_length = 0;
+}
+
+static void
+buf_vprintf(char**       buffer_p,
+            size_t*      allocated_p,
+            size_t*      length_p,
+            const char*  format,
+            va_list      ap)
+{
+   for (;;) {
+      size_t   space = *allocated_p - *length_p;
+      va_list  aq;
+      va_copy(aq, ap);
+      int  needed = vsnprintf(*buffer_p + *length_p, space, format, aq);
+      va_end(aq);
+      if (needed < 0) {
+         fprintf(stderr, "%s: cannot format \"%s\"\n", program, format);
+         exit(1);
+      }
+      if ((size_t)needed < space) {
+         *length_p += needed;
+         return;
+      }
+
+      size_t  allocated = (*allocated_p == 0 ? 64 * 1024 : *allocated_p * 2);
+      while (allocated - *length_p <= (size_t)needed) {
+         allocated *= 2;
+      }
+      char*  buffer = realloc(*buffer_p, allocated);
+      if (buffer == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      *buffer_p    = buffer;
+      *allocated_p = allocated;
+   }
+}
+
+static void
+out_append(const char*  data,
+           size_t       length)
+{
+   if (out_allocated - out_length <= length) {
+      size_t  allocated = (out_allocated == 0 ? 64 * 1024 : out_allocated * 2);
+      while (allocated - out_length <= length) {
+         allocated *= 2;
+      }
+      char*  buffer = realloc(out_buffer, allocated);
+      if (buffer == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      out_buffer    = buffer;
+      out_allocated = allocated;
+   }
+   memcpy(out_buffer + out_length, data, length);
+   out_length += length;
+}
+
+/*
+** Machine-readable output (--format=json).
+**
+** Every decoded field already flows through the output engine as a
+** "   name = value" line (print_names() generates almost all of them from
+** the named_item tables), and raw leaves flow through as print_reg_raw()
+** lines.  So rather than teach hundreds of print routines about a second
+** format, the engine classifies each completed line and emits it as one
+** NDJSON record: leaf records carry leaf/subleaf and the four registers,
+** field records carry the field name and value, and anything else is
+** preserved as descriptive text.  Every record carries the CPU number.
+*/
+typedef enum {
+   FORMAT_TEXT,
+   FORMAT_JSON
+} out_format_t;
+
+static out_format_t  out_format     = FORMAT_TEXT;
+static char*         json_pending   = NULL;
+static size_t        json_allocated = 0;
+static size_t        json_length    = 0;
+static unsigned int  json_cpu       = 0;
+
+static void
+out_append_json_string(const char*  data,
+                       size_t       length)
+{
+   out_append("\"", 1);
+   size_t  i;
+   for (i = 0; i < length; i++) {
+      unsigned char  c = data[i];
+      if (c == '"' || c == '\\') {
+         char  escaped[2] = { '\\', (char)c };
+         out_append(escaped, 2);
+      } else if (c < 0x20) {
+         char  escaped[8];
+         int   n = snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+         out_append(escaped, n);
+      } else {
+         out_append((const char*)&data[i], 1);
+      }
+   }
+   out_append("\"", 1);
+}
+
+static void
+out_emit_json_line(const char*  line,
+                   size_t       length)
+{
+   /*
+   ** Sized for the worst-case leaf record: 56 bytes of fixed text plus
+   ** seven %u fields of up to 10 digits each, and the NUL.
+   */
+   char          scratch[160];
+   unsigned int  cpu;
+   unsigned int  reg;
+   unsigned int  try;
+   unsigned int  words[WORD_NUM];
+
+   while (length > 0 && (line[length-1] == '\r' || line[length-1] == ' ')) {
+      length--;
+   }
+   if (length == 0) return;
+
+   if (sscanf(line, "CPU %u:", &cpu) == 1) {
+      json_cpu = cpu;
+      return;
+   }
+   if (length == 4 && memcmp(line, "CPU:", 4) == 0) {
+      json_cpu = 0;
+      return;
+   }
+
+   if (sscanf(line,
+              "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x",
+              &reg, &try,
+              &words[WORD_EAX], &words[WORD_EBX],
+              &words[WORD_ECX], &words[WORD_EDX]) == 6) {
+      int  n = snprintf(scratch, sizeof(scratch),
+                        "{\"cpu\":%u,\"leaf\":%u,\"subleaf\":%u,"
+                        "\"eax\":%u,\"ebx\":%u,\"ecx\":%u,\"edx\":%u}\n",
+                        json_cpu, reg, try,
+                        words[WORD_EAX], words[WORD_EBX],
+                        words[WORD_ECX], words[WORD_EDX]);
+      if (n < 0) return;
+      /* snprintf reports the would-be length; never append past scratch. */
+      if ((size_t)n >= sizeof(scratch)) n = sizeof(scratch) - 1;
+      out_append(scratch, n);
+      return;
+   }
+
+   const char*  start = line;
+   while (*start == ' ') start++;
+
+   const char*  eq = strstr(start, " = ");
+   if (eq != NULL && eq < line + length) {
+      const char*  name_end = eq;
+      while (name_end > start && name_end[-1] == ' ') name_end--;
+      const char*  value = eq + 3;
+      size_t       value_length = line + length - value;
+
+      int  n = snprintf(scratch, sizeof(scratch), "{\"cpu\":%u,\"field\":",
+                        json_cpu);
+      out_append(scratch, n);
+      out_append_json_string(start, name_end - start);
+      out_append(",\"value\":", 9);
+      if ((value_length == 4 && memcmp(value, "true", 4) == 0)
+          || (value_length == 5 && memcmp(value, "false", 5) == 0)) {
+         out_append(value, value_length);
+      } else {
+         out_append_json_string(value, value_length);
+      }
+      out_append("}\n", 2);
+      return;
+   }
+
+   int  n = snprintf(scratch, sizeof(scratch), "{\"cpu\":%u,\"text\":",
+                     json_cpu);
+   out_append(scratch, n);
+   out_append_json_string(start, line + length - start);
+   out_append("}\n", 2);
+}
+
+static void
+json_process_lines(void)
+{
+   size_t  start = 0;
+   size_t  i;
+   for (i = 0; i < json_length; i++) {
+      if (json_pending[i] == '\n') {
+         out_emit_json_line(&json_pending[start], i - start);
+         start = i + 1;
+      }
+   }
+   if (start > 0) {
+      memmove(json_pending, json_pending + start, json_length - start);
+      json_length -= start;
+   }
+}
+
+#if defined(__GNUC__)
+__attribute__((format(printf, 1, 2)))
+#endif
+static void
+out_printf(const char*  format, ...)
+{
+   if (out_muted) return;
+
+   va_list  ap;
+   va_start(ap, format);
+   if (out_format == FORMAT_TEXT) {
+      buf_vprintf(&out_buffer, &out_allocated, &out_length, format, ap);
+   } else {
+      buf_vprintf(&json_pending, &json_allocated, &json_length, format, ap);
+   }
+   va_end(ap);
+   if (out_format != FORMAT_TEXT) {
+      json_process_lines();
+   }
+}
+
+#define printf(...)  out_printf(__VA_ARGS__)
+
 static boolean  strregexp(const char*  haystack,
                           const char*  needle)
 {
-   regex_t  re;
-   int      status;
-   status = regcomp(&re, needle, REG_NOSUB);
-   if (status != 0) {
-      size_t  size = regerror(status, &re, NULL, 0);
-      char*   buffer = malloc(size + 1);
-      if (buffer == NULL || size + 1 == 0) {
-         fprintf(stderr, "%s: out of memory\n", program);
+   /*
+   ** The needles are a small fixed set of literal patterns, and the brand
+   ** classification paths ask about all of them for every CPU decoded.
+   ** Compile each distinct pattern once, on first use, and keep it; the
+   ** per-call regcomp/regfree it replaces was a visible fraction of batch
+   ** replay time.
+   */
+   typedef struct {
+      const char*  needle;
+      regex_t      re;
+   } compiled_t;
+
+   static compiled_t*   compiled  = NULL;
+   static unsigned int  count     = 0;
+   static unsigned int  allocated = 0;
+
+   regex_t*      re = NULL;
+   unsigned int  i;
+   int           status;
+
+   for (i = 0; i < count; i++) {
+      if (strcmp(compiled[i].needle, needle) == 0) {
+         re = &compiled[i].re;
+         break;
+      }
+   }
+
+   if (re == NULL) {
+      if (count == allocated) {
+         allocated = (allocated == 0 ? 16 : allocated * 2);
+         compiled_t*  grown = realloc(compiled,
+                                      allocated * sizeof(compiled_t));
+         if (grown == NULL) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
+         }
+         compiled = grown;
+      }
+      compiled[count].needle = needle;
+      re = &compiled[count].re;
+      status = regcomp(re, needle, REG_NOSUB);
+      if (status != 0) {
+         size_t  size = regerror(status, re, NULL, 0);
+         char*   buffer = malloc(size + 1);
+         if (buffer == NULL || size + 1 == 0) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
+         }
+         regerror(status, re, buffer, size);
+         fprintf(stderr, "%s: cannot regcomp \"%s\"; error = %s\n",
+                 program, needle, buffer);
          exit(1);
       }
-      regerror(status, &re, buffer, size);
-      fprintf(stderr, "%s: cannot regcomp \"%s\"; error = %s\n",
-              program, needle, buffer);
-      exit(1);
+      count++;
    }
-   status = regexec(&re, haystack, 0, NULL, 0);
+
+   status = regexec(re, haystack, 0, NULL, 0);
    if (status != 0 && status != REG_NOMATCH) {
-      size_t  size = regerror(status, &re, NULL, 0);
+      size_t  size = regerror(status, re, NULL, 0);
       char*   buffer = malloc(size + 1);
       if (buffer == NULL || size + 1 == 0) {
          fprintf(stderr, "%s: out of memory\n", program);
          exit(1);
       }
-      regerror(status, &re, buffer, size);
+      regerror(status, re, buffer, size);
       fprintf(stderr, "%s: cannot regexec string \"%s\" with regexp \"%s\";"
               " error = %s\n",
               program, haystack, needle, buffer);
       exit(1);
    }
-   regfree(&re);
 
    return (status == 0);
 }
@@ -191,8 +509,8 @@ typedef struct {
 #define X2_IMAGES      (ccstring*)2
 
 static unsigned int
-get_max_len (named_item    names[],
-             unsigned int  length)
+get_max_len (const named_item  names[],
+             unsigned int      length)
 {
    unsigned int  result = 0;
    unsigned int  i;
@@ -205,15 +523,49 @@ get_max_len (named_item    names[],
 }
 
 static void
-print_names(unsigned int  value,
-            named_item    names[],
-            unsigned int  length,
-            unsigned int  max_len)
+print_names(unsigned int      value,
+            const named_item  names[],
+            unsigned int      length,
+            unsigned int      max_len)
 {
    unsigned int  i;
 
    if (max_len == 0) {
-      max_len = get_max_len(names, length);
+      /*
+      ** The name tables are fixed, so compute each one's column width only
+      ** once, on first use, rather than rescanning the table with strlen
+      ** on every call.
+      */
+      typedef struct {
+         const named_item*  names;
+         unsigned int       max_len;
+      } width_t;
+
+      static width_t*      widths    = NULL;
+      static unsigned int  count     = 0;
+      static unsigned int  allocated = 0;
+
+      for (i = 0; i < count; i++) {
+         if (widths[i].names == names) {
+            max_len = widths[i].max_len;
+            break;
+         }
+      }
+      if (max_len == 0) {
+         max_len = get_max_len(names, length);
+         if (count == allocated) {
+            allocated = (allocated == 0 ? 256 : allocated * 2);
+            width_t*  grown = realloc(widths, allocated * sizeof(width_t));
+            if (grown == NULL) {
+               fprintf(stderr, "%s: out of memory\n", program);
+               exit(1);
+            }
+            widths = grown;
+         }
+         widths[count].names   = names;
+         widths[count].max_len = max_len;
+         count++;
+      }
    }
 
    for (i = 0; i < length; i++) {
@@ -481,7 +833,7 @@ typedef struct {
                     FALSE, FALSE, FALSE, \
                     FALSE, FALSE }
 
-static void
+static void COLD
 decode_amd_model(const code_stash_t*  stash,
                  const char**         brand_pre,
                  const char**         brand_post,
@@ -1973,7 +2325,7 @@ init_arch(arch_t*  arch)
    arch->core_is_uarch = FALSE;
 }
 
-static void
+static void COLD
 decode_uarch_intel(unsigned int  val,
                    arch_t*       arch)
 {
@@ -2124,7 +2476,7 @@ decode_uarch_intel(unsigned int  val,
    DEFAULT                      ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_amd(unsigned int  val,
                  arch_t*       arch)
 {
@@ -2223,7 +2575,7 @@ decode_uarch_amd(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_cyrix(unsigned int  val,
                    arch_t*       arch)
 {
@@ -2238,7 +2590,7 @@ decode_uarch_cyrix(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_via(unsigned int         val,
                  arch_t*              arch,
                  const code_stash_t*  stash)
@@ -2263,7 +2615,7 @@ decode_uarch_via(unsigned int         val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_umc(unsigned int  val,
                  arch_t*       arch)
 {
@@ -2277,7 +2629,7 @@ decode_uarch_umc(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_nexgen(unsigned int  val,
                     arch_t*       arch)
 {
@@ -2290,7 +2642,7 @@ decode_uarch_nexgen(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_rise(unsigned int  val,
                   arch_t*       arch)
 {
@@ -2304,7 +2656,7 @@ decode_uarch_rise(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_transmeta(unsigned int  val,
                        arch_t*       arch)
 {
@@ -2319,7 +2671,7 @@ decode_uarch_transmeta(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_sis(unsigned int  val,
                  arch_t*       arch)
 {
@@ -2333,7 +2685,7 @@ decode_uarch_sis(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_hygon(unsigned int  val,
                    arch_t*       arch)
 {
@@ -2347,7 +2699,7 @@ decode_uarch_hygon(unsigned int  val,
    DEFAULT                  ((void)NULL);
 }
 
-static void
+static void COLD
 decode_uarch_zhaoxin(unsigned int  val,
                      arch_t*       arch)
 {
@@ -2571,574 +2923,806 @@ debug_queries(const code_stash_t*  stash)
 
 #define ACT(str)  (result = (str))
 
+/*
+** The Intel & AMD synth chains are large enough that walking them as
+** if-chains is the hot spot when replaying many dumps.  They are kept in
+** source form as tables of (mask, value, predicate, result) entries in
+** the original priority order, plus a lazily built index of where each
+** (extended) family's entries begin, sorted by family.  A lookup binary
+** searches that index, then scans entries linearly from there.  Because
+** every entry's mask includes the family bits, entries for other
+** families can never match, so first-match-wins order is preserved
+** exactly.
+*/
+typedef boolean (*synth_pred_t)(const code_stash_t*  stash);
+
+typedef struct {
+   unsigned int  mask;
+   unsigned int  value;
+   synth_pred_t  pred;
+   cstring       result;
+} synth_entry_t;
+
+typedef struct {
+   unsigned int  family;  /* __F() bits of the entries' values */
+   unsigned int  first;   /* index of first table entry with this family */
+} synth_family_t;
+
+#define SYNTH_MAX_FAMILIES  32
+
+static int
+synth_family_compare(const void*  left,
+                     const void*  right)
+{
+   unsigned int  left_family  = ((const synth_family_t*)left)->family;
+   unsigned int  right_family = ((const synth_family_t*)right)->family;
+   if (left_family < right_family) return -1;
+   if (left_family > right_family) return 1;
+   return 0;
+}
+
 static cstring
+synth_table_lookup(const synth_entry_t*  table,
+                   unsigned int          count,
+                   synth_family_t*       families,
+                   unsigned int*         family_count,
+                   unsigned int          val,
+                   const code_stash_t*   stash)
+{
+   unsigned int  i;
+
+   if (*family_count == 0) {
+      for (i = 0; i < count; i++) {
+         unsigned int  family = __F(table[i].value);
+         unsigned int  f;
+         for (f = 0; f < *family_count; f++) {
+            if (families[f].family == family) break;
+         }
+         if (f == *family_count) {
+            if (f == SYNTH_MAX_FAMILIES) {
+               fprintf(stderr, "%s: SYNTH_MAX_FAMILIES is too small\n",
+                       program);
+               exit(1);
+            }
+            families[f].family = family;
+            families[f].first  = i;
+            (*family_count)++;
+         }
+      }
+      qsort(families, *family_count, sizeof(synth_family_t),
+            synth_family_compare);
+   }
+
+   synth_family_t  key;
+   key.family = __F(val);
+   const synth_family_t*  found
+      = (const synth_family_t*)bsearch(&key, families, *family_count,
+                                       sizeof(synth_family_t),
+                                       synth_family_compare);
+   if (found == NULL) return NULL;
+
+   for (i = found->first; i < count; i++) {
+      const synth_entry_t*  entry = &table[i];
+      if ((val & entry->mask) != entry->value) continue;
+      if (entry->pred != NULL && (stash == NULL || !entry->pred(stash))) {
+         continue;
+      }
+      return entry->result;
+   }
+
+   return NULL;
+}
+
+/*
+** The *Q table entries need their decode_* query macros in function form.
+*/
+#define SYNTH_PRED(name)                          \
+   static boolean                                 \
+   synth_pred_##name(const code_stash_t*  stash)  \
+   {                                              \
+      return (name) != 0;                         \
+   }
+
+/* Intel */
+SYNTH_PRED(DG)
+SYNTH_PRED(LG)
+SYNTH_PRED(LU)
+SYNTH_PRED(LY)
+SYNTH_PRED(MC)
+SYNTH_PRED(MM)
+SYNTH_PRED(MP)
+SYNTH_PRED(Mc)
+SYNTH_PRED(Me)
+SYNTH_PRED(QW)
+SYNTH_PRED(Qc)
+SYNTH_PRED(Qe)
+SYNTH_PRED(UC)
+SYNTH_PRED(UP)
+SYNTH_PRED(UX)
+SYNTH_PRED(XE)
+SYNTH_PRED(Xc)
+SYNTH_PRED(Y8)
+SYNTH_PRED(YC)
+SYNTH_PRED(YP)
+SYNTH_PRED(cD)
+SYNTH_PRED(d1)
+SYNTH_PRED(dC)
+SYNTH_PRED(dG)
+SYNTH_PRED(dL)
+SYNTH_PRED(dP)
+SYNTH_PRED(da)
+SYNTH_PRED(dc)
+SYNTH_PRED(dd)
+SYNTH_PRED(de)
+SYNTH_PRED(mD)
+SYNTH_PRED(pK)
+SYNTH_PRED(s7)
+SYNTH_PRED(sI)
+SYNTH_PRED(sM)
+SYNTH_PRED(sP)
+SYNTH_PRED(sQ)
+SYNTH_PRED(sS)
+SYNTH_PRED(sX)
+SYNTH_PRED(se)
+SYNTH_PRED(xD)
+SYNTH_PRED(xK)
+
+/* AMD */
+SYNTH_PRED(AR)
+SYNTH_PRED(DA)
+SYNTH_PRED(DO)
+SYNTH_PRED(DS)
+SYNTH_PRED(Dp)
+SYNTH_PRED(EE)
+SYNTH_PRED(EO)
+SYNTH_PRED(ER)
+SYNTH_PRED(MA)
+SYNTH_PRED(MD)
+SYNTH_PRED(MG)
+SYNTH_PRED(ML)
+SYNTH_PRED(MN)
+SYNTH_PRED(MS)
+SYNTH_PRED(MT)
+SYNTH_PRED(MU)
+SYNTH_PRED(MX)
+SYNTH_PRED(Mn)
+SYNTH_PRED(Mp)
+SYNTH_PRED(Mr)
+SYNTH_PRED(Ms)
+SYNTH_PRED(Mt)
+SYNTH_PRED(QA)
+SYNTH_PRED(Qp)
+SYNTH_PRED(SO)
+SYNTH_PRED(Sa)
+SYNTH_PRED(Sc)
+SYNTH_PRED(Se)
+SYNTH_PRED(Sg)
+SYNTH_PRED(Sp)
+SYNTH_PRED(Sr)
+SYNTH_PRED(Sz)
+SYNTH_PRED(TA)
+SYNTH_PRED(Ta)
+SYNTH_PRED(Te)
+SYNTH_PRED(Tp)
+SYNTH_PRED(dA)
+SYNTH_PRED(dD)
+SYNTH_PRED(dF)
+SYNTH_PRED(dI)
+SYNTH_PRED(dR)
+SYNTH_PRED(dS)
+SYNTH_PRED(dX)
+SYNTH_PRED(df)
+SYNTH_PRED(dm)
+SYNTH_PRED(dr)
+SYNTH_PRED(dt)
+SYNTH_PRED(s8)
+SYNTH_PRED(sA)
+SYNTH_PRED(sD)
+SYNTH_PRED(sE)
+SYNTH_PRED(sO)
+
+#undef SYNTH_PRED
+
+/*
+** Within the Intel & AMD synth tables, the F/FM/... macros produce
+** synth_entry_t initializers instead of if-chain arms.  The if-chain
+** forms are restored after decode_synth_amd() for the remaining, much
+** smaller chains.
+*/
+#undef F
+#undef FM
+#undef FMS
+#undef TF
+#undef TFM
+#undef TFMS
+#undef FQ
+#undef FMQ
+#undef FMSQ
+#define F(xf,f,...) \
+   { __F(~0U),    _XF(xf)        +_F(f),                  NULL,            __VA_ARGS__ },
+#define FM(xf,f,xm,m,...) \
+   { __FM(~0U),   _XF(xf)+_XM(xm)+_F(f)+_M(m),            NULL,            __VA_ARGS__ },
+#define FMS(xf,f,xm,m,s,...) \
+   { __FMS(~0U),  _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s),      NULL,            __VA_ARGS__ },
+#define TF(t,xf,f,...) \
+   { __TF(~0U),   _T(t)+_XF(xf)        +_F(f),            NULL,            __VA_ARGS__ },
+#define TFM(t,xf,f,xm,m,...) \
+   { __TFM(~0U),  _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m),      NULL,            __VA_ARGS__ },
+#define TFMS(t,xf,f,xm,m,s,...) \
+   { __TFMS(~0U), _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s), NULL,           __VA_ARGS__ },
+#define FQ(xf,f,q,...) \
+   { __F(~0U),    _XF(xf)        +_F(f),                  synth_pred_##q,  __VA_ARGS__ },
+#define FMQ(xf,f,xm,m,q,...) \
+   { __FM(~0U),   _XF(xf)+_XM(xm)+_F(f)+_M(m),            synth_pred_##q,  __VA_ARGS__ },
+#define FMSQ(xf,f,xm,m,s,q,...) \
+   { __FMS(~0U),  _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s),      synth_pred_##q,  __VA_ARGS__ },
+
+static cstring COLD
 decode_synth_intel(unsigned int         val,  /* val_1_eax */
                    const code_stash_t*  stash)
 {
-   cstring  result = NULL;
-   
-   START;
-   FM  (    0, 4,  0, 0,         "Intel i80486DX-25/33, .18um"); // process from sandpile.org
-   FM  (    0, 4,  0, 1,         "Intel i80486DX-50, .18um"); // process from sandpile.org
-   FM  (    0, 4,  0, 2,         "Intel i80486SX, .18um"); // process from sandpile.org
-   FM  (    0, 4,  0, 3,         "Intel i80486DX/2");
-   FM  (    0, 4,  0, 4,         "Intel i80486SL, .8um");
-   FM  (    0, 4,  0, 5,         "Intel i80486SX/2, .8um");
-   FM  (    0, 4,  0, 7,         "Intel i80486DX/2-WB, .8um");
-   FM  (    0, 4,  0, 8,         "Intel i80486DX/4, .6um");
-   FM  (    0, 4,  0, 9,         "Intel i80486DX/4-WB, .6um");
-   F   (    0, 4,                "Intel i80486 (unknown model)");
-   FM  (    0, 5,  0, 0,         "Intel Pentium 60/66 A-step"); // no docs
+   static const synth_entry_t  table[] = {
+   FM  (    0, 4,  0, 0,         "Intel i80486DX-25/33, .18um") // process from sandpile.org
+   FM  (    0, 4,  0, 1,         "Intel i80486DX-50, .18um") // process from sandpile.org
+   FM  (    0, 4,  0, 2,         "Intel i80486SX, .18um") // process from sandpile.org
+   FM  (    0, 4,  0, 3,         "Intel i80486DX/2")
+   FM  (    0, 4,  0, 4,         "Intel i80486SL, .8um")
+   FM  (    0, 4,  0, 5,         "Intel i80486SX/2, .8um")
+   FM  (    0, 4,  0, 7,         "Intel i80486DX/2-WB, .8um")
+   FM  (    0, 4,  0, 8,         "Intel i80486DX/4, .6um")
+   FM  (    0, 4,  0, 9,         "Intel i80486DX/4-WB, .6um")
+   F   (    0, 4,                "Intel i80486 (unknown model)")
+   FM  (    0, 5,  0, 0,         "Intel Pentium 60/66 A-step") // no docs
    // Intel docs (243326).
-   TFM (1,  0, 5,  0, 1,         "Intel Pentium 60/66 OverDrive for P5");
-   FMS (    0, 5,  0, 1,  3,     "Intel Pentium 60/66 (B1)");
-   FMS (    0, 5,  0, 1,  5,     "Intel Pentium 60/66 (C1)");
-   FMS (    0, 5,  0, 1,  7,     "Intel Pentium 60/66 (D1)");
-   FM  (    0, 5,  0, 1,         "Intel Pentium 60/66");
+   TFM (1,  0, 5,  0, 1,         "Intel Pentium 60/66 OverDrive for P5")
+   FMS (    0, 5,  0, 1,  3,     "Intel Pentium 60/66 (B1)")
+   FMS (    0, 5,  0, 1,  5,     "Intel Pentium 60/66 (C1)")
+   FMS (    0, 5,  0, 1,  7,     "Intel Pentium 60/66 (D1)")
+   FM  (    0, 5,  0, 1,         "Intel Pentium 60/66")
    // Intel docs (242480).
-   TFM (1,  0, 5,  0, 2,         "Intel Pentium 75 - 200 OverDrive for P54C");
-   FMS (    0, 5,  0, 2,  1,     "Intel Pentium P54C 75 - 200 (B1)");
-   FMS (    0, 5,  0, 2,  2,     "Intel Pentium P54C 75 - 200 (B3)");
-   FMS (    0, 5,  0, 2,  4,     "Intel Pentium P54C 75 - 200 (B5)");
-   FMS (    0, 5,  0, 2,  5,     "Intel Pentium P54C 75 - 200 (C2/mA1)");
-   FMS (    0, 5,  0, 2,  6,     "Intel Pentium P54C 75 - 200 (E0)");
-   FMS (    0, 5,  0, 2, 11,     "Intel Pentium P54C 75 - 200 (cB1)");
-   FMS (    0, 5,  0, 2, 12,     "Intel Pentium P54C 75 - 200 (cC0)");
-   FM  (    0, 5,  0, 2,         "Intel Pentium P54C 75 - 200");
-   TFM (1,  0, 5,  0, 3,         "Intel Pentium OverDrive for i486 (P24T)"); // no docs
+   TFM (1,  0, 5,  0, 2,         "Intel Pentium 75 - 200 OverDrive for P54C")
+   FMS (    0, 5,  0, 2,  1,     "Intel Pentium P54C 75 - 200 (B1)")
+   FMS (    0, 5,  0, 2,  2,     "Intel Pentium P54C 75 - 200 (B3)")
+   FMS (    0, 5,  0, 2,  4,     "Intel Pentium P54C 75 - 200 (B5)")
+   FMS (    0, 5,  0, 2,  5,     "Intel Pentium P54C 75 - 200 (C2/mA1)")
+   FMS (    0, 5,  0, 2,  6,     "Intel Pentium P54C 75 - 200 (E0)")
+   FMS (    0, 5,  0, 2, 11,     "Intel Pentium P54C 75 - 200 (cB1)")
+   FMS (    0, 5,  0, 2, 12,     "Intel Pentium P54C 75 - 200 (cC0)")
+   FM  (    0, 5,  0, 2,         "Intel Pentium P54C 75 - 200")
+   TFM (1,  0, 5,  0, 3,         "Intel Pentium OverDrive for i486 (P24T)") // no docs
    // Intel docs (242480).
-   TFM (1,  0, 5,  0, 4,         "Intel Pentium OverDrive for P54C");
-   FMS (    0, 5,  0, 4,  3,     "Intel Pentium MMX P55C (B1)");
-   FMS (    0, 5,  0, 4,  4,     "Intel Pentium MMX P55C (A3)");
-   FM  (    0, 5,  0, 4,         "Intel Pentium MMX P55C");
+   TFM (1,  0, 5,  0, 4,         "Intel Pentium OverDrive for P54C")
+   FMS (    0, 5,  0, 4,  3,     "Intel Pentium MMX P55C (B1)")
+   FMS (    0, 5,  0, 4,  4,     "Intel Pentium MMX P55C (A3)")
+   FM  (    0, 5,  0, 4,         "Intel Pentium MMX P55C")
    // Intel docs (242480).
-   FMS (    0, 5,  0, 7,  0,     "Intel Pentium MMX P54C 75 - 200 (A4)");
-   FM  (    0, 5,  0, 7,         "Intel Pentium MMX P54C 75 - 200");
+   FMS (    0, 5,  0, 7,  0,     "Intel Pentium MMX P54C 75 - 200 (A4)")
+   FM  (    0, 5,  0, 7,         "Intel Pentium MMX P54C 75 - 200")
    // Intel docs (242480).
-   FMS (    0, 5,  0, 8,  1,     "Intel Pentium MMX P55C (Tillamook A0)");
-   FMS (    0, 5,  0, 8,  2,     "Intel Pentium MMX P55C (Tillamook B2)");
-   FM  (    0, 5,  0, 8,         "Intel Pentium MMX P55C (Tillamook)");
+   FMS (    0, 5,  0, 8,  1,     "Intel Pentium MMX P55C (Tillamook A0)")
+   FMS (    0, 5,  0, 8,  2,     "Intel Pentium MMX P55C (Tillamook B2)")
+   FM  (    0, 5,  0, 8,         "Intel Pentium MMX P55C (Tillamook)")
    // Intel docs (329676) provides stepping names, but no numbers.
    // However, A0 is the only name.
-   FM  (    0, 5,  0, 9,         "Intel Quark X1000 / D1000 / D2000 / C1000 (Lakemont)");
-   F   (    0, 5,                "Intel Pentium (unknown model)");
-   FM  (    0, 6,  0, 0,         "Intel Pentium Pro A-step");
+   FM  (    0, 5,  0, 9,         "Intel Quark X1000 / D1000 / D2000 / C1000 (Lakemont)")
+   F   (    0, 5,                "Intel Pentium (unknown model)")
+   FM  (    0, 6,  0, 0,         "Intel Pentium Pro A-step")
    // Intel docs (242689).
-   FMS (    0, 6,  0, 1,  1,     "Intel Pentium Pro (B0)");
-   FMS (    0, 6,  0, 1,  2,     "Intel Pentium Pro (C0)");
-   FMS (    0, 6,  0, 1,  6,     "Intel Pentium Pro (sA0)");
-   FMS (    0, 6,  0, 1,  7,     "Intel Pentium Pro (sA1), .35um");
-   FMS (    0, 6,  0, 1,  9,     "Intel Pentium Pro (sB1), .35um");
-   FM  (    0, 6,  0, 1,         "Intel Pentium Pro");
+   FMS (    0, 6,  0, 1,  1,     "Intel Pentium Pro (B0)")
+   FMS (    0, 6,  0, 1,  2,     "Intel Pentium Pro (C0)")
+   FMS (    0, 6,  0, 1,  6,     "Intel Pentium Pro (sA0)")
+   FMS (    0, 6,  0, 1,  7,     "Intel Pentium Pro (sA1), .35um")
+   FMS (    0, 6,  0, 1,  9,     "Intel Pentium Pro (sB1), .35um")
+   FM  (    0, 6,  0, 1,         "Intel Pentium Pro")
    // Intel docs (243337)
-   TFM (1,  0, 6,  0, 3,         "Intel Pentium II OverDrive");
-   FMS (    0, 6,  0, 3,  3,     "Intel Pentium II (Klamath C0)");
-   FMS (    0, 6,  0, 3,  4,     "Intel Pentium II (Klamath C1)");
-   FM  (    0, 6,  0, 3,         "Intel Pentium II (Klamath)");
-   FM  (    0, 6,  0, 4,         "Intel Pentium P55CT OverDrive (Deschutes)");
+   TFM (1,  0, 6,  0, 3,         "Intel Pentium II OverDrive")
+   FMS (    0, 6,  0, 3,  3,     "Intel Pentium II (Klamath C0)")
+   FMS (    0, 6,  0, 3,  4,     "Intel Pentium II (Klamath C1)")
+   FM  (    0, 6,  0, 3,         "Intel Pentium II (Klamath)")
+   FM  (    0, 6,  0, 4,         "Intel Pentium P55CT OverDrive (Deschutes)")
    // Intel docs (243337, 243748, 243776, 243887).
-   FMSQ(    0, 6,  0, 5,  0, xD, "Intel Pentium II Xeon (Deschutes A0)");
-   FMSQ(    0, 6,  0, 5,  0, mD, "Intel Mobile Pentium II (Deschutes A0)");
-   FMSQ(    0, 6,  0, 5,  0, cD, "Intel Celeron (Deschutes A0)");
-   FMS (    0, 6,  0, 5,  0,     "Intel Pentium II (unknown type) (Deschutes A0)");
-   FMSQ(    0, 6,  0, 5,  1, xD, "Intel Pentium II Xeon (Deschutes A1)");
-   FMSQ(    0, 6,  0, 5,  1, cD, "Intel Celeron (Deschutes A1)");
-   FMS (    0, 6,  0, 5,  1,     "Intel Pentium II (unknown type) (Deschutes A1)");
-   FMSQ(    0, 6,  0, 5,  2, xD, "Intel Pentium II Xeon (Deschutes B0)");
-   FMSQ(    0, 6,  0, 5,  2, mD, "Intel Mobile Pentium II (Deschutes B0)");
-   FMSQ(    0, 6,  0, 5,  2, cD, "Intel Celeron (Deschutes B0)");
-   FMS (    0, 6,  0, 5,  2,     "Intel Pentium II (unknown type) (Deschutes B0)");
-   FMSQ(    0, 6,  0, 5,  3, xD, "Intel Pentium II Xeon (Deschutes B1)");
-   FMSQ(    0, 6,  0, 5,  3, cD, "Intel Celeron (Deschutes B1)");
-   FMS (    0, 6,  0, 5,  3,     "Intel Pentium II (unknown type) (Deschutes B1)");
-   FMQ (    0, 6,  0, 5,     xD, "Intel Pentium II Xeon (Deschutes)");
-   FMQ (    0, 6,  0, 5,     mD, "Intel Mobile Pentium II (Deschutes)");
-   FMQ (    0, 6,  0, 5,     cD, "Intel Celeron (Deschutes)");
-   FM  (    0, 6,  0, 5,         "Intel Pentium II (unknown type) (Deschutes)");
+   FMSQ(    0, 6,  0, 5,  0, xD, "Intel Pentium II Xeon (Deschutes A0)")
+   FMSQ(    0, 6,  0, 5,  0, mD, "Intel Mobile Pentium II (Deschutes A0)")
+   FMSQ(    0, 6,  0, 5,  0, cD, "Intel Celeron (Deschutes A0)")
+   FMS (    0, 6,  0, 5,  0,     "Intel Pentium II (unknown type) (Deschutes A0)")
+   FMSQ(    0, 6,  0, 5,  1, xD, "Intel Pentium II Xeon (Deschutes A1)")
+   FMSQ(    0, 6,  0, 5,  1, cD, "Intel Celeron (Deschutes A1)")
+   FMS (    0, 6,  0, 5,  1,     "Intel Pentium II (unknown type) (Deschutes A1)")
+   FMSQ(    0, 6,  0, 5,  2, xD, "Intel Pentium II Xeon (Deschutes B0)")
+   FMSQ(    0, 6,  0, 5,  2, mD, "Intel Mobile Pentium II (Deschutes B0)")
+   FMSQ(    0, 6,  0, 5,  2, cD, "Intel Celeron (Deschutes B0)")
+   FMS (    0, 6,  0, 5,  2,     "Intel Pentium II (unknown type) (Deschutes B0)")
+   FMSQ(    0, 6,  0, 5,  3, xD, "Intel Pentium II Xeon (Deschutes B1)")
+   FMSQ(    0, 6,  0, 5,  3, cD, "Intel Celeron (Deschutes B1)")
+   FMS (    0, 6,  0, 5,  3,     "Intel Pentium II (unknown type) (Deschutes B1)")
+   FMQ (    0, 6,  0, 5,     xD, "Intel Pentium II Xeon (Deschutes)")
+   FMQ (    0, 6,  0, 5,     mD, "Intel Mobile Pentium II (Deschutes)")
+   FMQ (    0, 6,  0, 5,     cD, "Intel Celeron (Deschutes)")
+   FM  (    0, 6,  0, 5,         "Intel Pentium II (unknown type) (Deschutes)")
    // Intel docs (243748, 243887, 244444).
-   FMSQ(    0, 6,  0, 6,  0, dP, "Intel Pentium II (Mendocino A0)");
-   FMSQ(    0, 6,  0, 6,  0, dC, "Intel Celeron (Mendocino A0)");
-   FMS (    0, 6,  0, 6,  0,     "Intel Pentium II (unknown type) (Mendocino A0)");
-   FMSQ(    0, 6,  0, 6,  5, dC, "Intel Celeron (Mendocino B0)");
-   FMSQ(    0, 6,  0, 6,  5, dP, "Intel Pentium II (Mendocino B0)");
-   FMS (    0, 6,  0, 6,  5,     "Intel Pentium II (unknown type) (Mendocino B0)");
-   FMS (    0, 6,  0, 6, 10,     "Intel Mobile Pentium II (Mendocino A0)");
-   FM  (    0, 6,  0, 6,         "Intel Pentium II (Mendocino)");
+   FMSQ(    0, 6,  0, 6,  0, dP, "Intel Pentium II (Mendocino A0)")
+   FMSQ(    0, 6,  0, 6,  0, dC, "Intel Celeron (Mendocino A0)")
+   FMS (    0, 6,  0, 6,  0,     "Intel Pentium II (unknown type) (Mendocino A0)")
+   FMSQ(    0, 6,  0, 6,  5, dC, "Intel Celeron (Mendocino B0)")
+   FMSQ(    0, 6,  0, 6,  5, dP, "Intel Pentium II (Mendocino B0)")
+   FMS (    0, 6,  0, 6,  5,     "Intel Pentium II (unknown type) (Mendocino B0)")
+   FMS (    0, 6,  0, 6, 10,     "Intel Mobile Pentium II (Mendocino A0)")
+   FM  (    0, 6,  0, 6,         "Intel Pentium II (Mendocino)")
    // Intel docs (244453, 244460).
-   FMSQ(    0, 6,  0, 7,  2, pK, "Intel Pentium III (Katmai B0)");
-   FMSQ(    0, 6,  0, 7,  2, xK, "Intel Pentium III Xeon (Katmai B0)");
-   FMS (    0, 6,  0, 7,  2,     "Intel Pentium III (unknown type) (Katmai B0)");
-   FMSQ(    0, 6,  0, 7,  3, pK, "Intel Pentium III (Katmai C0)");
-   FMSQ(    0, 6,  0, 7,  3, xK, "Intel Pentium III Xeon (Katmai C0)");
-   FMS (    0, 6,  0, 7,  3,     "Intel Pentium III (unknown type) (Katmai C0)");
-   FMQ (    0, 6,  0, 7,     pK, "Intel Pentium III (Katmai)");
-   FMQ (    0, 6,  0, 7,     xK, "Intel Pentium III Xeon (Katmai)");
-   FM  (    0, 6,  0, 7,         "Intel Pentium III (unknown type) (Katmai)");
+   FMSQ(    0, 6,  0, 7,  2, pK, "Intel Pentium III (Katmai B0)")
+   FMSQ(    0, 6,  0, 7,  2, xK, "Intel Pentium III Xeon (Katmai B0)")
+   FMS (    0, 6,  0, 7,  2,     "Intel Pentium III (unknown type) (Katmai B0)")
+   FMSQ(    0, 6,  0, 7,  3, pK, "Intel Pentium III (Katmai C0)")
+   FMSQ(    0, 6,  0, 7,  3, xK, "Intel Pentium III Xeon (Katmai C0)")
+   FMS (    0, 6,  0, 7,  3,     "Intel Pentium III (unknown type) (Katmai C0)")
+   FMQ (    0, 6,  0, 7,     pK, "Intel Pentium III (Katmai)")
+   FMQ (    0, 6,  0, 7,     xK, "Intel Pentium III Xeon (Katmai)")
+   FM  (    0, 6,  0, 7,         "Intel Pentium III (unknown type) (Katmai)")
    // Intel docs (243748, 244453, 244460, 245306, 245421).
-   FMSQ(    0, 6,  0, 8,  1, sX, "Intel Pentium III Xeon (Coppermine A2)");
-   FMSQ(    0, 6,  0, 8,  1, MC, "Intel Mobile Celeron (Coppermine A2)");
-   FMSQ(    0, 6,  0, 8,  1, dC, "Intel Celeron (Coppermine A2)");
-   FMSQ(    0, 6,  0, 8,  1, MP, "Intel Mobile Pentium III (Coppermine A2)");
-   FMSQ(    0, 6,  0, 8,  1, dP, "Intel Pentium III (Coppermine A2)");
-   FMS (    0, 6,  0, 8,  1,     "Intel Pentium III (unknown type) (Coppermine A2)");
-   FMSQ(    0, 6,  0, 8,  3, sX, "Intel Pentium III Xeon (Coppermine B0)");
-   FMSQ(    0, 6,  0, 8,  3, MC, "Intel Mobile Celeron (Coppermine B0)");
-   FMSQ(    0, 6,  0, 8,  3, dC, "Intel Celeron (Coppermine B0)");
-   FMSQ(    0, 6,  0, 8,  3, MP, "Intel Mobile Pentium III (Coppermine B0)");
-   FMSQ(    0, 6,  0, 8,  3, dP, "Intel Pentium III (Coppermine B0)");
-   FMS (    0, 6,  0, 8,  3,     "Intel Pentium III (unknown type) (Coppermine B0)");
-   FMSQ(    0, 6,  0, 8,  6, sX, "Intel Pentium III Xeon (Coppermine C0)");
-   FMSQ(    0, 6,  0, 8,  6, MC, "Intel Mobile Celeron (Coppermine C0)");
-   FMSQ(    0, 6,  0, 8,  6, dC, "Intel Celeron (Coppermine C0)");
-   FMSQ(    0, 6,  0, 8,  6, MP, "Intel Mobile Pentium III (Coppermine C0)");
-   FMSQ(    0, 6,  0, 8,  6, dP, "Intel Pentium III (Coppermine C0)");
-   FMS (    0, 6,  0, 8,  6,     "Intel Pentium III (unknown type) (Coppermine C0)");
-   FMSQ(    0, 6,  0, 8, 10, sX, "Intel Pentium III Xeon (Coppermine D0)");
-   FMSQ(    0, 6,  0, 8, 10, MC, "Intel Mobile Celeron (Coppermine D0)");
-   FMSQ(    0, 6,  0, 8, 10, dC, "Intel Celeron (Coppermine D0)");
-   FMSQ(    0, 6,  0, 8, 10, MP, "Intel Mobile Pentium III (Coppermine D0)");
-   FMSQ(    0, 6,  0, 8, 10, dP, "Intel Pentium III (Coppermine D0)");
-   FMS (    0, 6,  0, 8, 10,     "Intel Pentium III (unknown type) (Coppermine D0)");
-   FMQ (    0, 6,  0, 8,     sX, "Intel Pentium III Xeon (Coppermine)");
-   FMQ (    0, 6,  0, 8,     MC, "Intel Mobile Celeron (Coppermine)");
-   FMQ (    0, 6,  0, 8,     dC, "Intel Celeron (Coppermine)");
-   FMQ (    0, 6,  0, 8,     MP, "Intel Mobile Pentium III (Coppermine)");
-   FMQ (    0, 6,  0, 8,     dP, "Intel Pentium III (Coppermine)");
-   FM  (    0, 6,  0, 8,         "Intel Pentium III (unknown type) (Coppermine)");
+   FMSQ(    0, 6,  0, 8,  1, sX, "Intel Pentium III Xeon (Coppermine A2)")
+   FMSQ(    0, 6,  0, 8,  1, MC, "Intel Mobile Celeron (Coppermine A2)")
+   FMSQ(    0, 6,  0, 8,  1, dC, "Intel Celeron (Coppermine A2)")
+   FMSQ(    0, 6,  0, 8,  1, MP, "Intel Mobile Pentium III (Coppermine A2)")
+   FMSQ(    0, 6,  0, 8,  1, dP, "Intel Pentium III (Coppermine A2)")
+   FMS (    0, 6,  0, 8,  1,     "Intel Pentium III (unknown type) (Coppermine A2)")
+   FMSQ(    0, 6,  0, 8,  3, sX, "Intel Pentium III Xeon (Coppermine B0)")
+   FMSQ(    0, 6,  0, 8,  3, MC, "Intel Mobile Celeron (Coppermine B0)")
+   FMSQ(    0, 6,  0, 8,  3, dC, "Intel Celeron (Coppermine B0)")
+   FMSQ(    0, 6,  0, 8,  3, MP, "Intel Mobile Pentium III (Coppermine B0)")
+   FMSQ(    0, 6,  0, 8,  3, dP, "Intel Pentium III (Coppermine B0)")
+   FMS (    0, 6,  0, 8,  3,     "Intel Pentium III (unknown type) (Coppermine B0)")
+   FMSQ(    0, 6,  0, 8,  6, sX, "Intel Pentium III Xeon (Coppermine C0)")
+   FMSQ(    0, 6,  0, 8,  6, MC, "Intel Mobile Celeron (Coppermine C0)")
+   FMSQ(    0, 6,  0, 8,  6, dC, "Intel Celeron (Coppermine C0)")
+   FMSQ(    0, 6,  0, 8,  6, MP, "Intel Mobile Pentium III (Coppermine C0)")
+   FMSQ(    0, 6,  0, 8,  6, dP, "Intel Pentium III (Coppermine C0)")
+   FMS (    0, 6,  0, 8,  6,     "Intel Pentium III (unknown type) (Coppermine C0)")
+   FMSQ(    0, 6,  0, 8, 10, sX, "Intel Pentium III Xeon (Coppermine D0)")
+   FMSQ(    0, 6,  0, 8, 10, MC, "Intel Mobile Celeron (Coppermine D0)")
+   FMSQ(    0, 6,  0, 8, 10, dC, "Intel Celeron (Coppermine D0)")
+   FMSQ(    0, 6,  0, 8, 10, MP, "Intel Mobile Pentium III (Coppermine D0)")
+   FMSQ(    0, 6,  0, 8, 10, dP, "Intel Pentium III (Coppermine D0)")
+   FMS (    0, 6,  0, 8, 10,     "Intel Pentium III (unknown type) (Coppermine D0)")
+   FMQ (    0, 6,  0, 8,     sX, "Intel Pentium III Xeon (Coppermine)")
+   FMQ (    0, 6,  0, 8,     MC, "Intel Mobile Celeron (Coppermine)")
+   FMQ (    0, 6,  0, 8,     dC, "Intel Celeron (Coppermine)")
+   FMQ (    0, 6,  0, 8,     MP, "Intel Mobile Pentium III (Coppermine)")
+   FMQ (    0, 6,  0, 8,     dP, "Intel Pentium III (Coppermine)")
+   FM  (    0, 6,  0, 8,         "Intel Pentium III (unknown type) (Coppermine)")
    // Intel docs (252665, 300303).
-   FMSQ(    0, 6,  0, 9,  5, dC, "Intel Celeron M (Banias B1)");
-   FMSQ(    0, 6,  0, 9,  5, dP, "Intel Pentium M (Banias B1)");
-   FMS (    0, 6,  0, 9,  5,     "Intel Pentium M (unknown type) (Banias B1)");
-   FMQ (    0, 6,  0, 9,     dC, "Intel Celeron M (Banias)");
-   FMQ (    0, 6,  0, 9,     dP, "Intel Pentium M (Banias)");
-   FM  (    0, 6,  0, 9,         "Intel Pentium M (unknown type) (Banias)");
+   FMSQ(    0, 6,  0, 9,  5, dC, "Intel Celeron M (Banias B1)")
+   FMSQ(    0, 6,  0, 9,  5, dP, "Intel Pentium M (Banias B1)")
+   FMS (    0, 6,  0, 9,  5,     "Intel Pentium M (unknown type) (Banias B1)")
+   FMQ (    0, 6,  0, 9,     dC, "Intel Celeron M (Banias)")
+   FMQ (    0, 6,  0, 9,     dP, "Intel Pentium M (Banias)")
+   FM  (    0, 6,  0, 9,         "Intel Pentium M (unknown type) (Banias)")
    // Intel docs (244460).
-   FMS (    0, 6,  0,10,  0,     "Intel Pentium III Xeon (Cascades A0)");
-   FMS (    0, 6,  0,10,  1,     "Intel Pentium III Xeon (Cascades A1)");
-   FMS (    0, 6,  0,10,  4,     "Intel Pentium III Xeon (Cascades B0)");
-   FM  (    0, 6,  0,10,         "Intel Pentium III Xeon (Cascades)");
+   FMS (    0, 6,  0,10,  0,     "Intel Pentium III Xeon (Cascades A0)")
+   FMS (    0, 6,  0,10,  1,     "Intel Pentium III Xeon (Cascades A1)")
+   FMS (    0, 6,  0,10,  4,     "Intel Pentium III Xeon (Cascades B0)")
+   FM  (    0, 6,  0,10,         "Intel Pentium III Xeon (Cascades)")
    // Intel docs (243748, 244453, 245306, 245421).
-   FMSQ(    0, 6,  0,11,  1, dC, "Intel Celeron (Tualatin A1)");
-   FMSQ(    0, 6,  0,11,  1, MC, "Intel Mobile Celeron (Tualatin A1)");
-   FMSQ(    0, 6,  0,11,  1, dP, "Intel Pentium III (Tualatin A1)");
-   FMS (    0, 6,  0,11,  1,     "Intel Pentium III (unknown type) (Tualatin A1)");
-   FMSQ(    0, 6,  0,11,  4, dC, "Intel Celeron (Tualatin B1)");
-   FMSQ(    0, 6,  0,11,  4, MC, "Intel Mobile Celeron (Tualatin B1)");
-   FMSQ(    0, 6,  0,11,  4, dP, "Intel Pentium III (Tualatin B1)");
-   FMS (    0, 6,  0,11,  4,     "Intel Pentium III (unknown type) (Tualatin B1)");
-   FMQ (    0, 6,  0,11,     dC, "Intel Celeron (Tualatin)");
-   FMQ (    0, 6,  0,11,     MC, "Intel Mobile Celeron (Tualatin)");
-   FMQ (    0, 6,  0,11,     dP, "Intel Pentium III (Tualatin)");
-   FM  (    0, 6,  0,11,         "Intel Pentium III (unknown type) (Tualatin)");
+   FMSQ(    0, 6,  0,11,  1, dC, "Intel Celeron (Tualatin A1)")
+   FMSQ(    0, 6,  0,11,  1, MC, "Intel Mobile Celeron (Tualatin A1)")
+   FMSQ(    0, 6,  0,11,  1, dP, "Intel Pentium III (Tualatin A1)")
+   FMS (    0, 6,  0,11,  1,     "Intel Pentium III (unknown type) (Tualatin A1)")
+   FMSQ(    0, 6,  0,11,  4, dC, "Intel Celeron (Tualatin B1)")
+   FMSQ(    0, 6,  0,11,  4, MC, "Intel Mobile Celeron (Tualatin B1)")
+   FMSQ(    0, 6,  0,11,  4, dP, "Intel Pentium III (Tualatin B1)")
+   FMS (    0, 6,  0,11,  4,     "Intel Pentium III (unknown type) (Tualatin B1)")
+   FMQ (    0, 6,  0,11,     dC, "Intel Celeron (Tualatin)")
+   FMQ (    0, 6,  0,11,     MC, "Intel Mobile Celeron (Tualatin)")
+   FMQ (    0, 6,  0,11,     dP, "Intel Pentium III (Tualatin)")
+   FM  (    0, 6,  0,11,         "Intel Pentium III (unknown type) (Tualatin)")
    // Intel docs (300303, 302209).
-   FMSQ(    0, 6,  0,13,  6, dC, "Intel Celeron M (Dothan B1), 90nm");
-   FMSQ(    0, 6,  0,13,  6, dP, "Intel Pentium M (Dothan B1), 90nm");
-   FMS (    0, 6,  0,13,  6,     "Intel Pentium M (unknown type) (Dothan B1), 90nm");
-   FMSQ(    0, 6,  0,13,  8, dC, "Intel Celeron M (Dothan C0), 90nm/65nm");
-   FMSQ(    0, 6,  0,13,  8, MP, "Intel Processor A100/A110 (Stealey C0) / Pentium M (Crofton C0), 90nm");
-   FMSQ(    0, 6,  0,13,  8, dP, "Intel Pentium M (Dothan C0), 90nm");
-   FMS (    0, 6,  0,13,  8,     "Intel Pentium M (unknown type) (Dothan/Stealey/Crofton C0), 90nm/65nm");
-   FMQ (    0, 6,  0,13,     dC, "Intel Celeron M (Dothan)");
-   FMQ (    0, 6,  0,13,     MP, "Intel Processor A100/A110 (Stealey)");
-   FMQ (    0, 6,  0,13,     dP, "Intel Pentium M (Dothan)");
-   FM  (    0, 6,  0,13,         "Intel Pentium M (unknown type) (Dothan/Crofton)");
+   FMSQ(    0, 6,  0,13,  6, dC, "Intel Celeron M (Dothan B1), 90nm")
+   FMSQ(    0, 6,  0,13,  6, dP, "Intel Pentium M (Dothan B1), 90nm")
+   FMS (    0, 6,  0,13,  6,     "Intel Pentium M (unknown type) (Dothan B1), 90nm")
+   FMSQ(    0, 6,  0,13,  8, dC, "Intel Celeron M (Dothan C0), 90nm/65nm")
+   FMSQ(    0, 6,  0,13,  8, MP, "Intel Processor A100/A110 (Stealey C0) / Pentium M (Crofton C0), 90nm")
+   FMSQ(    0, 6,  0,13,  8, dP, "Intel Pentium M (Dothan C0), 90nm")
+   FMS (    0, 6,  0,13,  8,     "Intel Pentium M (unknown type) (Dothan/Stealey/Crofton C0), 90nm/65nm")
+   FMQ (    0, 6,  0,13,     dC, "Intel Celeron M (Dothan)")
+   FMQ (    0, 6,  0,13,     MP, "Intel Processor A100/A110 (Stealey)")
+   FMQ (    0, 6,  0,13,     dP, "Intel Pentium M (Dothan)")
+   FM  (    0, 6,  0,13,         "Intel Pentium M (unknown type) (Dothan/Crofton)")
    // Intel docs (300303, 309222, 311392, 316515).
-   FMSQ(    0, 6,  0,14,  8, sX, "Intel Xeon Processor LV (Sossaman C0)");
-   FMSQ(    0, 6,  0,14,  8, dC, "Intel Celeron (Yonah C0)");
-   FMSQ(    0, 6,  0,14,  8, DG, "Intel Core Duo (Yonah C0)");
-   FMSQ(    0, 6,  0,14,  8, dG, "Intel Core Solo (Yonah C0)");
-   FMS (    0, 6,  0,14,  8,     "Intel Core (unknown type) (Yonah/Sossaman C0)");
-   FMSQ(    0, 6,  0,14, 12, sX, "Intel Xeon Processor LV (Sossaman D0)");
-   FMSQ(    0, 6,  0,14, 12, dC, "Intel Celeron M (Yonah D0)");
-   FMSQ(    0, 6,  0,14, 12, MP, "Intel Pentium Dual-Core Mobile T2000 (Yonah D0)");
-   FMSQ(    0, 6,  0,14, 12, DG, "Intel Core Duo (Yonah D0)");
-   FMSQ(    0, 6,  0,14, 12, dG, "Intel Core Solo (Yonah D0)");
-   FMS (    0, 6,  0,14, 12,     "Intel Core (unknown type) (Yonah/Sossaman D0)");
-   FMS (    0, 6,  0,14, 13,     "Intel Pentium Dual-Core Mobile T2000 (Yonah M0)");
-   FMQ (    0, 6,  0,14,     sX, "Intel Xeon Processor LV (Sossaman)");
-   FMQ (    0, 6,  0,14,     dC, "Intel Celeron (Yonah)");
-   FMQ (    0, 6,  0,14,     MP, "Intel Pentium Dual-Core Mobile (Yonah)");
-   FMQ (    0, 6,  0,14,     DG, "Intel Core Duo (Yonah)");
-   FMQ (    0, 6,  0,14,     dG, "Intel Core Solo (Yonah)");
-   FM  (    0, 6,  0,14,         "Intel Core (unknown type) (Yonah/Sossaman)");
+   FMSQ(    0, 6,  0,14,  8, sX, "Intel Xeon Processor LV (Sossaman C0)")
+   FMSQ(    0, 6,  0,14,  8, dC, "Intel Celeron (Yonah C0)")
+   FMSQ(    0, 6,  0,14,  8, DG, "Intel Core Duo (Yonah C0)")
+   FMSQ(    0, 6,  0,14,  8, dG, "Intel Core Solo (Yonah C0)")
+   FMS (    0, 6,  0,14,  8,     "Intel Core (unknown type) (Yonah/Sossaman C0)")
+   FMSQ(    0, 6,  0,14, 12, sX, "Intel Xeon Processor LV (Sossaman D0)")
+   FMSQ(    0, 6,  0,14, 12, dC, "Intel Celeron M (Yonah D0)")
+   FMSQ(    0, 6,  0,14, 12, MP, "Intel Pentium Dual-Core Mobile T2000 (Yonah D0)")
+   FMSQ(    0, 6,  0,14, 12, DG, "Intel Core Duo (Yonah D0)")
+   FMSQ(    0, 6,  0,14, 12, dG, "Intel Core Solo (Yonah D0)")
+   FMS (    0, 6,  0,14, 12,     "Intel Core (unknown type) (Yonah/Sossaman D0)")
+   FMS (    0, 6,  0,14, 13,     "Intel Pentium Dual-Core Mobile T2000 (Yonah M0)")
+   FMQ (    0, 6,  0,14,     sX, "Intel Xeon Processor LV (Sossaman)")
+   FMQ (    0, 6,  0,14,     dC, "Intel Celeron (Yonah)")
+   FMQ (    0, 6,  0,14,     MP, "Intel Pentium Dual-Core Mobile (Yonah)")
+   FMQ (    0, 6,  0,14,     DG, "Intel Core Duo (Yonah)")
+   FMQ (    0, 6,  0,14,     dG, "Intel Core Solo (Yonah)")
+   FM  (    0, 6,  0,14,         "Intel Core (unknown type) (Yonah/Sossaman)")
    // Intel docs (313279, 313356, 314079, 314916, 315338, 315593, 316134,
    // 316515, 316982, 317667, 318081, 318925, 319735).
-   FMSQ(    0, 6,  0,15,  2, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe L2)");
-   FMSQ(    0, 6,  0,15,  2, Mc, "Intel Core Duo Mobile (Merom L2)");
-   FMSQ(    0, 6,  0,15,  2, dc, "Intel Core Duo (Conroe L2)");
-   FMSQ(    0, 6,  0,15,  2, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale L2)");
-   FMS (    0, 6,  0,15,  2,     "Intel Core (unknown type) (Conroe/Merom/Allendale L2)");
-   FMS (    0, 6,  0,15,  4,     "Intel Core 2 Duo (Conroe B0) / Xeon Processor 5100 (Woodcrest B0) (pre-production)");
-   FMSQ(    0, 6,  0,15,  5, QW, "Intel Dual-Core Xeon Processor 5100 (Woodcrest B1) (pre-production)");
-   FMSQ(    0, 6,  0,15,  5, XE, "Intel Core 2 Extreme Processor (Conroe B1)");
-   FMSQ(    0, 6,  0,15,  5, dL, "Intel Core 2 Duo (Allendale B1)");
-   FMSQ(    0, 6,  0,15,  5, dc, "Intel Core 2 Duo (Conroe B1)");
-   FMS (    0, 6,  0,15,  5,     "Intel Core 2 (unknown type) (Conroe/Allendale B1)");
-   FMSQ(    0, 6,  0,15,  6, Xc, "Intel Core 2 Extreme Processor (Conroe B2)");
-   FMSQ(    0, 6,  0,15,  6, Mc, "Intel Core 2 Duo Mobile (Merom B2)");
-   FMSQ(    0, 6,  0,15,  6, dL, "Intel Core 2 Duo (Allendale B2)");
-   FMSQ(    0, 6,  0,15,  6, dc, "Intel Core 2 Duo (Conroe B2)");
-   FMSQ(    0, 6,  0,15,  6, dC, "Intel Celeron M (Conroe B2)");
-   FMSQ(    0, 6,  0,15,  6, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe B2) / Dual-Core Xeon Processor 5100 (Woodcrest B2)");
-   FMS (    0, 6,  0,15,  6,     "Intel Core 2 (unknown type) (Conroe/Allendale/Woodcrest B2)");
-   FMSQ(    0, 6,  0,15,  7, sX, "Intel Quad-Core Xeon Processor 3200 (Kentsfield B3) / Quad-Core Xeon Processor 5300 (Clovertown B3)");
-   FMSQ(    0, 6,  0,15,  7, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield B3)");
-   FMS (    0, 6,  0,15,  7,     "Intel Core 2 (unknown type) (Kentsfield/Clovertown B3)");
-   FMSQ(    0, 6,  0,15, 10, Mc, "Intel Core 2 Duo Mobile (Merom E1)");
-   FMSQ(    0, 6,  0,15, 10, dC, "Intel Celeron Processor 500 (Merom E1)");
-   FMS (    0, 6,  0,15, 10,     "Intel Core 2 (unknown type) (Merom E1)");
-   FMSQ(    0, 6,  0,15, 11, sQ, "Intel Quad-Core Xeon Processor 5300 (Clovertown G0)");
-   FMSQ(    0, 6,  0,15, 11, sX, "Intel Xeon Processor 3000 (Conroe G0) / Xeon Processor 3200 (Kentsfield G0) / Xeon Processor 7200/7300 (Tigerton G0)");
-   FMSQ(    0, 6,  0,15, 11, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield G0)");
-   FMSQ(    0, 6,  0,15, 11, Mc, "Intel Core 2 Duo Mobile (Merom G2)");
-   FMSQ(    0, 6,  0,15, 11, Qc, "Intel Core 2 Quad (Conroe G0)");
-   FMSQ(    0, 6,  0,15, 11, dc, "Intel Core 2 Duo (Conroe G0)");
-   FMS (    0, 6,  0,15, 11,     "Intel Core 2 (unknown type) (Merom/Conroe/Kentsfield/Clovertown/Tigerton G0)");
-   FMSQ(    0, 6,  0,15, 13, Mc, "Intel Core 2 Duo Mobile (Merom M1) / Celeron Processor 500 (Merom E1)");
-   FMSQ(    0, 6,  0,15, 13, Qc, "Intel Core 2 Quad (Conroe M0)");
-   FMSQ(    0, 6,  0,15, 13, dc, "Intel Core 2 Duo (Conroe M0)");
-   FMSQ(    0, 6,  0,15, 13, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale M0)");
-   FMSQ(    0, 6,  0,15, 13, dC, "Intel Celeron Dual-Core E1000 (Allendale M0) / Celeron Dual-Core T1000 (Merom M0)");
-   FMS (    0, 6,  0,15, 13,     "Intel Core 2 (unknown type) (Merom/Conroe/Allendale M0 / Merom E1)");
-   FMQ (    0, 6,  0,15,     sQ, "Intel Quad-Core Xeon (Woodcrest)");
-   FMQ (    0, 6,  0,15,     sX, "Intel Dual-Core Xeon (Conroe / Woodcrest) / Quad-Core Xeon (Kentsfield / Clovertown) / Xeon (Tigerton G0)");
-   FMQ (    0, 6,  0,15,     Xc, "Intel Core 2 Extreme Processor (Conroe) / Core 2 Extreme Quad-Core (Kentsfield)");
-   FMQ (    0, 6,  0,15,     Mc, "Intel Core Duo Mobile / Core 2 Duo Mobile (Merom) / Celeron (Merom)");
-   FMQ (    0, 6,  0,15,     Qc, "Intel Core 2 Quad (Conroe)");
-   FMQ (    0, 6,  0,15,     dc, "Intel Core Duo / Core 2 Duo (Conroe)");
-   FMQ (    0, 6,  0,15,     dP, "Intel Pentium Dual-Core (Allendale)");
-   FMQ (    0, 6,  0,15,     dC, "Intel Celeron M (Conroe) / Celeron (Merom) / Celeron Dual-Core (Allendale)");
-   FM  (    0, 6,  0,15,         "Intel Core 2 (unknown type) (Merom/Conroe/Allendale/Kentsfield/Allendale/Clovertown/Woodcrest/Tigerton)");
+   FMSQ(    0, 6,  0,15,  2, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe L2)")
+   FMSQ(    0, 6,  0,15,  2, Mc, "Intel Core Duo Mobile (Merom L2)")
+   FMSQ(    0, 6,  0,15,  2, dc, "Intel Core Duo (Conroe L2)")
+   FMSQ(    0, 6,  0,15,  2, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale L2)")
+   FMS (    0, 6,  0,15,  2,     "Intel Core (unknown type) (Conroe/Merom/Allendale L2)")
+   FMS (    0, 6,  0,15,  4,     "Intel Core 2 Duo (Conroe B0) / Xeon Processor 5100 (Woodcrest B0) (pre-production)")
+   FMSQ(    0, 6,  0,15,  5, QW, "Intel Dual-Core Xeon Processor 5100 (Woodcrest B1) (pre-production)")
+   FMSQ(    0, 6,  0,15,  5, XE, "Intel Core 2 Extreme Processor (Conroe B1)")
+   FMSQ(    0, 6,  0,15,  5, dL, "Intel Core 2 Duo (Allendale B1)")
+   FMSQ(    0, 6,  0,15,  5, dc, "Intel Core 2 Duo (Conroe B1)")
+   FMS (    0, 6,  0,15,  5,     "Intel Core 2 (unknown type) (Conroe/Allendale B1)")
+   FMSQ(    0, 6,  0,15,  6, Xc, "Intel Core 2 Extreme Processor (Conroe B2)")
+   FMSQ(    0, 6,  0,15,  6, Mc, "Intel Core 2 Duo Mobile (Merom B2)")
+   FMSQ(    0, 6,  0,15,  6, dL, "Intel Core 2 Duo (Allendale B2)")
+   FMSQ(    0, 6,  0,15,  6, dc, "Intel Core 2 Duo (Conroe B2)")
+   FMSQ(    0, 6,  0,15,  6, dC, "Intel Celeron M (Conroe B2)")
+   FMSQ(    0, 6,  0,15,  6, sX, "Intel Dual-Core Xeon Processor 3000 (Conroe B2) / Dual-Core Xeon Processor 5100 (Woodcrest B2)")
+   FMS (    0, 6,  0,15,  6,     "Intel Core 2 (unknown type) (Conroe/Allendale/Woodcrest B2)")
+   FMSQ(    0, 6,  0,15,  7, sX, "Intel Quad-Core Xeon Processor 3200 (Kentsfield B3) / Quad-Core Xeon Processor 5300 (Clovertown B3)")
+   FMSQ(    0, 6,  0,15,  7, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield B3)")
+   FMS (    0, 6,  0,15,  7,     "Intel Core 2 (unknown type) (Kentsfield/Clovertown B3)")
+   FMSQ(    0, 6,  0,15, 10, Mc, "Intel Core 2 Duo Mobile (Merom E1)")
+   FMSQ(    0, 6,  0,15, 10, dC, "Intel Celeron Processor 500 (Merom E1)")
+   FMS (    0, 6,  0,15, 10,     "Intel Core 2 (unknown type) (Merom E1)")
+   FMSQ(    0, 6,  0,15, 11, sQ, "Intel Quad-Core Xeon Processor 5300 (Clovertown G0)")
+   FMSQ(    0, 6,  0,15, 11, sX, "Intel Xeon Processor 3000 (Conroe G0) / Xeon Processor 3200 (Kentsfield G0) / Xeon Processor 7200/7300 (Tigerton G0)")
+   FMSQ(    0, 6,  0,15, 11, Xc, "Intel Core 2 Extreme Quad-Core Processor QX6xx0 (Kentsfield G0)")
+   FMSQ(    0, 6,  0,15, 11, Mc, "Intel Core 2 Duo Mobile (Merom G2)")
+   FMSQ(    0, 6,  0,15, 11, Qc, "Intel Core 2 Quad (Conroe G0)")
+   FMSQ(    0, 6,  0,15, 11, dc, "Intel Core 2 Duo (Conroe G0)")
+   FMS (    0, 6,  0,15, 11,     "Intel Core 2 (unknown type) (Merom/Conroe/Kentsfield/Clovertown/Tigerton G0)")
+   FMSQ(    0, 6,  0,15, 13, Mc, "Intel Core 2 Duo Mobile (Merom M1) / Celeron Processor 500 (Merom E1)")
+   FMSQ(    0, 6,  0,15, 13, Qc, "Intel Core 2 Quad (Conroe M0)")
+   FMSQ(    0, 6,  0,15, 13, dc, "Intel Core 2 Duo (Conroe M0)")
+   FMSQ(    0, 6,  0,15, 13, dP, "Intel Pentium Dual-Core Desktop Processor E2000 (Allendale M0)")
+   FMSQ(    0, 6,  0,15, 13, dC, "Intel Celeron Dual-Core E1000 (Allendale M0) / Celeron Dual-Core T1000 (Merom M0)")
+   FMS (    0, 6,  0,15, 13,     "Intel Core 2 (unknown type) (Merom/Conroe/Allendale M0 / Merom E1)")
+   FMQ (    0, 6,  0,15,     sQ, "Intel Quad-Core Xeon (Woodcrest)")
+   FMQ (    0, 6,  0,15,     sX, "Intel Dual-Core Xeon (Conroe / Woodcrest) / Quad-Core Xeon (Kentsfield / Clovertown) / Xeon (Tigerton G0)")
+   FMQ (    0, 6,  0,15,     Xc, "Intel Core 2 Extreme Processor (Conroe) / Core 2 Extreme Quad-Core (Kentsfield)")
+   FMQ (    0, 6,  0,15,     Mc, "Intel Core Duo Mobile / Core 2 Duo Mobile (Merom) / Celeron (Merom)")
+   FMQ (    0, 6,  0,15,     Qc, "Intel Core 2 Quad (Conroe)")
+   FMQ (    0, 6,  0,15,     dc, "Intel Core Duo / Core 2 Duo (Conroe)")
+   FMQ (    0, 6,  0,15,     dP, "Intel Pentium Dual-Core (Allendale)")
+   FMQ (    0, 6,  0,15,     dC, "Intel Celeron M (Conroe) / Celeron (Merom) / Celeron Dual-Core (Allendale)")
+   FM  (    0, 6,  0,15,         "Intel Core 2 (unknown type) (Merom/Conroe/Allendale/Kentsfield/Allendale/Clovertown/Woodcrest/Tigerton)")
    // Intel docs (320257).
-   FMS (    0, 6,  1, 5,  0,     "Intel EP80579 (Tolapai B0)");
+   FMS (    0, 6,  1, 5,  0,     "Intel EP80579 (Tolapai B0)")
    // Intel docs (314079, 316964, 317667, 318547).
-   FMSQ(    0, 6,  1, 6,  1, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L A1)");
-   FMSQ(    0, 6,  1, 6,  1, dC, "Intel Celeron M (Merom-L A1)");
-   FMSQ(    0, 6,  1, 6,  1, Mc, "Intel Core 2 Duo Mobile (Merom A1)");
-   FMS (    0, 6,  1, 6,  1,     "Intel Core 2 (unknown type) (Merom/Conroe A1)");
-   FMQ (    0, 6,  1, 6,     MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L)");
-   FMQ (    0, 6,  1, 6,     dC, "Intel Celeron M (Merom-L)");
-   FMQ (    0, 6,  1, 6,     Mc, "Intel Core 2 Duo Mobile (Merom)");
-   FM  (    0, 6,  1, 6,         "Intel Core 2 (unknown type) (Merom/Conroe)");
+   FMSQ(    0, 6,  1, 6,  1, MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L A1)")
+   FMSQ(    0, 6,  1, 6,  1, dC, "Intel Celeron M (Merom-L A1)")
+   FMSQ(    0, 6,  1, 6,  1, Mc, "Intel Core 2 Duo Mobile (Merom A1)")
+   FMS (    0, 6,  1, 6,  1,     "Intel Core 2 (unknown type) (Merom/Conroe A1)")
+   FMQ (    0, 6,  1, 6,     MC, "Intel Celeron Processor 200/400/500 (Conroe-L/Merom-L)")
+   FMQ (    0, 6,  1, 6,     dC, "Intel Celeron M (Merom-L)")
+   FMQ (    0, 6,  1, 6,     Mc, "Intel Core 2 Duo Mobile (Merom)")
+   FM  (    0, 6,  1, 6,         "Intel Core 2 (unknown type) (Merom/Conroe)")
    // Intel docs (318585, 318586, 318727, 318733, 318915, 319006, 319007,
    // 319129, 320121, 320468, 320469, 322568).
-   FMSQ(    0, 6,  1, 7,  6, sQ, "Intel Xeon Processor 3300 (Yorkfield C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)");
-   FMSQ(    0, 6,  1, 7,  6, sX, "Intel Xeon Processor 3100 (Wolfdale C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)");
-   FMSQ(    0, 6,  1, 7,  6, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C0)");
-   FMSQ(    0, 6,  1, 7,  6, Me, "Intel Mobile Core 2 Duo (Penryn C0)");
-   FMSQ(    0, 6,  1, 7,  6, Mc, "Intel Mobile Core 2 Duo (Penryn M0)");
-   FMSQ(    0, 6,  1, 7,  6, de, "Intel Core 2 Duo (Wolfdale C0)");
-   FMSQ(    0, 6,  1, 7,  6, dc, "Intel Core 2 Duo (Wolfdale M0)");
-   FMSQ(    0, 6,  1, 7,  6, dP, "Intel Pentium Dual-Core Processor E5000 (Wolfdale M0)");
-   FMS (    0, 6,  1, 7,  6,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C0/M0)");
-   FMSQ(    0, 6,  1, 7,  7, sQ, "Intel Xeon Processor 3300 (Yorkfield C1)");
-   FMSQ(    0, 6,  1, 7,  7, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C1)");
-   FMSQ(    0, 6,  1, 7,  7, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield C1)");
-   FMSQ(    0, 6,  1, 7,  7, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield M1)");
-   FMS (    0, 6,  1, 7,  7,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C1/M1)");
-   FMSQ(    0, 6,  1, 7, 10, Me, "Intel Mobile Core 2 (Penryn E0)");
-   FMSQ(    0, 6,  1, 7, 10, Mc, "Intel Mobile Core 2 (Penryn R0)");
-   FMSQ(    0, 6,  1, 7, 10, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield E0)");
-   FMSQ(    0, 6,  1, 7, 10, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield R0)");
-   FMSQ(    0, 6,  1, 7, 10, de, "Intel Core 2 Duo (Wolfdale E0)");
-   FMSQ(    0, 6,  1, 7, 10, dc, "Intel Core 2 Duo (Wolfdale R0)");
-   FMSQ(    0, 6,  1, 7, 10, dP, "Intel Pentium Dual-Core Processor E5000/E6000 / Pentium T4000 (Wolfdale R0)");
-   FMSQ(    0, 6,  1, 7, 10, dC, "Intel Celeron E3000 / T3000 / 900 / SU2300 (Wolfdale R0)"); // T3000 & 900 names from MRG* 2018-03-06
-   FMSQ(    0, 6,  1, 7, 10, MC, "Intel Celeron M ULV 700 (Penryn R0)");
-   FMSQ(    0, 6,  1, 7, 10, se, "Intel Xeon Processor 3300 (Yorkfield E0)");
-   FMSQ(    0, 6,  1, 7, 10, sQ, "Intel Xeon Processor 3300 (Yorkfield R0)");
-   FMSQ(    0, 6,  1, 7, 10, sX, "Intel Xeon Processor 3100 (Wolfdale E0) / Xeon Processor 3300 (Yorkfield R0) / Xeon Processor 5200 (Wolfdale E0) / Xeon Processor 5400 (Harpertown E0)");
-   FMS (    0, 6,  1, 7, 10,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown E0/R0)");
-   FMQ (    0, 6,  1, 7,     se, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-   FMQ (    0, 6,  1, 7,     sQ, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-   FMQ (    0, 6,  1, 7,     sX, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)");
-   FMQ (    0, 6,  1, 7,     Mc, "Intel Mobile Core 2 (Penryn)");
-   FMQ (    0, 6,  1, 7,     Xc, "Intel Core 2 Extreme (Yorkfield)");
-   FMQ (    0, 6,  1, 7,     Qc, "Intel Core 2 Quad-Core (Yorkfield)");
-   FMQ (    0, 6,  1, 7,     dc, "Intel Core 2 Duo (Wolfdale)");
-   FMQ (    0, 6,  1, 7,     dC, "Intel Celeron (Wolfdale)");
-   FMQ (    0, 6,  1, 7,     MC, "Intel Celeron M ULV (Penryn)");
-   FMQ (    0, 6,  1, 7,     dP, "Intel Pentium (Wolfdale)");
-   FM  (    0, 6,  1, 7,         "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown)");
+   FMSQ(    0, 6,  1, 7,  6, sQ, "Intel Xeon Processor 3300 (Yorkfield C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)")
+   FMSQ(    0, 6,  1, 7,  6, sX, "Intel Xeon Processor 3100 (Wolfdale C0) / Xeon Processor 5200 (Wolfdale C0) / Xeon Processor 5400 (Harpertown C0)")
+   FMSQ(    0, 6,  1, 7,  6, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C0)")
+   FMSQ(    0, 6,  1, 7,  6, Me, "Intel Mobile Core 2 Duo (Penryn C0)")
+   FMSQ(    0, 6,  1, 7,  6, Mc, "Intel Mobile Core 2 Duo (Penryn M0)")
+   FMSQ(    0, 6,  1, 7,  6, de, "Intel Core 2 Duo (Wolfdale C0)")
+   FMSQ(    0, 6,  1, 7,  6, dc, "Intel Core 2 Duo (Wolfdale M0)")
+   FMSQ(    0, 6,  1, 7,  6, dP, "Intel Pentium Dual-Core Processor E5000 (Wolfdale M0)")
+   FMS (    0, 6,  1, 7,  6,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C0/M0)")
+   FMSQ(    0, 6,  1, 7,  7, sQ, "Intel Xeon Processor 3300 (Yorkfield C1)")
+   FMSQ(    0, 6,  1, 7,  7, Xc, "Intel Core 2 Extreme QX9000 (Yorkfield C1)")
+   FMSQ(    0, 6,  1, 7,  7, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield C1)")
+   FMSQ(    0, 6,  1, 7,  7, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield M1)")
+   FMS (    0, 6,  1, 7,  7,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown C1/M1)")
+   FMSQ(    0, 6,  1, 7, 10, Me, "Intel Mobile Core 2 (Penryn E0)")
+   FMSQ(    0, 6,  1, 7, 10, Mc, "Intel Mobile Core 2 (Penryn R0)")
+   FMSQ(    0, 6,  1, 7, 10, Qe, "Intel Core 2 Quad-Core Q9000 (Yorkfield E0)")
+   FMSQ(    0, 6,  1, 7, 10, Qc, "Intel Core 2 Quad-Core Q9000 (Yorkfield R0)")
+   FMSQ(    0, 6,  1, 7, 10, de, "Intel Core 2 Duo (Wolfdale E0)")
+   FMSQ(    0, 6,  1, 7, 10, dc, "Intel Core 2 Duo (Wolfdale R0)")
+   FMSQ(    0, 6,  1, 7, 10, dP, "Intel Pentium Dual-Core Processor E5000/E6000 / Pentium T4000 (Wolfdale R0)")
+   FMSQ(    0, 6,  1, 7, 10, dC, "Intel Celeron E3000 / T3000 / 900 / SU2300 (Wolfdale R0)") // T3000 & 900 names from MRG* 2018-03-06
+   FMSQ(    0, 6,  1, 7, 10, MC, "Intel Celeron M ULV 700 (Penryn R0)")
+   FMSQ(    0, 6,  1, 7, 10, se, "Intel Xeon Processor 3300 (Yorkfield E0)")
+   FMSQ(    0, 6,  1, 7, 10, sQ, "Intel Xeon Processor 3300 (Yorkfield R0)")
+   FMSQ(    0, 6,  1, 7, 10, sX, "Intel Xeon Processor 3100 (Wolfdale E0) / Xeon Processor 3300 (Yorkfield R0) / Xeon Processor 5200 (Wolfdale E0) / Xeon Processor 5400 (Harpertown E0)")
+   FMS (    0, 6,  1, 7, 10,     "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown E0/R0)")
+   FMQ (    0, 6,  1, 7,     se, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)")
+   FMQ (    0, 6,  1, 7,     sQ, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)")
+   FMQ (    0, 6,  1, 7,     sX, "Intel Xeon (Wolfdale / Yorkfield / Harpertown)")
+   FMQ (    0, 6,  1, 7,     Mc, "Intel Mobile Core 2 (Penryn)")
+   FMQ (    0, 6,  1, 7,     Xc, "Intel Core 2 Extreme (Yorkfield)")
+   FMQ (    0, 6,  1, 7,     Qc, "Intel Core 2 Quad-Core (Yorkfield)")
+   FMQ (    0, 6,  1, 7,     dc, "Intel Core 2 Duo (Wolfdale)")
+   FMQ (    0, 6,  1, 7,     dC, "Intel Celeron (Wolfdale)")
+   FMQ (    0, 6,  1, 7,     MC, "Intel Celeron M ULV (Penryn)")
+   FMQ (    0, 6,  1, 7,     dP, "Intel Pentium (Wolfdale)")
+   FM  (    0, 6,  1, 7,         "Intel Core 2 (unknown type) (Penryn/Wolfdale/Yorkfield/Harpertown)")
    // Intel docs (320836, 321324, 321333).
-   FMS (    0, 6,  1,10,  4,     "Intel Core i7-900 (Bloomfield C0)");
-   FMSQ(    0, 6,  1,10,  5, dc, "Intel Core i7-900 (Bloomfield D0)");
-   FMSQ(    0, 6,  1,10,  5, sX, "Intel Xeon Processor 3500 (Bloomfield D0) / Xeon Processor 5500 (Gainestown D0)");
-   FMS (    0, 6,  1,10,  5,     "Intel Core (unknown type) (Bloomfield/Gainestown D0)");
-   FMQ (    0, 6,  1,10,     dc, "Intel Core (Bloomfield)");
-   FMQ (    0, 6,  1,10,     sX, "Intel Xeon (Bloomfield / Gainestown)");
-   FM  (    0, 6,  1,10,         "Intel Core (unknown type) (Bloomfield / Gainestown)");
+   FMS (    0, 6,  1,10,  4,     "Intel Core i7-900 (Bloomfield C0)")
+   FMSQ(    0, 6,  1,10,  5, dc, "Intel Core i7-900 (Bloomfield D0)")
+   FMSQ(    0, 6,  1,10,  5, sX, "Intel Xeon Processor 3500 (Bloomfield D0) / Xeon Processor 5500 (Gainestown D0)")
+   FMS (    0, 6,  1,10,  5,     "Intel Core (unknown type) (Bloomfield/Gainestown D0)")
+   FMQ (    0, 6,  1,10,     dc, "Intel Core (Bloomfield)")
+   FMQ (    0, 6,  1,10,     sX, "Intel Xeon (Bloomfield / Gainestown)")
+   FM  (    0, 6,  1,10,         "Intel Core (unknown type) (Bloomfield / Gainestown)")
    // Intel docs (319536, 319974, 320047, 320529, 322861, 322862, 322849,
    // 324341).
-   FMS (    0, 6,  1,12,  1,     "Intel Atom N270 (Diamondville B0)");
-   FMS (    0, 6,  1,12,  2,     "Intel Atom 200/N200/300 (Diamondville C0) / Atom Z500 (Silverthorne C0)");
-   FMS (    0, 6,  1,12, 10,     "Intel Atom D400/N400 (Pineview A0) / Atom D500/N500 (Pineview B0)");
-   FM  (    0, 6,  1,12,         "Intel Atom (Diamondville / Silverthorne / Pineview)");
+   FMS (    0, 6,  1,12,  1,     "Intel Atom N270 (Diamondville B0)")
+   FMS (    0, 6,  1,12,  2,     "Intel Atom 200/N200/300 (Diamondville C0) / Atom Z500 (Silverthorne C0)")
+   FMS (    0, 6,  1,12, 10,     "Intel Atom D400/N400 (Pineview A0) / Atom D500/N500 (Pineview B0)")
+   FM  (    0, 6,  1,12,         "Intel Atom (Diamondville / Silverthorne / Pineview)")
    // Intel docs (320336).
-   FMS (    0, 6,  1,13,  1,     "Intel Xeon Processor 7400 (Dunnington A1)");
-   FM  (    0, 6,  1,13,         "Intel Xeon (unknown type) (Dunnington)");
+   FMS (    0, 6,  1,13,  1,     "Intel Xeon Processor 7400 (Dunnington A1)")
+   FM  (    0, 6,  1,13,         "Intel Xeon (unknown type) (Dunnington)")
    // Intel docs (320767, 322166, 322373, 323105).
-   FMSQ(    0, 6,  1,14,  4, sX, "Intel Xeon Processor EC3500/EC5500 (Jasper Forest B0)"); // EC names from MRG* 2018-03-06
-   FMSQ(    0, 6,  1,14,  4, dC, "Intel Celeron P1053 (Jasper Forest B0)");
-   FMS (    0, 6,  1,14,  4,     "Intel Xeon (unknown type) (Jasper Forest B0)");
-   FMSQ(    0, 6,  1,14,  5, sX, "Intel Xeon Processor 3400 (Lynnfield B1)");
-   FMSQ(    0, 6,  1,14,  5, Mc, "Intel Core i7-700/800/900 Mobile (Clarksfield B1)");
-   FMSQ(    0, 6,  1,14,  5, dc, "Intel Core i*-700/800/900 (Lynnfield B1)"); // 900 from MRG* 2018-03-06
-   FMS (    0, 6,  1,14,  5,     "Intel Core (unknown type) (Lynnfield/Clarksfield B1)");
-   FMQ (    0, 6,  1,14,     sX, "Intel Xeon (Lynnfield) / Xeon (Jasper Forest)");
-   FMQ (    0, 6,  1,14,     dC, "Intel Celeron (Jasper Forest)");
-   FMQ (    0, 6,  1,14,     Mc, "Intel Core Mobile (Clarksfield)");
-   FMQ (    0, 6,  1,14,     dc, "Intel Core (Lynnfield)");
-   FM  (    0, 6,  1,14,         "Intel Core (unknown type) (Lynnfield/Clarksfield)");
-   FM  (    0, 6,  1,15,         "Intel (unknown model) (Havendale/Auburndale)");
+   FMSQ(    0, 6,  1,14,  4, sX, "Intel Xeon Processor EC3500/EC5500 (Jasper Forest B0)") // EC names from MRG* 2018-03-06
+   FMSQ(    0, 6,  1,14,  4, dC, "Intel Celeron P1053 (Jasper Forest B0)")
+   FMS (    0, 6,  1,14,  4,     "Intel Xeon (unknown type) (Jasper Forest B0)")
+   FMSQ(    0, 6,  1,14,  5, sX, "Intel Xeon Processor 3400 (Lynnfield B1)")
+   FMSQ(    0, 6,  1,14,  5, Mc, "Intel Core i7-700/800/900 Mobile (Clarksfield B1)")
+   FMSQ(    0, 6,  1,14,  5, dc, "Intel Core i*-700/800/900 (Lynnfield B1)") // 900 from MRG* 2018-03-06
+   FMS (    0, 6,  1,14,  5,     "Intel Core (unknown type) (Lynnfield/Clarksfield B1)")
+   FMQ (    0, 6,  1,14,     sX, "Intel Xeon (Lynnfield) / Xeon (Jasper Forest)")
+   FMQ (    0, 6,  1,14,     dC, "Intel Celeron (Jasper Forest)")
+   FMQ (    0, 6,  1,14,     Mc, "Intel Core Mobile (Clarksfield)")
+   FMQ (    0, 6,  1,14,     dc, "Intel Core (Lynnfield)")
+   FM  (    0, 6,  1,14,         "Intel Core (unknown type) (Lynnfield/Clarksfield)")
+   FM  (    0, 6,  1,15,         "Intel (unknown model) (Havendale/Auburndale)")
    // Intel docs (322814, 322911, 323179, 323847, 323056, 324456).
-   FMSQ(    0, 6,  2, 5,  2, sX, "Intel Xeon Processor L3406 (Clarkdale C2)");
-   FMSQ(    0, 6,  2, 5,  2, MC, "Intel Celeron Mobile P4500 (Arrandale C2)");
-   FMSQ(    0, 6,  2, 5,  2, MP, "Intel Pentium P6000 Mobile (Arrandale C2)");
-   FMSQ(    0, 6,  2, 5,  2, dP, "Intel Pentium G6900 / P4500 (Clarkdale C2)");
-   FMSQ(    0, 6,  2, 5,  2, Mc, "Intel Core i*-300/400/500/600 Mobile (Arrandale C2)");
-   FMSQ(    0, 6,  2, 5,  2, dc, "Intel Core i*-300/500/600 (Clarkdale C2)");
-   FMS (    0, 6,  2, 5,  2,     "Intel Core (unknown type) (Clarkdale/Arrandale C2)");
-   FMSQ(    0, 6,  2, 5,  5, MC, "Intel Celeron Mobile U3400 (Arrandale K0) / Celeron Mobile P4600 (Arrandale K0)");
-   FMSQ(    0, 6,  2, 5,  5, MP, "Intel Pentium U5000 Mobile (Arrandale K0)");
-   FMSQ(    0, 6,  2, 5,  5, dP, "Intel Pentium P4500 / U3400 / G6900 (Clarkdale K0)"); // G6900 only from MRG* 2018-03-06
-   FMSQ(    0, 6,  2, 5,  5, dc, "Intel Core i*-300/400/500/600 (Clarkdale K0)");
-   FMS (    0, 6,  2, 5,  5,     "Intel Core (unknown type) (Clarkdale/Arrandale K0)");
-   FMQ (    0, 6,  2, 5,     sX, "Intel Xeon Processor L3406 (Clarkdale)");
-   FMQ (    0, 6,  2, 5,     MC, "Intel Celeron Mobile (Arrandale)");
-   FMQ (    0, 6,  2, 5,     MP, "Intel Pentium Mobile (Arrandale)");
-   FMQ (    0, 6,  2, 5,     dP, "Intel Pentium (Clarkdale)");
-   FMQ (    0, 6,  2, 5,     Mc, "Intel Core Mobile (Arrandale)");
-   FMQ (    0, 6,  2, 5,     dc, "Intel Core (Clarkdale)");
-   FM  (    0, 6,  2, 5,         "Intel Core (unknown type) (Clarkdale/Arrandale)");
+   FMSQ(    0, 6,  2, 5,  2, sX, "Intel Xeon Processor L3406 (Clarkdale C2)")
+   FMSQ(    0, 6,  2, 5,  2, MC, "Intel Celeron Mobile P4500 (Arrandale C2)")
+   FMSQ(    0, 6,  2, 5,  2, MP, "Intel Pentium P6000 Mobile (Arrandale C2)")
+   FMSQ(    0, 6,  2, 5,  2, dP, "Intel Pentium G6900 / P4500 (Clarkdale C2)")
+   FMSQ(    0, 6,  2, 5,  2, Mc, "Intel Core i*-300/400/500/600 Mobile (Arrandale C2)")
+   FMSQ(    0, 6,  2, 5,  2, dc, "Intel Core i*-300/500/600 (Clarkdale C2)")
+   FMS (    0, 6,  2, 5,  2,     "Intel Core (unknown type) (Clarkdale/Arrandale C2)")
+   FMSQ(    0, 6,  2, 5,  5, MC, "Intel Celeron Mobile U3400 (Arrandale K0) / Celeron Mobile P4600 (Arrandale K0)")
+   FMSQ(    0, 6,  2, 5,  5, MP, "Intel Pentium U5000 Mobile (Arrandale K0)")
+   FMSQ(    0, 6,  2, 5,  5, dP, "Intel Pentium P4500 / U3400 / G6900 (Clarkdale K0)") // G6900 only from MRG* 2018-03-06
+   FMSQ(    0, 6,  2, 5,  5, dc, "Intel Core i*-300/400/500/600 (Clarkdale K0)")
+   FMS (    0, 6,  2, 5,  5,     "Intel Core (unknown type) (Clarkdale/Arrandale K0)")
+   FMQ (    0, 6,  2, 5,     sX, "Intel Xeon Processor L3406 (Clarkdale)")
+   FMQ (    0, 6,  2, 5,     MC, "Intel Celeron Mobile (Arrandale)")
+   FMQ (    0, 6,  2, 5,     MP, "Intel Pentium Mobile (Arrandale)")
+   FMQ (    0, 6,  2, 5,     dP, "Intel Pentium (Clarkdale)")
+   FMQ (    0, 6,  2, 5,     Mc, "Intel Core Mobile (Arrandale)")
+   FMQ (    0, 6,  2, 5,     dc, "Intel Core (Clarkdale)")
+   FM  (    0, 6,  2, 5,         "Intel Core (unknown type) (Clarkdale/Arrandale)")
    // Intel docs (324209, 325307, 325309, 325630).
-   FMS (    0, 6,  2, 6,  1,     "Intel Atom Z600 (Lincroft C0) / Atom E600 (Tunnel Creek B0/B1)");
-   FM  (    0, 6,  2, 6,         "Intel Atom Z600 (Lincroft) / Atom E600 (Tunnel Creek B0/B1)");
-   FM  (    0, 6,  2, 7,         "Intel Atom Z2000 (Medfield)"); // no spec update, only instlatx64 example (stepping 1)
+   FMS (    0, 6,  2, 6,  1,     "Intel Atom Z600 (Lincroft C0) / Atom E600 (Tunnel Creek B0/B1)")
+   FM  (    0, 6,  2, 6,         "Intel Atom Z600 (Lincroft) / Atom E600 (Tunnel Creek B0/B1)")
+   FM  (    0, 6,  2, 7,         "Intel Atom Z2000 (Medfield)") // no spec update, only instlatx64 example (stepping 1)
    // Intel docs (327335) omit stepping numbers, but (324643, 324827, 324972)
    // provide some.  An instlatx64 stepping 6 example has been spoted, but it
    // isn't known which stepping name that is.
-   FMSQ(    0, 6,  2,10,  7, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge D2/J1/Q0)");
-   FMSQ(    0, 6,  2,10,  7, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge D2/J1/Q0)");
-   FMSQ(    0, 6,  2,10,  7, dc, "Intel Core i*-2000 (Sandy Bridge D2/J1/Q0)");
-   FMSQ(    0, 6,  2,10,  7, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge J1/Q0)");
-   FMSQ(    0, 6,  2,10,  7, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge D2/J1/Q0)");
-   FMSQ(    0, 6,  2,10,  7, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge Q0)");
-   FMS (    0, 6,  2,10,  7,     "Intel Core (unknown type) (Sandy Bridge D2/J1/Q0)");
-   FMQ (    0, 6,  2,10,     Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge)");
-   FMQ (    0, 6,  2,10,     Mc, "Intel Mobile Core i*-2000 (Sandy Bridge)");
-   FMQ (    0, 6,  2,10,     dc, "Intel Core i*-2000 (Sandy Bridge)");
-   FMQ (    0, 6,  2,10,     MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge)");
-   FMQ (    0, 6,  2,10,     sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge)");
-   FMQ (    0, 6,  2,10,     dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge)");
-   FM  (    0, 6,  2,10,         "Intel Core (unknown type) (Sandy Bridge)");
+   FMSQ(    0, 6,  2,10,  7, Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge D2/J1/Q0)")
+   FMSQ(    0, 6,  2,10,  7, Mc, "Intel Mobile Core i*-2000 (Sandy Bridge D2/J1/Q0)")
+   FMSQ(    0, 6,  2,10,  7, dc, "Intel Core i*-2000 (Sandy Bridge D2/J1/Q0)")
+   FMSQ(    0, 6,  2,10,  7, MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge J1/Q0)")
+   FMSQ(    0, 6,  2,10,  7, sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge D2/J1/Q0)")
+   FMSQ(    0, 6,  2,10,  7, dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge Q0)")
+   FMS (    0, 6,  2,10,  7,     "Intel Core (unknown type) (Sandy Bridge D2/J1/Q0)")
+   FMQ (    0, 6,  2,10,     Xc, "Intel Mobile Core i7 Extreme (Sandy Bridge)")
+   FMQ (    0, 6,  2,10,     Mc, "Intel Mobile Core i*-2000 (Sandy Bridge)")
+   FMQ (    0, 6,  2,10,     dc, "Intel Core i*-2000 (Sandy Bridge)")
+   FMQ (    0, 6,  2,10,     MC, "Intel Celeron G400/G500/700/800/B800 (Sandy Bridge)")
+   FMQ (    0, 6,  2,10,     sX, "Intel Xeon E3-1100 / E3-1200 v1 (Sandy Bridge)")
+   FMQ (    0, 6,  2,10,     dP, "Intel Pentium G500/G600/G800 / Pentium 900 (Sandy Bridge)")
+   FM  (    0, 6,  2,10,         "Intel Core (unknown type) (Sandy Bridge)")
    // Intel docs (323254: i7-900, 323338: Xeon 3600, 323372: Xeon 5600).
    // https://en.wikipedia.org/wiki/Westmere_(microarchitecture) provided
    // A0 & B0 stepping values.
-   FMSQ(    0, 6,  2,12,  0, dc, "Intel Core i7-900 / Core i7-980X (Gulftown A0)");
-   FMSQ(    0, 6,  2,12,  0, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP A0)");
-   FMS (    0, 6,  2,12,  0,     "Intel Core (unknown type) (Gulftown/Westmere-EP A0)");
-   FMSQ(    0, 6,  2,12,  1, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B0)");
-   FMSQ(    0, 6,  2,12,  1, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B0)");
-   FMS (    0, 6,  2,12,  1,     "Intel Core (unknown type) (Gulftown/Westmere-EP B0)");
-   FMSQ(    0, 6,  2,12,  2, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B1)");
-   FMSQ(    0, 6,  2,12,  2, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B1)");
-   FMS (    0, 6,  2,12,  2,     "Intel Core (unknown type) (Gulftown/Westmere-EP B1)");
-   FMQ (    0, 6,  2,12,     dc, "Intel Core (unknown type) (Gulftown)");
-   FMQ (    0, 6,  2,12,     sX, "Intel Xeon (unknown type) (Westmere-EP)");
-   FM  (    0, 6,  2,12,         "Intel (unknown type) (Gulftown/Westmere-EP)");
+   FMSQ(    0, 6,  2,12,  0, dc, "Intel Core i7-900 / Core i7-980X (Gulftown A0)")
+   FMSQ(    0, 6,  2,12,  0, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP A0)")
+   FMS (    0, 6,  2,12,  0,     "Intel Core (unknown type) (Gulftown/Westmere-EP A0)")
+   FMSQ(    0, 6,  2,12,  1, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B0)")
+   FMSQ(    0, 6,  2,12,  1, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B0)")
+   FMS (    0, 6,  2,12,  1,     "Intel Core (unknown type) (Gulftown/Westmere-EP B0)")
+   FMSQ(    0, 6,  2,12,  2, dc, "Intel Core i7-900 / Core i7-980X (Gulftown B1)")
+   FMSQ(    0, 6,  2,12,  2, sX, "Intel Xeon Processor 3600 / 5600 (Westmere-EP B1)")
+   FMS (    0, 6,  2,12,  2,     "Intel Core (unknown type) (Gulftown/Westmere-EP B1)")
+   FMQ (    0, 6,  2,12,     dc, "Intel Core (unknown type) (Gulftown)")
+   FMQ (    0, 6,  2,12,     sX, "Intel Xeon (unknown type) (Westmere-EP)")
+   FM  (    0, 6,  2,12,         "Intel (unknown type) (Gulftown/Westmere-EP)")
    // Intel docs (326198, 326510).
-   FMSQ(    0, 6,  2,13,  6, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E C1/M0)");
-   FMSQ(    0, 6,  2,13,  6, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C1)");
-   FMS (    0, 6,  2,13,  6,     "Intel Core (unknown type) (Sandy Bridge-E C1)");
-   FMSQ(    0, 6,  2,13,  7, sX, "Intel Xeon E5-1600/2600/4600 (Sandy Bridge-E C2/M1)");
-   FMSQ(    0, 6,  2,13,  7, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C2)");
-   FMSQ(    0, 6,  2,13,  7, dP, "Intel Pentium 1405 (Sandy Bridge-E C1)"); // MRG* 2018-03-06
-   FMS (    0, 6,  2,13,  7,     "Intel Core (unknown type) (Sandy Bridge-E C2/M1)");
-   FMQ (    0, 6,  2,13,     sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E)");
-   FMQ (    0, 6,  2,13,     dc, "Intel Core i7-3800/3900 (Sandy Bridge-E)");
-   FMQ (    0, 6,  2,13,     dP, "Intel Pentium 1405 (Sandy Bridge-E)"); // MRG* 2018-03-06
-   FM  (    0, 6,  2,13,         "Intel Core (unknown type) (Sandy Bridge-E)");
+   FMSQ(    0, 6,  2,13,  6, sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E C1/M0)")
+   FMSQ(    0, 6,  2,13,  6, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C1)")
+   FMS (    0, 6,  2,13,  6,     "Intel Core (unknown type) (Sandy Bridge-E C1)")
+   FMSQ(    0, 6,  2,13,  7, sX, "Intel Xeon E5-1600/2600/4600 (Sandy Bridge-E C2/M1)")
+   FMSQ(    0, 6,  2,13,  7, dc, "Intel Core i7-3800/3900 (Sandy Bridge-E C2)")
+   FMSQ(    0, 6,  2,13,  7, dP, "Intel Pentium 1405 (Sandy Bridge-E C1)") // MRG* 2018-03-06
+   FMS (    0, 6,  2,13,  7,     "Intel Core (unknown type) (Sandy Bridge-E C2/M1)")
+   FMQ (    0, 6,  2,13,     sX, "Intel Xeon E5-1600/2600 (Sandy Bridge-E)")
+   FMQ (    0, 6,  2,13,     dc, "Intel Core i7-3800/3900 (Sandy Bridge-E)")
+   FMQ (    0, 6,  2,13,     dP, "Intel Pentium 1405 (Sandy Bridge-E)") // MRG* 2018-03-06
+   FM  (    0, 6,  2,13,         "Intel Core (unknown type) (Sandy Bridge-E)")
    // Intel docs (323344) are inconsistent.  Using Table 2 information.
    // instlatx64 samples have steppings 4 & 5, but no idea which stepping names
    // those are.
-   FMS (    0, 6,  2,14,  6,     "Intel Xeon Processor 6500 / 7500 (Beckton D0)");
-   FM  (    0, 6,  2,14,         "Intel Xeon Processor 6500 / 7500 (Beckton)");
+   FMS (    0, 6,  2,14,  6,     "Intel Xeon Processor 6500 / 7500 (Beckton D0)")
+   FM  (    0, 6,  2,14,         "Intel Xeon Processor 6500 / 7500 (Beckton)")
    // Intel docs (325122).
-   FMS (    0, 6,  2,15,  2,     "Intel Xeon E7-8800 / Xeon E7-4800 / Xeon E7-2800 (Westmere-EX A2)");
-   FM  (    0, 6,  2,15,         "Intel Xeon (unknown type) (Westmere-EX)");
+   FMS (    0, 6,  2,15,  2,     "Intel Xeon E7-8800 / Xeon E7-4800 / Xeon E7-2800 (Westmere-EX A2)")
+   FM  (    0, 6,  2,15,         "Intel Xeon (unknown type) (Westmere-EX)")
    // Intel docs (332067) omit stepping numbers for D1, but (328105) provide
    // some.
-   FMS (    0, 6,  3, 5,  1,     "Intel Atom Z2760 (Clover Trail C0) / Z8000 (Cherry Trail C0)");
-   FM  (    0, 6,  3, 5,         "Intel Atom Z2760 (Clover Trail) / Z8000 (Cherry Trail)");
+   FMS (    0, 6,  3, 5,  1,     "Intel Atom Z2760 (Clover Trail C0) / Z8000 (Cherry Trail C0)")
+   FM  (    0, 6,  3, 5,         "Intel Atom Z2760 (Clover Trail) / Z8000 (Cherry Trail)")
    // Intel docs (326140) for Cedarview
    // Intel docs (328198) do not provide any FMS for Centerton, but an example
    // from jhladky@redhat.com does.
    // instlatx64 has example with stepping 9, but no idea what stepping name
    // that is.
-   FMS (    0, 6,  3, 6,  1,     "Intel Atom D2000/N2000 (Cedarview B1/B2/B3) / S1200 (Centerton B1)");
-   FM  (    0, 6,  3, 6,         "Intel Atom D2000/N2000 (Cedarview) / S1200 (Centerton)");
+   FMS (    0, 6,  3, 6,  1,     "Intel Atom D2000/N2000 (Cedarview B1/B2/B3) / S1200 (Centerton B1)")
+   FM  (    0, 6,  3, 6,         "Intel Atom D2000/N2000 (Cedarview) / S1200 (Centerton)")
    // Intel docs (329475, 329671, 329901, 600827).
-   FMS (    0, 6,  3, 7,  1,     "Intel Atom Z3000 (Bay Trail-T A0)");
-   FMSQ(    0, 6,  3, 7,  2, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M B0/B1)");
-   FMSQ(    0, 6,  3, 7,  2, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B0/B1)");
-   FMS (    0, 6,  3, 7,  2,     "Intel Atom (unknown type) (Bay Trail-M B0/B1)");
-   FMSQ(    0, 6,  3, 7,  3, dC, "Intel Celeron N1700 / N1800 / N2800 / N2900 / J1700 / J1800 / J1900 (Bay Trail-M B2/B3)");
-   FMSQ(    0, 6,  3, 7,  3, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B2/B3) / Atom E3800 (Bay Trail-I B3)");
-   FMSQ(    0, 6,  3, 7,  3, da, "Intel Atom E3800 / Z3700 (Bay Trail-I B3)"); // Z3700 only from MRG* 2019-08-31
-   FMS (    0, 6,  3, 7,  3,     "Intel Atom (unknown type) (Bay Trail B2/B3)");
-   FMSQ(    0, 6,  3, 7,  4, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M C0)");
-   FMSQ(    0, 6,  3, 7,  4, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M C0)");
-   FMS (    0, 6,  3, 7,  4,     "Intel Atom (unknown type) (Bay Trail-M C0 / Bay Trail-T B2/B3)");
-   FMSQ(    0, 6,  3, 7,  8, da, "Intel Atom Z3700 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-   FMSQ(    0, 6,  3, 7,  8, dC, "Intel Celeron N2800 / N2900 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-   FMSQ(    0, 6,  3, 7,  8, dP, "Intel Pentium N3500 (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-   FMS (    0, 6,  3, 7,  8,     "Intel Atom (unknown type) (Bay Trail)"); // only MRG* 2019-08-31 (unknown stepping name)
-   FMSQ(    0, 6,  3, 7,  9, da, "Intel Atom E3800 (Bay Trail-I D0)");
-   FMSQ(    0, 6,  3, 7,  9, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M/D D0/D1)"); // only MRG* 2018-03-06
-   FMSQ(    0, 6,  3, 7,  9, dP, "Intel Pentium J1800 / J1900 (Bay Trail-M/D D0/D1)"); // only MRG* 2018-03-06
-   FMS (    0, 6,  3, 7,  9,     "Intel Atom (unknown type) (Bay Trail D0)");
-   FM  (    0, 6,  3, 7,         "Intel Atom (unknown type) (Bay Trail-M / Bay Trail-T / Bay Trail-I)");
+   FMS (    0, 6,  3, 7,  1,     "Intel Atom Z3000 (Bay Trail-T A0)")
+   FMSQ(    0, 6,  3, 7,  2, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M B0/B1)")
+   FMSQ(    0, 6,  3, 7,  2, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B0/B1)")
+   FMS (    0, 6,  3, 7,  2,     "Intel Atom (unknown type) (Bay Trail-M B0/B1)")
+   FMSQ(    0, 6,  3, 7,  3, dC, "Intel Celeron N1700 / N1800 / N2800 / N2900 / J1700 / J1800 / J1900 (Bay Trail-M B2/B3)")
+   FMSQ(    0, 6,  3, 7,  3, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M B2/B3) / Atom E3800 (Bay Trail-I B3)")
+   FMSQ(    0, 6,  3, 7,  3, da, "Intel Atom E3800 / Z3700 (Bay Trail-I B3)") // Z3700 only from MRG* 2019-08-31
+   FMS (    0, 6,  3, 7,  3,     "Intel Atom (unknown type) (Bay Trail B2/B3)")
+   FMSQ(    0, 6,  3, 7,  4, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M C0)")
+   FMSQ(    0, 6,  3, 7,  4, dP, "Intel Pentium N3500 / J2800 / J2900 (Bay Trail-M C0)")
+   FMS (    0, 6,  3, 7,  4,     "Intel Atom (unknown type) (Bay Trail-M C0 / Bay Trail-T B2/B3)")
+   FMSQ(    0, 6,  3, 7,  8, da, "Intel Atom Z3700 (Bay Trail)") // only MRG* 2019-08-31 (unknown stepping name)
+   FMSQ(    0, 6,  3, 7,  8, dC, "Intel Celeron N2800 / N2900 (Bay Trail)") // only MRG* 2019-08-31 (unknown stepping name)
+   FMSQ(    0, 6,  3, 7,  8, dP, "Intel Pentium N3500 (Bay Trail)") // only MRG* 2019-08-31 (unknown stepping name)
+   FMS (    0, 6,  3, 7,  8,     "Intel Atom (unknown type) (Bay Trail)") // only MRG* 2019-08-31 (unknown stepping name)
+   FMSQ(    0, 6,  3, 7,  9, da, "Intel Atom E3800 (Bay Trail-I D0)")
+   FMSQ(    0, 6,  3, 7,  9, dC, "Intel Celeron N2800 / N2900 (Bay Trail-M/D D0/D1)") // only MRG* 2018-03-06
+   FMSQ(    0, 6,  3, 7,  9, dP, "Intel Pentium J1800 / J1900 (Bay Trail-M/D D0/D1)") // only MRG* 2018-03-06
+   FMS (    0, 6,  3, 7,  9,     "Intel Atom (unknown type) (Bay Trail D0)")
+   FM  (    0, 6,  3, 7,         "Intel Atom (unknown type) (Bay Trail-M / Bay Trail-T / Bay Trail-I)")
    // Intel docs (326766, 326770, 326774, 329376).
    // How to differentiate Gladden from Ivy Bridge here?
-   FMSQ(    0, 6,  3,10,  9, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge E1/L1) / Pentium 900/1000/2000/2100 (P0)");
-   FMSQ(    0, 6,  3,10,  9, dc, "Intel Core i*-3000 (Ivy Bridge E1/N0/L1)");
-   FMSQ(    0, 6,  3,10,  9, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge E1/N0/L1)");
-   FMSQ(    0, 6,  3,10,  9, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge P0)"); // only MRG 2019-08-31
-   FMSQ(    0, 6,  3,10,  9, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge P0)");
-   FMS (    0, 6,  3,10,  9,     "Intel Core (unknown type) (Ivy Bridge E1/N0/L1/P0)");
-   FMQ (    0, 6,  3,10,     Mc, "Intel Mobile Core i*-3000 (Ivy Bridge) / Pentium 900/1000/2000/2100");
-   FMQ (    0, 6,  3,10,     dc, "Intel Core i*-3000 (Ivy Bridge)");
-   FMQ (    0, 6,  3,10,     sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge)");
-   FMQ (    0, 6,  3,10,     dC, "Intel Celeron 1000 / G1600 (Ivy Bridge)"); // only MRG 2019-08-31
-   FMQ (    0, 6,  3,10,     dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge)");
-   FM  (    0, 6,  3,10,         "Intel Core (unknown type) (Ivy Bridge)");
+   FMSQ(    0, 6,  3,10,  9, Mc, "Intel Mobile Core i*-3000 (Ivy Bridge E1/L1) / Pentium 900/1000/2000/2100 (P0)")
+   FMSQ(    0, 6,  3,10,  9, dc, "Intel Core i*-3000 (Ivy Bridge E1/N0/L1)")
+   FMSQ(    0, 6,  3,10,  9, sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge E1/N0/L1)")
+   FMSQ(    0, 6,  3,10,  9, dC, "Intel Celeron 1000 / G1600 (Ivy Bridge P0)") // only MRG 2019-08-31
+   FMSQ(    0, 6,  3,10,  9, dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge P0)")
+   FMS (    0, 6,  3,10,  9,     "Intel Core (unknown type) (Ivy Bridge E1/N0/L1/P0)")
+   FMQ (    0, 6,  3,10,     Mc, "Intel Mobile Core i*-3000 (Ivy Bridge) / Pentium 900/1000/2000/2100")
+   FMQ (    0, 6,  3,10,     dc, "Intel Core i*-3000 (Ivy Bridge)")
+   FMQ (    0, 6,  3,10,     sX, "Intel Xeon E3-1100 v2 / E3-1200 v2 (Ivy Bridge)")
+   FMQ (    0, 6,  3,10,     dC, "Intel Celeron 1000 / G1600 (Ivy Bridge)") // only MRG 2019-08-31
+   FMQ (    0, 6,  3,10,     dP, "Intel Pentium G1600/G2000/G2100 / Pentium B900C (Ivy Bridge)")
+   FM  (    0, 6,  3,10,         "Intel Core (unknown type) (Ivy Bridge)")
    // Intel docs (328899, 328903, 328908) omit the stepping numbers for (0,6),(3,12) C0 & D0.
    // MRG* 2018-03-06 mentions (0,6),(3,12),3, but doesn't specify which stepping name it is.
    // Coreboot* identifies the steppings.
-   FMSQ(    0, 6,  3,12,  1, sX, "Intel Xeon E3-1200 v3 (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  1, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  1, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  1, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  1, dC, "Intel Celeron G1800 / G2000 (Haswell A0)"); // G2000 only from MRG* 2019-08-31
-   FMSQ(    0, 6,  3,12,  1, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  1, dP, "Intel Pentium G3000 (Haswell A0)");
-   FMS (    0, 6,  3,12,  1,     "Intel Core (unknown type) (Haswell A0)");
-   FMSQ(    0, 6,  3,12,  2, sX, "Intel Xeon E3-1200 v3 (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  2, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  2, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  2, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  2, dC, "Intel Celeron G1800 / G2000 (Haswell B0)"); // G2000 only from MRG* 2019-08-31
-   FMSQ(    0, 6,  3,12,  2, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  2, dP, "Intel Pentium G3000 (Haswell B0)");
-   FMS (    0, 6,  3,12,  2,     "Intel Core (unknown type) (Haswell B0)");
-   FMSQ(    0, 6,  3,12,  3, sX, "Intel Xeon E3-1200 v3 (Haswell C0)");
-   FMSQ(    0, 6,  3,12,  3, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell C0)");
-   FMSQ(    0, 6,  3,12,  3, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell C0)");
-   FMSQ(    0, 6,  3,12,  3, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell C0)");
-   FMSQ(    0, 6,  3,12,  3, dC, "Intel Celeron G1800 / G2000 (Haswell C0)"); // G2000 only from MRG* 2019-08-31
-   FMSQ(    0, 6,  3,12,  3, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell C0)");
-   FMSQ(    0, 6,  3,12,  3, dP, "Intel Pentium G3000 (Haswell C0)");
-   FMS (    0, 6,  3,12,  3,     "Intel Core (unknown type) (Haswell C0)");
-   FMQ (    0, 6,  3,12,     sX, "Intel Xeon E3-1200 v3 (Haswell)");
-   FMQ (    0, 6,  3,12,     Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell)");
-   FMQ (    0, 6,  3,12,     dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell)");
-   FMQ (    0, 6,  3,12,     MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell)");
-   FMQ (    0, 6,  3,12,     dC, "Intel Celeron G1800 / G2000 (Haswell)"); // G2000 only from MRG* 2019-08-31
-   FMQ (    0, 6,  3,12,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell)");
-   FMQ (    0, 6,  3,12,     dP, "Intel Pentium G3000 (Haswell)");
-   FM  (    0, 6,  3,12,         "Intel Core (unknown type) (Haswell)");
+   FMSQ(    0, 6,  3,12,  1, sX, "Intel Xeon E3-1200 v3 (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  1, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  1, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  1, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  1, dC, "Intel Celeron G1800 / G2000 (Haswell A0)") // G2000 only from MRG* 2019-08-31
+   FMSQ(    0, 6,  3,12,  1, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  1, dP, "Intel Pentium G3000 (Haswell A0)")
+   FMS (    0, 6,  3,12,  1,     "Intel Core (unknown type) (Haswell A0)")
+   FMSQ(    0, 6,  3,12,  2, sX, "Intel Xeon E3-1200 v3 (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  2, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  2, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  2, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  2, dC, "Intel Celeron G1800 / G2000 (Haswell B0)") // G2000 only from MRG* 2019-08-31
+   FMSQ(    0, 6,  3,12,  2, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  2, dP, "Intel Pentium G3000 (Haswell B0)")
+   FMS (    0, 6,  3,12,  2,     "Intel Core (unknown type) (Haswell B0)")
+   FMSQ(    0, 6,  3,12,  3, sX, "Intel Xeon E3-1200 v3 (Haswell C0)")
+   FMSQ(    0, 6,  3,12,  3, Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell C0)")
+   FMSQ(    0, 6,  3,12,  3, dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell C0)")
+   FMSQ(    0, 6,  3,12,  3, MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell C0)")
+   FMSQ(    0, 6,  3,12,  3, dC, "Intel Celeron G1800 / G2000 (Haswell C0)") // G2000 only from MRG* 2019-08-31
+   FMSQ(    0, 6,  3,12,  3, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell C0)")
+   FMSQ(    0, 6,  3,12,  3, dP, "Intel Pentium G3000 (Haswell C0)")
+   FMS (    0, 6,  3,12,  3,     "Intel Core (unknown type) (Haswell C0)")
+   FMQ (    0, 6,  3,12,     sX, "Intel Xeon E3-1200 v3 (Haswell)")
+   FMQ (    0, 6,  3,12,     Mc, "Intel Mobile Core i*-4000U (Mobile M) (Haswell)")
+   FMQ (    0, 6,  3,12,     dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Haswell)")
+   FMQ (    0, 6,  3,12,     MC, "Intel Mobile Celeron 2900U (Mobile M) (Haswell)")
+   FMQ (    0, 6,  3,12,     dC, "Intel Celeron G1800 / G2000 (Haswell)") // G2000 only from MRG* 2019-08-31
+   FMQ (    0, 6,  3,12,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile M) (Haswell)")
+   FMQ (    0, 6,  3,12,     dP, "Intel Pentium G3000 (Haswell)")
+   FM  (    0, 6,  3,12,         "Intel Core (unknown type) (Haswell)")
    // Intel docs (330836) omit the stepping numbers for (0,6),(3,13) E0 & F0.
    // MRG* 2019-08-31 mentions stepping 4, but doesn't specify which stepping name it is.
    // Coreboot* identifies the steppings.
-   FMSQ(    0, 6,  3,13,  2, dc, "Intel Core i*-5000 (Broadwell-U C0) / Core M (Broadwell-Y C0)");
-   FMSQ(    0, 6,  3,13,  2, MC, "Intel Mobile Celeron 3000 (Broadwell-U C0)");
-   FMSQ(    0, 6,  3,13,  2, dC, "Intel Celeron 3000 (Broadwell-U C0)");
-   FMSQ(    0, 6,  3,13,  2, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U C0)"); // only MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  3,13,  2,     "Intel Core (unknown type) (Broadwell-U/Y C0)");
-   FMSQ(    0, 6,  3,13,  3, dc, "Intel Core i*-5000 (Broadwell-U D0) / Core M (Broadwell-Y D0)");
-   FMSQ(    0, 6,  3,13,  3, MC, "Intel Mobile Celeron 3000 (Broadwell-U D0)");
-   FMSQ(    0, 6,  3,13,  3, dC, "Intel Celeron 3000 (Broadwell-U D0)");
-   FMSQ(    0, 6,  3,13,  3, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U D0)"); // only MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  3,13,  3,     "Intel Core (unknown type) (Broadwell-U/Y D0)");
-   FMSQ(    0, 6,  3,13,  4, dc, "Intel Core i*-5000 (Broadwell-U E0) / Core M (Broadwell-Y E0)");
-   FMSQ(    0, 6,  3,13,  4, MC, "Intel Mobile Celeron 3000 (Broadwell-U E0)");
-   FMSQ(    0, 6,  3,13,  4, dC, "Intel Celeron 3000 (Broadwell-U E0)");
-   FMSQ(    0, 6,  3,13,  4, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U E0)"); // only MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  3,13,  4,     "Intel Core (unknown type) (Broadwell-U/Y E0)");
-   FMQ (    0, 6,  3,13,     dc, "Intel Core i*-5000 (Broadwell-U) / Core M (Broadwell-Y)");
-   FMQ (    0, 6,  3,13,     MC, "Intel Mobile Celeron 3000 (Broadwell-U)");
-   FMQ (    0, 6,  3,13,     dC, "Intel Celeron 3000 (Broadwell-U)");
-   FMQ (    0, 6,  3,13,     dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U)"); // only MRG* 2018-03-06, 2019-08-31
-   FM  (    0, 6,  3,13,         "Intel Core (unknown type) (Broadwell-U/Y)");
+   FMSQ(    0, 6,  3,13,  2, dc, "Intel Core i*-5000 (Broadwell-U C0) / Core M (Broadwell-Y C0)")
+   FMSQ(    0, 6,  3,13,  2, MC, "Intel Mobile Celeron 3000 (Broadwell-U C0)")
+   FMSQ(    0, 6,  3,13,  2, dC, "Intel Celeron 3000 (Broadwell-U C0)")
+   FMSQ(    0, 6,  3,13,  2, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U C0)") // only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  3,13,  2,     "Intel Core (unknown type) (Broadwell-U/Y C0)")
+   FMSQ(    0, 6,  3,13,  3, dc, "Intel Core i*-5000 (Broadwell-U D0) / Core M (Broadwell-Y D0)")
+   FMSQ(    0, 6,  3,13,  3, MC, "Intel Mobile Celeron 3000 (Broadwell-U D0)")
+   FMSQ(    0, 6,  3,13,  3, dC, "Intel Celeron 3000 (Broadwell-U D0)")
+   FMSQ(    0, 6,  3,13,  3, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U D0)") // only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  3,13,  3,     "Intel Core (unknown type) (Broadwell-U/Y D0)")
+   FMSQ(    0, 6,  3,13,  4, dc, "Intel Core i*-5000 (Broadwell-U E0) / Core M (Broadwell-Y E0)")
+   FMSQ(    0, 6,  3,13,  4, MC, "Intel Mobile Celeron 3000 (Broadwell-U E0)")
+   FMSQ(    0, 6,  3,13,  4, dC, "Intel Celeron 3000 (Broadwell-U E0)")
+   FMSQ(    0, 6,  3,13,  4, dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U E0)") // only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  3,13,  4,     "Intel Core (unknown type) (Broadwell-U/Y E0)")
+   FMQ (    0, 6,  3,13,     dc, "Intel Core i*-5000 (Broadwell-U) / Core M (Broadwell-Y)")
+   FMQ (    0, 6,  3,13,     MC, "Intel Mobile Celeron 3000 (Broadwell-U)")
+   FMQ (    0, 6,  3,13,     dC, "Intel Celeron 3000 (Broadwell-U)")
+   FMQ (    0, 6,  3,13,     dP, "Intel Pentium 3700U / 3800U / 3200U (Broadwell-U)") // only MRG* 2018-03-06, 2019-08-31
+   FM  (    0, 6,  3,13,         "Intel Core (unknown type) (Broadwell-U/Y)")
    // Intel docs (329189, 329368, 329597).
-   FMSQ(    0, 6,  3,14,  4, sX, "Intel Xeon E5-1600/E5-2600 v2 (Ivy Bridge-EP C1/M1/S1)");
-   FMSQ(    0, 6,  3,14,  4, dc, "Intel Core i*-4000 (Ivy Bridge-E S1)");
-   FMS (    0, 6,  3,14,  4,     "Intel Core (unknown type) (Ivy Bridge-EP C1/M1/S1)");
-   FMSQ(    0, 6,  3,14,  7, sX, "Intel Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 v2 (Ivy Bridge-EX D1)"); // E5-4600 names from MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  3,14,  7,     "Intel Xeon (unknown type) (Ivy Bridge-EX D1)");
-   FMQ (    0, 6,  3,14,     sX, "Intel Xeon E5-1600 / E5-2600 v2 (Ivy Bridge-EP) / Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 (Ivy Bridge-EX)");
-   FMQ (    0, 6,  3,14,     dc, "Intel Core i9-4000 (Ivy Bridge-E)");
-   FM  (    0, 6,  3,14,         "Intel Core (unknown type) (Ivy Bridge-E / Ivy Bridge-EP / Ivy Bridge-EX)");
+   FMSQ(    0, 6,  3,14,  4, sX, "Intel Xeon E5-1600/E5-2600 v2 (Ivy Bridge-EP C1/M1/S1)")
+   FMSQ(    0, 6,  3,14,  4, dc, "Intel Core i*-4000 (Ivy Bridge-E S1)")
+   FMS (    0, 6,  3,14,  4,     "Intel Core (unknown type) (Ivy Bridge-EP C1/M1/S1)")
+   FMSQ(    0, 6,  3,14,  7, sX, "Intel Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 v2 (Ivy Bridge-EX D1)") // E5-4600 names from MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  3,14,  7,     "Intel Xeon (unknown type) (Ivy Bridge-EX D1)")
+   FMQ (    0, 6,  3,14,     sX, "Intel Xeon E5-1600 / E5-2600 v2 (Ivy Bridge-EP) / Xeon E5-4600 / E7-2800 / E7-4800 / E7-8800 (Ivy Bridge-EX)")
+   FMQ (    0, 6,  3,14,     dc, "Intel Core i9-4000 (Ivy Bridge-E)")
+   FM  (    0, 6,  3,14,         "Intel Core (unknown type) (Ivy Bridge-E / Ivy Bridge-EP / Ivy Bridge-EX)")
    // Intel docs (330785, 330841, 332317).
-   FMSQ(    0, 6,  3,15,  2, dc, "Intel Core i7-5000 Extreme Edition (Haswell-E R2)");
-   FMSQ(    0, 6,  3,15,  2, sX, "Intel Xeon E5-x600 v3 (Haswell-EP C1/M1/R2)");
-   FMS (    0, 6,  3,15,  2,     "Intel (unknown type) (Haswell C1/M1/R2)");
-   FMS (    0, 6,  3,15,  4,     "Intel Xeon E7-4800 / E7-8800 v3 (Haswell-EP E0)");
-   FM  (    0, 6,  3,15,         "Intel Core (unknown type) (Haswell R2 / Haswell-EP)");
+   FMSQ(    0, 6,  3,15,  2, dc, "Intel Core i7-5000 Extreme Edition (Haswell-E R2)")
+   FMSQ(    0, 6,  3,15,  2, sX, "Intel Xeon E5-x600 v3 (Haswell-EP C1/M1/R2)")
+   FMS (    0, 6,  3,15,  2,     "Intel (unknown type) (Haswell C1/M1/R2)")
+   FMS (    0, 6,  3,15,  4,     "Intel Xeon E7-4800 / E7-8800 v3 (Haswell-EP E0)")
+   FM  (    0, 6,  3,15,         "Intel Core (unknown type) (Haswell R2 / Haswell-EP)")
    // Intel docs (328903) omit the stepping numbers for (0,6),(4,5) C0 & D0.
    // MRG* 2019-08-31 mentions stepping 1, but doesn't specify which stepping name it is.
    // Coreboot* identifies the 0 stepping as B0, but not what the 1 stepping is.
-   FMSQ(    0, 6,  4, 5,  0, dc, "Intel Core i*-4000U (Haswell-ULT B0)"); // no docs, but example from Brice Goglin
-   FMSQ(    0, 6,  4, 5,  0, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT B0)");
-   FMSQ(    0, 6,  4, 5,  0, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT B0)");
-   FMSQ(    0, 6,  4, 5,  0, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT B0)");
-   FMS (    0, 6,  4, 5,  0,     "Intel Core (unknown type) (Haswell-ULT B0)");
-   FMQ (    0, 6,  4, 5,     dc, "Intel Core i*-4000U (Haswell-ULT)"); // no docs, but example from Brice Goglin
-   FMQ (    0, 6,  4, 5,     Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT)");
-   FMQ (    0, 6,  4, 5,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT)");
-   FMQ (    0, 6,  4, 5,     MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT)");
-   FM  (    0, 6,  4, 5,         "Intel Core (unknown type) (Haswell-ULT)");
+   FMSQ(    0, 6,  4, 5,  0, dc, "Intel Core i*-4000U (Haswell-ULT B0)") // no docs, but example from Brice Goglin
+   FMSQ(    0, 6,  4, 5,  0, Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT B0)")
+   FMSQ(    0, 6,  4, 5,  0, MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT B0)")
+   FMSQ(    0, 6,  4, 5,  0, MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT B0)")
+   FMS (    0, 6,  4, 5,  0,     "Intel Core (unknown type) (Haswell-ULT B0)")
+   FMQ (    0, 6,  4, 5,     dc, "Intel Core i*-4000U (Haswell-ULT)") // no docs, but example from Brice Goglin
+   FMQ (    0, 6,  4, 5,     Mc, "Intel Mobile Core i*-4000Y (Mobile U/Y) (Haswell-ULT)")
+   FMQ (    0, 6,  4, 5,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile U/Y) (Haswell-ULT)")
+   FMQ (    0, 6,  4, 5,     MC, "Intel Mobile Celeron 2900U (Mobile U/Y) (Haswell-ULT)")
+   FM  (    0, 6,  4, 5,         "Intel Core (unknown type) (Haswell-ULT)")
    // Intel docs (328899,328903) omit the stepping numbers for (0,6),(4,6) C0 & D0.
    // MRG* mentions (0,6),(4,6),1, but doesn't specify which stepping name it is.
-   FMQ (    0, 6,  4, 6,     Mc, "Intel Mobile Core i*-4000Y (Mobile H) (Crystal Well)");
-   FMQ (    0, 6,  4, 6,     dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Desktop R) (Crystal Well)");
-   FMQ (    0, 6,  4, 6,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile H) (Crystal Well)");
-   FMQ (    0, 6,  4, 6,     dC, "Intel Celeron G1800 (Desktop R) (Crystal Well)");
-   FMQ (    0, 6,  4, 6,     MC, "Intel Mobile Celeron 2900U (Mobile H) (Crystal Well)");
-   FMQ (    0, 6,  4, 6,     dP, "Intel Pentium G3000 (Desktop R) (Crystal Well)");
-   FM  (    0, 6,  4, 6,         "Intel Core (unknown type) (Crystal Well)");
+   FMQ (    0, 6,  4, 6,     Mc, "Intel Mobile Core i*-4000Y (Mobile H) (Crystal Well)")
+   FMQ (    0, 6,  4, 6,     dc, "Intel Core i*-4000 / Mobile Core i*-4000 (Desktop R) (Crystal Well)")
+   FMQ (    0, 6,  4, 6,     MP, "Intel Mobile Pentium 3500U / 3600U / 3500Y (Mobile H) (Crystal Well)")
+   FMQ (    0, 6,  4, 6,     dC, "Intel Celeron G1800 (Desktop R) (Crystal Well)")
+   FMQ (    0, 6,  4, 6,     MC, "Intel Mobile Celeron 2900U (Mobile H) (Crystal Well)")
+   FMQ (    0, 6,  4, 6,     dP, "Intel Pentium G3000 (Desktop R) (Crystal Well)")
+   FM  (    0, 6,  4, 6,         "Intel Core (unknown type) (Crystal Well)")
    // So far, all these (0,6),(4,7) processors are stepping G0, but the
    // Intel docs (332381, 332382) omit the stepping number for G0.
    // MRG* 2018-03-06 describes Broadwell H 43e.
-   FMSQ(    0, 6,  4, 7,  1, dc, "Intel Core i*-5000 (Broadwell G0)");
-   FMSQ(    0, 6,  4, 7,  1, Mc, "Intel Mobile Core i7-5000 (Broadwell G0)");
-   FMSQ(    0, 6,  4, 7,  1, sX, "Intel Xeon E3-1200 v4 (Broadwell G0)");
-   FMS (    0, 6,  4, 7,  1,     "Intel (unknown type) (Broadwell-H G0)");
-   FMQ (    0, 6,  4, 7,     dc, "Intel Core i7-5000 (Broadwell)");
-   FMQ (    0, 6,  4, 7,     Mc, "Intel Mobile Core i7-5000 (Broadwell)");
-   FMQ (    0, 6,  4, 7,     sX, "Intel Xeon E3-1200 v4 (Broadwell)");
-   FM  (    0, 6,  4, 7,         "Intel Core (unknown type) (Broadwell)");
+   FMSQ(    0, 6,  4, 7,  1, dc, "Intel Core i*-5000 (Broadwell G0)")
+   FMSQ(    0, 6,  4, 7,  1, Mc, "Intel Mobile Core i7-5000 (Broadwell G0)")
+   FMSQ(    0, 6,  4, 7,  1, sX, "Intel Xeon E3-1200 v4 (Broadwell G0)")
+   FMS (    0, 6,  4, 7,  1,     "Intel (unknown type) (Broadwell-H G0)")
+   FMQ (    0, 6,  4, 7,     dc, "Intel Core i7-5000 (Broadwell)")
+   FMQ (    0, 6,  4, 7,     Mc, "Intel Mobile Core i7-5000 (Broadwell)")
+   FMQ (    0, 6,  4, 7,     sX, "Intel Xeon E3-1200 v4 (Broadwell)")
+   FM  (    0, 6,  4, 7,         "Intel Core (unknown type) (Broadwell)")
    // no spec update; only MSR_CPUID_table* so far
    // MRG* 2018-03-06 mentions steppings 8 and 9, but without names for either.
-   FM  (    0, 6,  4,10,         "Intel Atom Z3400 (Merrifield)");
+   FM  (    0, 6,  4,10,         "Intel Atom Z3400 (Merrifield)")
    // Intel docs (332095).
-   FMSQ(    0, 6,  4,12,  3, dC, "Intel Celeron N3000 / J3000 (Braswell C0)");
-   FMSQ(    0, 6,  4,12,  3, dP, "Intel Pentium N3000 / J3000 (Braswell C0)");
-   FMSQ(    0, 6,  4,12,  3, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail C0)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  4,12,  3,     "Intel Atom (unknown type) (Braswell/Cherry Trail C0)");
-   FMSQ(    0, 6,  4,12,  4, dC, "Intel Celeron N3000 / J3000 (Braswell D1)");
-   FMSQ(    0, 6,  4,12,  4, dP, "Intel Pentium N3000 / J3000 (Braswell D1)");
-   FMSQ(    0, 6,  4,12,  4, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail D1)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-   FMS (    0, 6,  4,12,  4,     "Intel Atom (unknown type) (Braswell/Cherry Trail D1)");
-   FMQ (    0, 6,  4,12,     dC, "Intel Celeron N3000 / J3000 (Braswell)");
-   FMQ (    0, 6,  4,12,     dP, "Intel Pentium N3000 / J3000 (Braswell)");
-   FMQ (    0, 6,  4,12,     da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
-   FM  (    0, 6,  4,12,         "Intel Atom (unknown type) (Braswell/Cherry Trail)");
+   FMSQ(    0, 6,  4,12,  3, dC, "Intel Celeron N3000 / J3000 (Braswell C0)")
+   FMSQ(    0, 6,  4,12,  3, dP, "Intel Pentium N3000 / J3000 (Braswell C0)")
+   FMSQ(    0, 6,  4,12,  3, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail C0)") // no spec update; only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  4,12,  3,     "Intel Atom (unknown type) (Braswell/Cherry Trail C0)")
+   FMSQ(    0, 6,  4,12,  4, dC, "Intel Celeron N3000 / J3000 (Braswell D1)")
+   FMSQ(    0, 6,  4,12,  4, dP, "Intel Pentium N3000 / J3000 (Braswell D1)")
+   FMSQ(    0, 6,  4,12,  4, da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail D1)") // no spec update; only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  4,12,  4,     "Intel Atom (unknown type) (Braswell/Cherry Trail D1)")
+   FMQ (    0, 6,  4,12,     dC, "Intel Celeron N3000 / J3000 (Braswell)")
+   FMQ (    0, 6,  4,12,     dP, "Intel Pentium N3000 / J3000 (Braswell)")
+   FMQ (    0, 6,  4,12,     da, "Intel Atom x5-E8000 / x*-Z8000 (Cherry Trail)") // no spec update; only MRG* 2018-03-06, 2019-08-31
+   FM  (    0, 6,  4,12,         "Intel Atom (unknown type) (Braswell/Cherry Trail)")
    // Intel docs (329460, 330061).
-   FMS (    0, 6,  4,13,  0,     "Intel Atom C2000 (Avoton A0/A1)");
-   FMS (    0, 6,  4,13,  8,     "Intel Atom C2000 (Avoton/Rangeley B0/C0)");
-   FM  (    0, 6,  4,13,         "Intel Atom C2000 (Avoton)");
+   FMS (    0, 6,  4,13,  0,     "Intel Atom C2000 (Avoton A0/A1)")
+   FMS (    0, 6,  4,13,  8,     "Intel Atom C2000 (Avoton/Rangeley B0/C0)")
+   FM  (    0, 6,  4,13,         "Intel Atom C2000 (Avoton)")
    // Intel docs (332689) omit the stepping numbers for (0,6),(4,14) D1 & K1.
    // MRG* 2018-03-06 mentions (0,6),(4,14),3, but doesn't specify which
    // stepping name it is.
@@ -3146,29 +3730,29 @@ decode_synth_intel(unsigned int         val,  /* val_1_eax */
    // mentioned in (332689).
    // Coreboot* identifies stepping 8 as (Kaby Lake G0). Perhaps they were just
    // early engineering samples of Kaby Lake.
-   FMSQ(    0, 6,  4,14,  2, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake C0)");
-   FMSQ(    0, 6,  4,14,  2, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake C0)");
-   FMSQ(    0, 6,  4,14,  2, dC, "Intel Celeron 3800U / 39000U (Skylake C0)");
-   FMSQ(    0, 6,  4,14,  2, sX, "Intel Xeon E3-1500m (Skylake C0)"); // no spec update; only MSR_CPUID_table* so far
-   FMS (    0, 6,  4,14,  2,     "Intel Core (unknown type) (Skylake C0)");
-   FMSQ(    0, 6,  4,14,  3, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake D0)");
-   FMSQ(    0, 6,  4,14,  3, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake D0)");
-   FMSQ(    0, 6,  4,14,  3, dC, "Intel Celeron 3800U / 39000U (Skylake D0)");
-   FMSQ(    0, 6,  4,14,  3, sX, "Intel Xeon E3-1500m (Skylake D0)"); // no spec update; only MSR_CPUID_table* so far
-   FMS (    0, 6,  4,14,  3,     "Intel Core (unknown type) (Skylake D0)");
-   FMS (    0, 6,  4,14,  8,     "Intel Core (unknown type) (Kaby Lake G0)"); // Coreboot*
-   FMQ (    0, 6,  4,14,     dc, "Intel Core i*-6000U / m*-6Y00 (Skylake)");
-   FMQ (    0, 6,  4,14,     dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake)");
-   FMQ (    0, 6,  4,14,     dC, "Intel Celeron 3800U / 39000U (Skylake)");
-   FMQ (    0, 6,  4,14,     sX, "Intel Xeon E3-1500m (Skylake)"); // no spec update; only MSR_CPUID_table* so far
-   FM  (    0, 6,  4,14,         "Intel Core (unknown type) (Skylake)");
+   FMSQ(    0, 6,  4,14,  2, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake C0)")
+   FMSQ(    0, 6,  4,14,  2, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake C0)")
+   FMSQ(    0, 6,  4,14,  2, dC, "Intel Celeron 3800U / 39000U (Skylake C0)")
+   FMSQ(    0, 6,  4,14,  2, sX, "Intel Xeon E3-1500m (Skylake C0)") // no spec update; only MSR_CPUID_table* so far
+   FMS (    0, 6,  4,14,  2,     "Intel Core (unknown type) (Skylake C0)")
+   FMSQ(    0, 6,  4,14,  3, dc, "Intel Core i*-6000U / m*-6Y00 (Skylake D0)")
+   FMSQ(    0, 6,  4,14,  3, dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake D0)")
+   FMSQ(    0, 6,  4,14,  3, dC, "Intel Celeron 3800U / 39000U (Skylake D0)")
+   FMSQ(    0, 6,  4,14,  3, sX, "Intel Xeon E3-1500m (Skylake D0)") // no spec update; only MSR_CPUID_table* so far
+   FMS (    0, 6,  4,14,  3,     "Intel Core (unknown type) (Skylake D0)")
+   FMS (    0, 6,  4,14,  8,     "Intel Core (unknown type) (Kaby Lake G0)") // Coreboot*
+   FMQ (    0, 6,  4,14,     dc, "Intel Core i*-6000U / m*-6Y00 (Skylake)")
+   FMQ (    0, 6,  4,14,     dP, "Intel Pentium 4405U / Pentium 4405Y (Skylake)")
+   FMQ (    0, 6,  4,14,     dC, "Intel Celeron 3800U / 39000U (Skylake)")
+   FMQ (    0, 6,  4,14,     sX, "Intel Xeon E3-1500m (Skylake)") // no spec update; only MSR_CPUID_table* so far
+   FM  (    0, 6,  4,14,         "Intel Core (unknown type) (Skylake)")
    // Intel docs (333811, 334165) omit the stepping numbers for (0,6),(4,15)
    // B0, M0 & R0, but (334208) provide some.
-   FMSQ(    0, 6,  4,15,  1, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E R0)");
-   FMQ (    0, 6,  4,15,     dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E)");
-   FMSQ(    0, 6,  4,15,  1, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX B0)");
-   FMQ (    0, 6,  4,15,     sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX)");
-   FM  (    0, 6,  4,15,         "Intel Core (unknown type) (Broadwell-E / Broadwell-EX)");
+   FMSQ(    0, 6,  4,15,  1, dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E R0)")
+   FMQ (    0, 6,  4,15,     dc, "Intel Core i7-6800K / i7-6900K / i7-6900X (Broadwell-E)")
+   FMSQ(    0, 6,  4,15,  1, sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX B0)")
+   FMQ (    0, 6,  4,15,     sX, "Intel Xeon E5-1600 / E5-2600 / E5-4600 v4 (Broadwell-E) / E7-4800 / E7-8800 v4 (Broadwell-EX)")
+   FM  (    0, 6,  4,15,         "Intel Core (unknown type) (Broadwell-E / Broadwell-EX)")
    // Intel docs (335901) omit almost all details for the Core versions of
    // (0,6),(5,5).  But Intel docs (336065: Xeon Scalable steppings 2 & 4,
    // 338848: Xeon Scalable (2nd gen) stepping 7, and 338854: Xeon D-2000
@@ -3176,47 +3760,47 @@ decode_synth_intel(unsigned int         val,  /* val_1_eax */
    // MRG* 2019-11-13 mentions stepping 3, but doesn't mention stepping name.
    // geekbench.com has an "Intel Xeon Gold 6230" example of a stepping 5, but
    // no stepping name.
-   FMSQ(    0, 6,  5, 5,  2, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake B0/L0)");
-   FMSQ(    0, 6,  5, 5,  2, sX, "Intel Xeon W 2000 / D-2100 (Skylake B0/L0)");
-   FMSQ(    0, 6,  5, 5,  4, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake H0/M0/U0)");
-   FMSQ(    0, 6,  5, 5,  4, sX, "Intel Xeon W 2000 / D-2100 (Skylake H0/M0/U0)"); // D-2100 from MRG* 2018-03-06
-   FMSQ(    0, 6,  5, 5,  4, dc, "Intel Core i9-7000X (Skylake-X H0/M0/U0)"); // only from MRG* 2018-03-06
-   FMSQ(    0, 6,  5, 5,  6, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake)"); // no docs, but example from Greg Stewart
-   FMSQ(    0, 6,  5, 5,  6, sX, "Intel Xeon W 2000 (Cascade Lake)"); // no docs, but example from Greg Stewart
-   FMSQ(    0, 6,  5, 5,  7, dc, "Intel Core i*-10000X (Cascade Lake-X B1/L1/R1)"); // no docs, but instlatx64 example
-   FMSQ(    0, 6,  5, 5,  7, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake B1/L1/R1)");
-   FMSQ(    0, 6,  5, 5,  7, sX, "Intel Xeon W 2000 (Cascade Lake-W B1/L1/R1)");
-   FMS (    0, 6,  5, 5, 10,     "Intel (unknown type) (Cooper Lake)");
-   FMQ (    0, 6,  5, 5,     sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake / Cascade Lake)");
-   FMQ (    0, 6,  5, 5,     sX, "Intel Xeon W 2000 / D-2100 (Skylake / Cascade Lake)");
-   FMQ (    0, 6,  5, 5,     dc, "Intel Core i*-6000X / i*-7000X (Skylake-X) / i*-10000X (Cascade Lake-X)");
-   FM  (    0, 6,  5, 5,         "Intel Core (unknown type) (Skylake / Skylake-X / Cascade Lake / Cascade Lake-X)");
+   FMSQ(    0, 6,  5, 5,  2, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake B0/L0)")
+   FMSQ(    0, 6,  5, 5,  2, sX, "Intel Xeon W 2000 / D-2100 (Skylake B0/L0)")
+   FMSQ(    0, 6,  5, 5,  4, sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake H0/M0/U0)")
+   FMSQ(    0, 6,  5, 5,  4, sX, "Intel Xeon W 2000 / D-2100 (Skylake H0/M0/U0)") // D-2100 from MRG* 2018-03-06
+   FMSQ(    0, 6,  5, 5,  4, dc, "Intel Core i9-7000X (Skylake-X H0/M0/U0)") // only from MRG* 2018-03-06
+   FMSQ(    0, 6,  5, 5,  6, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake)") // no docs, but example from Greg Stewart
+   FMSQ(    0, 6,  5, 5,  6, sX, "Intel Xeon W 2000 (Cascade Lake)") // no docs, but example from Greg Stewart
+   FMSQ(    0, 6,  5, 5,  7, dc, "Intel Core i*-10000X (Cascade Lake-X B1/L1/R1)") // no docs, but instlatx64 example
+   FMSQ(    0, 6,  5, 5,  7, sS, "Intel Scalable (2nd Gen) Bronze/Silver/Gold/Platinum (Cascade Lake B1/L1/R1)")
+   FMSQ(    0, 6,  5, 5,  7, sX, "Intel Xeon W 2000 (Cascade Lake-W B1/L1/R1)")
+   FMS (    0, 6,  5, 5, 10,     "Intel (unknown type) (Cooper Lake)")
+   FMQ (    0, 6,  5, 5,     sS, "Intel Scalable Bronze/Silver/Gold/Platinum (Skylake / Cascade Lake)")
+   FMQ (    0, 6,  5, 5,     sX, "Intel Xeon W 2000 / D-2100 (Skylake / Cascade Lake)")
+   FMQ (    0, 6,  5, 5,     dc, "Intel Core i*-6000X / i*-7000X (Skylake-X) / i*-10000X (Cascade Lake-X)")
+   FM  (    0, 6,  5, 5,         "Intel Core (unknown type) (Skylake / Skylake-X / Cascade Lake / Cascade Lake-X)")
    // Intel docs (332054).
-   FMS (    0, 6,  5, 6,  1,     "Intel Xeon D-1500 (Broadwell-DE U0)");
-   FMS (    0, 6,  5, 6,  2,     "Intel Xeon D-1500 (Broadwell-DE V1)");
-   FMS (    0, 6,  5, 6,  3,     "Intel Xeon D-1500 (Broadwell-DE V2/V3)"); // V3 from MRG* 2018-03-06
-   FMS (    0, 6,  5, 6,  4,     "Intel Xeon D-1500 (Broadwell-DE Y0)");
-   FMS (    0, 6,  5, 6,  5,     "Intel Xeon D-1500N (Broadwell-DE A1)");
-   FM  (    0, 6,  5, 6,         "Intel Xeon (unknown type) (Broadwell-DE)");
+   FMS (    0, 6,  5, 6,  1,     "Intel Xeon D-1500 (Broadwell-DE U0)")
+   FMS (    0, 6,  5, 6,  2,     "Intel Xeon D-1500 (Broadwell-DE V1)")
+   FMS (    0, 6,  5, 6,  3,     "Intel Xeon D-1500 (Broadwell-DE V2/V3)") // V3 from MRG* 2018-03-06
+   FMS (    0, 6,  5, 6,  4,     "Intel Xeon D-1500 (Broadwell-DE Y0)")
+   FMS (    0, 6,  5, 6,  5,     "Intel Xeon D-1500N (Broadwell-DE A1)")
+   FM  (    0, 6,  5, 6,         "Intel Xeon (unknown type) (Broadwell-DE)")
    // Intel docs (334646) omit the stepping number for B0.  But as of Jan 2020,
    // it is the only stepping, and all examples seen have stepping number 1.
-   FMS (    0, 6,  5, 7,  1,     "Intel Xeon Phi x200 (Knights Landing B0)");
-   FM  (    0, 6,  5, 7,         "Intel Xeon Phi x200 (Knights Landing)");
-   FM  (    0, 6,  5,10,         "Intel Atom Z3500 (Moorefield)"); // no spec update; only MSR_CPUID_table* & instlatx64 example so far
+   FMS (    0, 6,  5, 7,  1,     "Intel Xeon Phi x200 (Knights Landing B0)")
+   FM  (    0, 6,  5, 7,         "Intel Xeon Phi x200 (Knights Landing)")
+   FM  (    0, 6,  5,10,         "Intel Atom Z3500 (Moorefield)") // no spec update; only MSR_CPUID_table* & instlatx64 example so far
    // Intel docs (334820) & MRG* 2018-03-06
    // Coreboot* provides stepping 8 (A0).
-   FMS (    0, 6,  5,12,  2,     "Intel Atom T5000 (Apollo Lake)"); // no spec update; only MRG* 2018-03-06
-   FMS (    0, 6,  5,12,  8,     "Intel Atom (unknown type) (Apollo Lake A0)");
-   FMSQ(    0, 6,  5,12,  9, dP, "Intel Pentium N4000 / J4000 (Apollo Lake B0/B1/D0)");
-   FMSQ(    0, 6,  5,12,  9, dC, "Intel Celeron N3000 / J3000 (Apollo Lake B0/B1/D0)");
-   FMSQ(    0, 6,  5,12,  9, da, "Intel Atom x*-E3900 / x*-A3900 (Apollo Lake B0/B1/D0)"); // A3900 only from MRG* 2019-08-31
-   FMS (    0, 6,  5,12,  9,     "Intel Atom (unknown type) (Apollo Lake B0/B1/D0)");
-   FMSQ(    0, 6,  5,12, 10, da, "Intel Atom x*-E3900 (Apollo Lake E0)");
-   FMS (    0, 6,  5,12, 10,     "Intel Atom (unknown type) (Apollo Lake E0)");
-   FM  (    0, 6,  5,12,         "Intel Atom (unknown type) (Apollo Lake)"); // no spec update for Atom; only MSR_CPUID_table* so far
+   FMS (    0, 6,  5,12,  2,     "Intel Atom T5000 (Apollo Lake)") // no spec update; only MRG* 2018-03-06
+   FMS (    0, 6,  5,12,  8,     "Intel Atom (unknown type) (Apollo Lake A0)")
+   FMSQ(    0, 6,  5,12,  9, dP, "Intel Pentium N4000 / J4000 (Apollo Lake B0/B1/D0)")
+   FMSQ(    0, 6,  5,12,  9, dC, "Intel Celeron N3000 / J3000 (Apollo Lake B0/B1/D0)")
+   FMSQ(    0, 6,  5,12,  9, da, "Intel Atom x*-E3900 / x*-A3900 (Apollo Lake B0/B1/D0)") // A3900 only from MRG* 2019-08-31
+   FMS (    0, 6,  5,12,  9,     "Intel Atom (unknown type) (Apollo Lake B0/B1/D0)")
+   FMSQ(    0, 6,  5,12, 10, da, "Intel Atom x*-E3900 (Apollo Lake E0)")
+   FMS (    0, 6,  5,12, 10,     "Intel Atom (unknown type) (Apollo Lake E0)")
+   FM  (    0, 6,  5,12,         "Intel Atom (unknown type) (Apollo Lake)") // no spec update for Atom; only MSR_CPUID_table* so far
    // No spec update; only MSR_CPUID_table* so far (and instlatx64 example)
    // MRG* 2018-03-06 mentions (0,6),(5,13),1 stepping, but doesn't mention stepping name.
-   FM  (    0, 6,  5,13,         "Intel Atom x3-C3000 (SoFIA)");
+   FM  (    0, 6,  5,13,         "Intel Atom x3-C3000 (SoFIA)")
    // Intel docs (332689,333133) omit the stepping numbers for (0,6),(5,14)
    // R0 & S0.
    // MRG* 2018-03-06 mentions (0,6),(5,14),3, but doesn't specify which
@@ -3225,309 +3809,309 @@ decode_synth_intel(unsigned int         val,  /* val_1_eax */
    // stepping.
    // Coreboot* identifies stepping 8 as (Kaby Lake-H A0). Perhaps they were just
    // early engineering samples of Kaby Lake.
-   FMSQ(    0, 6,  5,14,  1, dc, "Intel Core i*-6000 (Skylake-H Q0)");
-   FMSQ(    0, 6,  5,14,  1, dP, "Intel Pentium G4000 (Skylake-H Q0)");
-   FMSQ(    0, 6,  5,14,  1, dC, "Intel Celeron G3900 (Skylake-H Q0)");
-   FMSQ(    0, 6,  5,14,  1, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H Q0)"); // E3-1500 only from MRG 2019-08-31
-   FMS (    0, 6,  5,14,  1,     "Intel Core (unknown type) (Skylake-H Q0)");
-   FMSQ(    0, 6,  5,14,  3, dc, "Intel Core i*-6000 (Skylake-H R0)");
-   FMSQ(    0, 6,  5,14,  3, dP, "Intel Pentium G4000 (Skylake-H R0)");
-   FMSQ(    0, 6,  5,14,  3, dC, "Intel Celeron G3900 (Skylake-H R0)");
-   FMSQ(    0, 6,  5,14,  3, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H R0)"); // E3-1500 only from MRG 2019-08-31
-   FMS (    0, 6,  5,14,  3,     "Intel Core (unknown type) (Skylake-H R0)");
-   FMS (    0, 6,  4,14,  8,     "Intel Core (unknown type) (Kaby Lake-H A0)"); // Coreboot*
-   FMQ (    0, 6,  5,14,     dc, "Intel Core i*-6000 (Skylake-H)");
-   FMQ (    0, 6,  5,14,     dP, "Intel Pentium G4000 (Skylake-H)");
-   FMQ (    0, 6,  5,14,     dC, "Intel Celeron G3900 (Skylake-H)");
-   FMQ (    0, 6,  5,14,     sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H)"); // E3-1500 only from MRG 2019-08-31
-   FM  (    0, 6,  5,14,         "Intel Core (unknown type) (Skylake-H)");
+   FMSQ(    0, 6,  5,14,  1, dc, "Intel Core i*-6000 (Skylake-H Q0)")
+   FMSQ(    0, 6,  5,14,  1, dP, "Intel Pentium G4000 (Skylake-H Q0)")
+   FMSQ(    0, 6,  5,14,  1, dC, "Intel Celeron G3900 (Skylake-H Q0)")
+   FMSQ(    0, 6,  5,14,  1, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H Q0)") // E3-1500 only from MRG 2019-08-31
+   FMS (    0, 6,  5,14,  1,     "Intel Core (unknown type) (Skylake-H Q0)")
+   FMSQ(    0, 6,  5,14,  3, dc, "Intel Core i*-6000 (Skylake-H R0)")
+   FMSQ(    0, 6,  5,14,  3, dP, "Intel Pentium G4000 (Skylake-H R0)")
+   FMSQ(    0, 6,  5,14,  3, dC, "Intel Celeron G3900 (Skylake-H R0)")
+   FMSQ(    0, 6,  5,14,  3, sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H R0)") // E3-1500 only from MRG 2019-08-31
+   FMS (    0, 6,  5,14,  3,     "Intel Core (unknown type) (Skylake-H R0)")
+   FMS (    0, 6,  4,14,  8,     "Intel Core (unknown type) (Kaby Lake-H A0)") // Coreboot*
+   FMQ (    0, 6,  5,14,     dc, "Intel Core i*-6000 (Skylake-H)")
+   FMQ (    0, 6,  5,14,     dP, "Intel Pentium G4000 (Skylake-H)")
+   FMQ (    0, 6,  5,14,     dC, "Intel Celeron G3900 (Skylake-H)")
+   FMQ (    0, 6,  5,14,     sX, "Intel Xeon E3-1200 / E3-1500 v5 (Skylake-H)") // E3-1500 only from MRG 2019-08-31
+   FM  (    0, 6,  5,14,         "Intel Core (unknown type) (Skylake-H)")
    // Intel docs (336345).
-   FMS (    0, 6,  5,15,  0,     "Intel Atom C3000 (Denverton A0/A1)");
-   FMS (    0, 6,  5,15,  1,     "Intel Atom C3000 (Denverton B0/B1)");
-   FM  (    0, 6,  5,15,         "Intel Atom C3000 (Denverton)");
-   FM  (    0, 6,  6, 5,         "Intel XMM 7272 (SoFIA)"); // no spec update; only MRG* 2018-03-06, 2019-08-31
+   FMS (    0, 6,  5,15,  0,     "Intel Atom C3000 (Denverton A0/A1)")
+   FMS (    0, 6,  5,15,  1,     "Intel Atom C3000 (Denverton B0/B1)")
+   FM  (    0, 6,  5,15,         "Intel Atom C3000 (Denverton)")
+   FM  (    0, 6,  6, 5,         "Intel XMM 7272 (SoFIA)") // no spec update; only MRG* 2018-03-06, 2019-08-31
    // no spec update; only MSR_CPUID_table* & instlatx64 example so far
    // Coreboot* provides the steppings.
-   FMS (    0, 6,  6, 6,  0,     "Intel Core (Cannon Lake A0)");
-   FMS (    0, 6,  6, 6,  1,     "Intel Core (Cannon Lake B0)");
-   FMS (    0, 6,  6, 6,  2,     "Intel Core (Cannon Lake C0)");
-   FMS (    0, 6,  6, 6,  3,     "Intel Core (Cannon Lake D0)");
-   FM  (    0, 6,  6, 6,         "Intel Core (Cannon Lake)");
-   FM  (    0, 6,  6,10,         "Intel Core (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
-   FM  (    0, 6,  6,12,         "Intel Core (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
+   FMS (    0, 6,  6, 6,  0,     "Intel Core (Cannon Lake A0)")
+   FMS (    0, 6,  6, 6,  1,     "Intel Core (Cannon Lake B0)")
+   FMS (    0, 6,  6, 6,  2,     "Intel Core (Cannon Lake C0)")
+   FMS (    0, 6,  6, 6,  3,     "Intel Core (Cannon Lake D0)")
+   FM  (    0, 6,  6, 6,         "Intel Core (Cannon Lake)")
+   FM  (    0, 6,  6,10,         "Intel Core (Ice Lake)") // no spec update; only MSR_CPUID_table* so far
+   FM  (    0, 6,  6,12,         "Intel Core (Ice Lake)") // no spec update; only MSR_CPUID_table* so far
    // No spec update; only MRG* 2018-03-06, 2019-08-31.  It is some sort of Atom,
    // but no idea which uarch or core.
-   FM  (    0, 6,  6,14,         "Intel Puma 7");
+   FM  (    0, 6,  6,14,         "Intel Puma 7")
    // No spec update; only instlatx64 example.
-   FM  (    0, 6,  7, 5,         "Intel Spreadtrum SC9853I-IA");
+   FM  (    0, 6,  7, 5,         "Intel Spreadtrum SC9853I-IA")
    // Intel docs (336562).
    // MRG* 2019-11-13 mentions stepping 8, but doesn't mention stepping name.
    // Coreboot* provides steppings 0 (A0) & 8 (R0).
-   FMSQ(    0, 6,  7,10,  0, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake A0)");
-   FMSQ(    0, 6,  7,10,  0, dC, "Intel Celeron N4000 / J4000 (Gemini Lake A0)");
-   FMS (    0, 6,  7,10,  0,     "Intel (unknown type) (Gemini Lake A0)");
-   FMSQ(    0, 6,  7,10,  1, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake B0)");
-   FMSQ(    0, 6,  7,10,  1, dC, "Intel Celeron N4000 / J4000 (Gemini Lake B0)");
-   FMS (    0, 6,  7,10,  1,     "Intel (unknown type) (Gemini Lake B0)");
-   FMSQ(    0, 6,  7,10,  8, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake R0)");
-   FMSQ(    0, 6,  7,10,  8, dC, "Intel Celeron N4000 / J4000 (Gemini Lake R0)");
-   FMS (    0, 6,  7,10,  8,     "Intel (unknown type) (Gemini Lake R0)");
-   FMQ (    0, 6,  7,10,     dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake)");
-   FMQ (    0, 6,  7,10,     dC, "Intel Celeron N4000 / J4000 (Gemini Lake)");
-   FM  (    0, 6,  7,10,         "Intel (unknown type) (Gemini Lake)");
-   FM  (    0, 6,  7,13,         "Intel Core i*-10000 (Ice Lake)"); // no spec update; only MSR_CPUID_table* so far
+   FMSQ(    0, 6,  7,10,  0, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake A0)")
+   FMSQ(    0, 6,  7,10,  0, dC, "Intel Celeron N4000 / J4000 (Gemini Lake A0)")
+   FMS (    0, 6,  7,10,  0,     "Intel (unknown type) (Gemini Lake A0)")
+   FMSQ(    0, 6,  7,10,  1, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake B0)")
+   FMSQ(    0, 6,  7,10,  1, dC, "Intel Celeron N4000 / J4000 (Gemini Lake B0)")
+   FMS (    0, 6,  7,10,  1,     "Intel (unknown type) (Gemini Lake B0)")
+   FMSQ(    0, 6,  7,10,  8, dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake R0)")
+   FMSQ(    0, 6,  7,10,  8, dC, "Intel Celeron N4000 / J4000 (Gemini Lake R0)")
+   FMS (    0, 6,  7,10,  8,     "Intel (unknown type) (Gemini Lake R0)")
+   FMQ (    0, 6,  7,10,     dP, "Intel Pentium Silver N5000 / J5000 (Gemini Lake)")
+   FMQ (    0, 6,  7,10,     dC, "Intel Celeron N4000 / J4000 (Gemini Lake)")
+   FM  (    0, 6,  7,10,         "Intel (unknown type) (Gemini Lake)")
+   FM  (    0, 6,  7,13,         "Intel Core i*-10000 (Ice Lake)") // no spec update; only MSR_CPUID_table* so far
    // Intel docs (341079) provide inconsistent information about stepping
    // numbers for (0,6),(7,14), and it contradicts actual samples, so I'm
    // ignoring it.
    // Currently there are no Ice Lake CPUs for Xeon/Pentium/Celeron.
    // Coreboot* provides steppings 0 (A0) & 1 (B0), but not for stepping 5,
    // seen in an instlatx64 sample.
-   FMS (    0, 6,  7,14,  0,     "Intel Core i*-10000 (Ice Lake-U/Y A0)");
-   FMS (    0, 6,  7,14,  1,     "Intel Core i*-10000 (Ice Lake-U/Y B0)");
-   FM  (    0, 6,  7,14,         "Intel Core i*-10000 (Ice Lake-U/Y)");
+   FMS (    0, 6,  7,14,  0,     "Intel Core i*-10000 (Ice Lake-U/Y A0)")
+   FMS (    0, 6,  7,14,  1,     "Intel Core i*-10000 (Ice Lake-U/Y B0)")
+   FM  (    0, 6,  7,14,         "Intel Core i*-10000 (Ice Lake-U/Y)")
    // no spec update; only MSR_CPUID_table* so far
    // MRG* 2018-03-06 mentions stepping 0, but doesn't specify which stepping name it is.
-   FM  (    0, 6,  8, 5,         "Intel Xeon Phi (Knights Mill)");
-   FM  (    0, 6,  8, 6,         "Intel Atom (Elkhart Lake)");
-   FM  (    0, 6,  8,10,         "Intel Atom (Lakefield)"); // no spec update; LX*
+   FM  (    0, 6,  8, 5,         "Intel Xeon Phi (Knights Mill)")
+   FM  (    0, 6,  8, 6,         "Intel Atom (Elkhart Lake)")
+   FM  (    0, 6,  8,10,         "Intel Atom (Lakefield)") // no spec update; LX*
    // Coreboot* provides steppings.
-   FMS (    0, 6,  8,12,  0,     "Intel Core (Tiger Lake-U A0)");
-   FMS (    0, 6,  8,12,  1,     "Intel Core (Tiger Lake-U B0)");
-   FM  (    0, 6,  8,12,         "Intel Core (Tiger Lake-U)");
-   FM  (    0, 6,  8,13,         "Intel Core (Tiger Lake)"); // LX*
+   FMS (    0, 6,  8,12,  0,     "Intel Core (Tiger Lake-U A0)")
+   FMS (    0, 6,  8,12,  1,     "Intel Core (Tiger Lake-U B0)")
+   FM  (    0, 6,  8,12,         "Intel Core (Tiger Lake-U)")
+   FM  (    0, 6,  8,13,         "Intel Core (Tiger Lake)") // LX*
    // Intel docs (334663) omit the stepping numbers for (0,6),(8,14)
    // H0, J1 & Y0, but (338025, 615213) provide some.
    // Coreboot* provides the 9 (H0) & 10 (Y0) stepping, but not J1.
-   FMSQ(    0, 6,  8,14,  9, UC, "Intel Celeron 3x65U (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-   FMSQ(    0, 6,  8,14,  9, UP, "Intel Celeron 4415U (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-   FMSQ(    0, 6,  8,14,  9, YC, "Intel Celeron 3x65Y (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-   FMSQ(    0, 6,  8,14,  9, YP, "Intel Celeron 4410Y (Kaby Lake H0)"); // MRG* 2019-08-31 pinned down stepping
-   FMSQ(    0, 6,  8,14,  9, Y8, "Intel i*-8000Y / m*-8000Y (Amber Lake-Y H0)"); // no spec update; only MRG* 2019-08-31 & instlatx64 examples
-   FMSQ(    0, 6,  8,14,  9, LY, "Intel Core i*-7000Y (Kaby Lake H0)"); // no spec update; only MRG* 2019-08-31 & instlatx64 examples
-   FMSQ(    0, 6,  8,14,  9, dc, "Intel Core i*-7000U (Kaby Lake H0)"); // no docs on stepping; MRG* 2018-03-06, 2019-08-31
-   FMSQ(    0, 6,  8,14, 10, dc, "Intel Core i*-8000U (Kaby Lake Y0)"); // no docs on stepping; MRG* 2018-03-06
-   FMSQ(    0, 6,  8,14, 11, LU, "Intel Core i*-8000U (Whiskey Lake-U W0)");
-   FMSQ(    0, 6,  8,14, 11, LY, "Intel Core i*-8000Y (Amber Lake-Y W0)");
-   FMSQ(    0, 6,  8,14, 11, UC, "Intel Celeron 4205U (Whiskey Lake-U W0)");
-   FMSQ(    0, 6,  8,14, 11, UP, "Intel Pentium 5405U (Whiskey Lake-U W0)");
-   FMS (    0, 6,  8,14, 11,     "Intel Core (unknown type) (Whiskey Lake-U W0 / Amber Lake-Y W0)");
-   FMSQ(    0, 6,  8,14, 12, UX, "Intel Core i*-10000U (Comet Lake-U V1)");
-   FMSQ(    0, 6,  8,14, 12, LU, "Intel Core i*-8000U (Whiskey Lake-U V0)");
-   FMSQ(    0, 6,  8,14, 12, LY, "Intel Core i*-8000Y / m*-8000Y / i*-10000Y (Amber Lake-Y V0)"); // m*-8000Y & i*-10000Y from MRG* 2019-11-13
-   FMSQ(    0, 6,  8,14, 12, dP, "Intel Pentium 6000U (Comet Lake-U V1)"); // MRG* 2019-08-31 pinned down stepping
-   FMSQ(    0, 6,  8,14, 12, dC, "Intel Celeron 5000U (Comet Lake-U V1)"); // MRG* 2019-08-31 pinned down stepping
-   FMS (    0, 6,  8,14, 12,     "Intel (unknown type) (Whiskey Lake-U V0 / Comet Lake-U V1)");
-   FM  (    0, 6,  8,14,         "Intel Core (unknown type) (Kaby Lake / Amber Lake-Y / Whiskey Lake-U / Comet Lake-U)");
-   FM  (    0, 6,  8,15,         "Intel Xeon (unknown type) (Sapphire Rapids)"); // LX*
+   FMSQ(    0, 6,  8,14,  9, UC, "Intel Celeron 3x65U (Kaby Lake H0)") // MRG* 2019-08-31 pinned down stepping
+   FMSQ(    0, 6,  8,14,  9, UP, "Intel Celeron 4415U (Kaby Lake H0)") // MRG* 2019-08-31 pinned down stepping
+   FMSQ(    0, 6,  8,14,  9, YC, "Intel Celeron 3x65Y (Kaby Lake H0)") // MRG* 2019-08-31 pinned down stepping
+   FMSQ(    0, 6,  8,14,  9, YP, "Intel Celeron 4410Y (Kaby Lake H0)") // MRG* 2019-08-31 pinned down stepping
+   FMSQ(    0, 6,  8,14,  9, Y8, "Intel i*-8000Y / m*-8000Y (Amber Lake-Y H0)") // no spec update; only MRG* 2019-08-31 & instlatx64 examples
+   FMSQ(    0, 6,  8,14,  9, LY, "Intel Core i*-7000Y (Kaby Lake H0)") // no spec update; only MRG* 2019-08-31 & instlatx64 examples
+   FMSQ(    0, 6,  8,14,  9, dc, "Intel Core i*-7000U (Kaby Lake H0)") // no docs on stepping; MRG* 2018-03-06, 2019-08-31
+   FMSQ(    0, 6,  8,14, 10, dc, "Intel Core i*-8000U (Kaby Lake Y0)") // no docs on stepping; MRG* 2018-03-06
+   FMSQ(    0, 6,  8,14, 11, LU, "Intel Core i*-8000U (Whiskey Lake-U W0)")
+   FMSQ(    0, 6,  8,14, 11, LY, "Intel Core i*-8000Y (Amber Lake-Y W0)")
+   FMSQ(    0, 6,  8,14, 11, UC, "Intel Celeron 4205U (Whiskey Lake-U W0)")
+   FMSQ(    0, 6,  8,14, 11, UP, "Intel Pentium 5405U (Whiskey Lake-U W0)")
+   FMS (    0, 6,  8,14, 11,     "Intel Core (unknown type) (Whiskey Lake-U W0 / Amber Lake-Y W0)")
+   FMSQ(    0, 6,  8,14, 12, UX, "Intel Core i*-10000U (Comet Lake-U V1)")
+   FMSQ(    0, 6,  8,14, 12, LU, "Intel Core i*-8000U (Whiskey Lake-U V0)")
+   FMSQ(    0, 6,  8,14, 12, LY, "Intel Core i*-8000Y / m*-8000Y / i*-10000Y (Amber Lake-Y V0)") // m*-8000Y & i*-10000Y from MRG* 2019-11-13
+   FMSQ(    0, 6,  8,14, 12, dP, "Intel Pentium 6000U (Comet Lake-U V1)") // MRG* 2019-08-31 pinned down stepping
+   FMSQ(    0, 6,  8,14, 12, dC, "Intel Celeron 5000U (Comet Lake-U V1)") // MRG* 2019-08-31 pinned down stepping
+   FMS (    0, 6,  8,14, 12,     "Intel (unknown type) (Whiskey Lake-U V0 / Comet Lake-U V1)")
+   FM  (    0, 6,  8,14,         "Intel Core (unknown type) (Kaby Lake / Amber Lake-Y / Whiskey Lake-U / Comet Lake-U)")
+   FM  (    0, 6,  8,15,         "Intel Xeon (unknown type) (Sapphire Rapids)") // LX*
    // LX*.  Coreboot* provides stepping.
-   FMS (    0, 6,  9, 6,  0,     "Intel Atom (Elkhart Lake A0)");
-   FMS (    0, 6,  9, 6,  1,     "Intel Atom (Elkhart Lake B0)");
-   FM  (    0, 6,  9, 6,         "Intel Atom (Elkhart Lake)");
+   FMS (    0, 6,  9, 6,  0,     "Intel Atom (Elkhart Lake A0)")
+   FMS (    0, 6,  9, 6,  1,     "Intel Atom (Elkhart Lake B0)")
+   FM  (    0, 6,  9, 6,         "Intel Atom (Elkhart Lake)")
    // LX*.  Coreboot* provides stepping.
-   FMS (    0, 6,  9, 7,  0,     "Intel Atom (Alder Lake-S A0)");
-   FM  (    0, 6,  9, 7,         "Intel Atom (Alder Lake-S)");
+   FMS (    0, 6,  9, 7,  0,     "Intel Atom (Alder Lake-S A0)")
+   FM  (    0, 6,  9, 7,         "Intel Atom (Alder Lake-S)")
    // Coreboot*.  Coreboot* provides stepping.
-   FMS (    0, 6,  9,10,  0,     "Intel Atom (Alder Lake-P A0)");
-   FM  (    0, 6,  9,10,         "Intel Atom (Alder Lake-P)");
+   FMS (    0, 6,  9,10,  0,     "Intel Atom (Alder Lake-P A0)")
+   FM  (    0, 6,  9,10,         "Intel Atom (Alder Lake-P)")
    // LX*.  Coreboot* provides stepping.
-   FMS (    0, 6,  9,12,  0,     "Intel Atom (Jasper Lake A0)");
-   FM  (    0, 6,  9,12,         "Intel Atom (Jasper Lake)");
-   FM  (    0, 6,  9,13,         "Intel NNP I-1000 (Spring Hill)"); // LX*
+   FMS (    0, 6,  9,12,  0,     "Intel Atom (Jasper Lake A0)")
+   FM  (    0, 6,  9,12,         "Intel Atom (Jasper Lake)")
+   FM  (    0, 6,  9,13,         "Intel NNP I-1000 (Spring Hill)") // LX*
    // Intel docs (334663, 335718, 336466, 338014) omit the stepping numbers for
    // (0,6),(9,14) B0, but (337346) provides some.
    // Coreboot* provides the 9 (B0) stepping.
    // WARNING: If adding new steppings here, also update decode_uarch_intel.
-   FMSQ(    0, 6,  9,14,  9, LG, "Intel Core i*-8700 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06, 2019-08-31
-   FMSQ(    0, 6,  9,14,  9, dc, "Intel Core i*-7700 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06 & instlatx64 examples
-   FMSQ(    0, 6,  9,14,  9, sX, "Intel Xeon E3-1200 v6 (Kaby Lake-H B0)"); // no docs on stepping; only MRG* 2018-03-06
-   FMSQ(    0, 6,  9,14,  9, dC, "Intel Celeron G3930 (Kaby Lake-H B0)"); // MRG* 2020-01-27 pinned down stepping
-   FMSQ(    0, 6,  9,14, 10, LU, "Intel Core i*-8000 U Line (Coffee Lake D0)");
-   FMSQ(    0, 6,  9,14, 10, dc, "Intel Core i*-8000 S/H Line (Coffee Lake U0)");
-   FMSQ(    0, 6,  9,14, 10, sX, "Intel Xeon E-2100 (Coffee Lake U0)"); // MRG* 2019-08-31
-   FMSQ(    0, 6,  9,14, 11, dc, "Intel Core i*-8000 S Line (Coffee Lake B0)");
-   FMSQ(    0, 6,  9,14, 11, dC, "Intel Celeron G4900 (Coffee Lake B0)"); // no spec update; MRG* 2020-01-27
-   FMSQ(    0, 6,  9,14, 11, dP, "Intel Pentium Gold G5000 (Coffee Lake B0)"); // MRG* 2020-01-27 pinned down stepping
-   FMSQ(    0, 6,  9,14, 12, dc, "Intel Core i*-9000 S Line (Coffee Lake P0)");
-   FMSQ(    0, 6,  9,14, 13, d1, "Intel CC150 (Coffee Lake R0)"); // no docs; only instlatx64 example
-   FMSQ(    0, 6,  9,14, 13, dc, "Intel Core i*-9000 H Line (Coffee Lake R0)");
-   FMSQ(    0, 6,  9,14, 13, sX, "Intel Xeon E-2200 (Coffee Lake R0)"); // no docs on stepping; only MRG 2019-11-13
-   FM  (    0, 6,  9,14,         "Intel (unknown type) (Kaby Lake / Coffee Lake)");
+   FMSQ(    0, 6,  9,14,  9, LG, "Intel Core i*-8700 (Kaby Lake-H B0)") // no docs on stepping; only MRG* 2018-03-06, 2019-08-31
+   FMSQ(    0, 6,  9,14,  9, dc, "Intel Core i*-7700 (Kaby Lake-H B0)") // no docs on stepping; only MRG* 2018-03-06 & instlatx64 examples
+   FMSQ(    0, 6,  9,14,  9, sX, "Intel Xeon E3-1200 v6 (Kaby Lake-H B0)") // no docs on stepping; only MRG* 2018-03-06
+   FMSQ(    0, 6,  9,14,  9, dC, "Intel Celeron G3930 (Kaby Lake-H B0)") // MRG* 2020-01-27 pinned down stepping
+   FMSQ(    0, 6,  9,14, 10, LU, "Intel Core i*-8000 U Line (Coffee Lake D0)")
+   FMSQ(    0, 6,  9,14, 10, dc, "Intel Core i*-8000 S/H Line (Coffee Lake U0)")
+   FMSQ(    0, 6,  9,14, 10, sX, "Intel Xeon E-2100 (Coffee Lake U0)") // MRG* 2019-08-31
+   FMSQ(    0, 6,  9,14, 11, dc, "Intel Core i*-8000 S Line (Coffee Lake B0)")
+   FMSQ(    0, 6,  9,14, 11, dC, "Intel Celeron G4900 (Coffee Lake B0)") // no spec update; MRG* 2020-01-27
+   FMSQ(    0, 6,  9,14, 11, dP, "Intel Pentium Gold G5000 (Coffee Lake B0)") // MRG* 2020-01-27 pinned down stepping
+   FMSQ(    0, 6,  9,14, 12, dc, "Intel Core i*-9000 S Line (Coffee Lake P0)")
+   FMSQ(    0, 6,  9,14, 13, d1, "Intel CC150 (Coffee Lake R0)") // no docs; only instlatx64 example
+   FMSQ(    0, 6,  9,14, 13, dc, "Intel Core i*-9000 H Line (Coffee Lake R0)")
+   FMSQ(    0, 6,  9,14, 13, sX, "Intel Xeon E-2200 (Coffee Lake R0)") // no docs on stepping; only MRG 2019-11-13
+   FM  (    0, 6,  9,14,         "Intel (unknown type) (Kaby Lake / Coffee Lake)")
    // LX*.  Coreboot* provides more detail & steppings
    // (615213) mentions the (0,6),(10,5),2 and (0,6),(10,5),5 steppings, but
    // does not provide their names.
    // en.wikichip.org provides more details on stepping names.
-   FMSQ(    0, 6, 10, 5,  0, dc, "Intel Core i*-10000 (Comet Lake-H/S G0)");
-   FMS (    0, 6, 10, 5,  0,     "Intel (unknown type) (Comet Lake-H/S G0)");
-   FMSQ(    0, 6, 10, 5,  1, dc, "Intel Core i*-10000 (Comet Lake-H/S P0)");
-   FMS (    0, 6, 10, 5,  1,     "Intel (unknown type) (Comet Lake-H/S P0)");
-   FMSQ(    0, 6, 10, 5,  2, dc, "Intel Core i*-10000 (Comet Lake-H/S R1)");
-   FMS (    0, 6, 10, 5,  2,     "Intel (unknown type) (Comet Lake-H/S R1)");
-   FMSQ(    0, 6, 10, 5,  3, dc, "Intel Core i*-10000 (Comet Lake-H/S G1)");
-   FMS (    0, 6, 10, 5,  3,     "Intel (unknown type) (Comet Lake-H/S G1)");
-   FMSQ(    0, 6, 10, 5,  4, dc, "Intel Core i*-10000 (Comet Lake-H/S P1)");
-   FMS (    0, 6, 10, 5,  4,     "Intel (unknown type) (Comet Lake-H/S P1)");
-   FMSQ(    0, 6, 10, 5,  5, dc, "Intel Core i*-10000 (Comet Lake-H/S Q0)");
-   FMS (    0, 6, 10, 5,  5,     "Intel (unknown type) (Comet Lake-H/S Q0)");
-   FMQ (    0, 6, 10, 5,     dc, "Intel Core i*-10000 (Comet Lake-H/S)");
-   FM  (    0, 6, 10, 5,         "Intel (unknown type) (Comet Lake-H/S)");
+   FMSQ(    0, 6, 10, 5,  0, dc, "Intel Core i*-10000 (Comet Lake-H/S G0)")
+   FMS (    0, 6, 10, 5,  0,     "Intel (unknown type) (Comet Lake-H/S G0)")
+   FMSQ(    0, 6, 10, 5,  1, dc, "Intel Core i*-10000 (Comet Lake-H/S P0)")
+   FMS (    0, 6, 10, 5,  1,     "Intel (unknown type) (Comet Lake-H/S P0)")
+   FMSQ(    0, 6, 10, 5,  2, dc, "Intel Core i*-10000 (Comet Lake-H/S R1)")
+   FMS (    0, 6, 10, 5,  2,     "Intel (unknown type) (Comet Lake-H/S R1)")
+   FMSQ(    0, 6, 10, 5,  3, dc, "Intel Core i*-10000 (Comet Lake-H/S G1)")
+   FMS (    0, 6, 10, 5,  3,     "Intel (unknown type) (Comet Lake-H/S G1)")
+   FMSQ(    0, 6, 10, 5,  4, dc, "Intel Core i*-10000 (Comet Lake-H/S P1)")
+   FMS (    0, 6, 10, 5,  4,     "Intel (unknown type) (Comet Lake-H/S P1)")
+   FMSQ(    0, 6, 10, 5,  5, dc, "Intel Core i*-10000 (Comet Lake-H/S Q0)")
+   FMS (    0, 6, 10, 5,  5,     "Intel (unknown type) (Comet Lake-H/S Q0)")
+   FMQ (    0, 6, 10, 5,     dc, "Intel Core i*-10000 (Comet Lake-H/S)")
+   FM  (    0, 6, 10, 5,         "Intel (unknown type) (Comet Lake-H/S)")
    // (615213) provides steppings.
    // MRG* 2019-11-13 & instlatx64 example
    // Coreboot* provides steppings.
-   FMS (    0, 6, 10, 6,  0,     "Intel Core i*-10000 (Comet Lake-U A0)");
-   FMS (    0, 6, 10, 6,  1,     "Intel Core i*-10000 (Comet Lake-U K0/K1/S0)");
-   FMS (    0, 6, 10, 6,  2,     "Intel Core i*-10000 (Comet Lake-H R1)");
-   FMS (    0, 6, 10, 6,  3,     "Intel Core i*-10000 (Comet Lake-S G1)");
-   FMS (    0, 6, 10, 6,  5,     "Intel Core i*-10000 (Comet Lake-S Q0)");
-   FM  (    0, 6, 10, 6,         "Intel Core i*-10000 (Comet Lake)");
-   FM  (    0, 6, 10, 7,         "Intel (unknown type) (Rocket Lake)");
-   FQ  (    0, 6,            sX, "Intel Xeon (unknown model)");
-   FQ  (    0, 6,            se, "Intel Xeon (unknown model)");
-   FQ  (    0, 6,            MC, "Intel Mobile Celeron (unknown model)");
-   FQ  (    0, 6,            dC, "Intel Celeron (unknown model)");
-   FQ  (    0, 6,            Xc, "Intel Core Extreme (unknown model)");
-   FQ  (    0, 6,            Mc, "Intel Mobile Core (unknown model)");
-   FQ  (    0, 6,            dc, "Intel Core (unknown model)");
-   FQ  (    0, 6,            MP, "Intel Mobile Pentium (unknown model)");
-   FQ  (    0, 6,            dP, "Intel Pentium (unknown model)");
-   F   (    0, 6,                "Intel (unknown model)");
+   FMS (    0, 6, 10, 6,  0,     "Intel Core i*-10000 (Comet Lake-U A0)")
+   FMS (    0, 6, 10, 6,  1,     "Intel Core i*-10000 (Comet Lake-U K0/K1/S0)")
+   FMS (    0, 6, 10, 6,  2,     "Intel Core i*-10000 (Comet Lake-H R1)")
+   FMS (    0, 6, 10, 6,  3,     "Intel Core i*-10000 (Comet Lake-S G1)")
+   FMS (    0, 6, 10, 6,  5,     "Intel Core i*-10000 (Comet Lake-S Q0)")
+   FM  (    0, 6, 10, 6,         "Intel Core i*-10000 (Comet Lake)")
+   FM  (    0, 6, 10, 7,         "Intel (unknown type) (Rocket Lake)")
+   FQ  (    0, 6,            sX, "Intel Xeon (unknown model)")
+   FQ  (    0, 6,            se, "Intel Xeon (unknown model)")
+   FQ  (    0, 6,            MC, "Intel Mobile Celeron (unknown model)")
+   FQ  (    0, 6,            dC, "Intel Celeron (unknown model)")
+   FQ  (    0, 6,            Xc, "Intel Core Extreme (unknown model)")
+   FQ  (    0, 6,            Mc, "Intel Mobile Core (unknown model)")
+   FQ  (    0, 6,            dc, "Intel Core (unknown model)")
+   FQ  (    0, 6,            MP, "Intel Mobile Pentium (unknown model)")
+   FQ  (    0, 6,            dP, "Intel Pentium (unknown model)")
+   F   (    0, 6,                "Intel (unknown model)")
    // Intel docs (249720).
-   FMS (    0, 7,  0, 0,  6,     "Intel Itanium (Merced C0)");
-   FMS (    0, 7,  0, 0,  7,     "Intel Itanium (Merced C1)");
-   FMS (    0, 7,  0, 0,  8,     "Intel Itanium (Merced C2)");
-   F   (    0, 7,                "Intel Itanium (unknown model)");
-   FM  (    0,11,  0, 0,         "Intel Xeon Phi x100 Coprocessor (Knights Ferry)"); // found only on en.wikichip.org
+   FMS (    0, 7,  0, 0,  6,     "Intel Itanium (Merced C0)")
+   FMS (    0, 7,  0, 0,  7,     "Intel Itanium (Merced C1)")
+   FMS (    0, 7,  0, 0,  8,     "Intel Itanium (Merced C2)")
+   F   (    0, 7,                "Intel Itanium (unknown model)")
+   FM  (    0,11,  0, 0,         "Intel Xeon Phi x100 Coprocessor (Knights Ferry)") // found only on en.wikichip.org
    // Intel docs (328205).
-   FMS (    0,11,  0, 1,  1,     "Intel Xeon Phi x100 Coprocessor (Knights Corner B0)");
-   FMS (    0,11,  0, 1,  3,     "Intel Xeon Phi x100 Coprocessor (Knights Corner B1)");
-   FMS (    0,11,  0, 1,  4,     "Intel Xeon Phi x100 Coprocessor (Knights Corner C0)");
-   FM  (    0,11,  0, 1,         "Intel Xeon Phi x100 Coprocessor (Knights Corner)");
+   FMS (    0,11,  0, 1,  1,     "Intel Xeon Phi x100 Coprocessor (Knights Corner B0)")
+   FMS (    0,11,  0, 1,  3,     "Intel Xeon Phi x100 Coprocessor (Knights Corner B1)")
+   FMS (    0,11,  0, 1,  4,     "Intel Xeon Phi x100 Coprocessor (Knights Corner C0)")
+   FM  (    0,11,  0, 1,         "Intel Xeon Phi x100 Coprocessor (Knights Corner)")
    // Intel docs (249199, 249678).
-   FMS (    0,15,  0, 0,  7,     "Intel Pentium 4 (Willamette B2)");
-   FMSQ(    0,15,  0, 0, 10, dP, "Intel Pentium 4 (Willamette C1)");
-   FMSQ(    0,15,  0, 0, 10, sX, "Intel Xeon (Foster C1)");
-   FMS (    0,15,  0, 0, 10,     "Intel Pentium 4 (unknown type) 4 (Willamette/Foster C1)");
-   FMQ (    0,15,  0, 0,     dP, "Intel Pentium 4 (Willamette)");
-   FMQ (    0,15,  0, 0,     sX, "Intel Xeon (Foster)");
-   FM  (    0,15,  0, 0,         "Intel Pentium 4 (unknown type) (Willamette/Foster)");
+   FMS (    0,15,  0, 0,  7,     "Intel Pentium 4 (Willamette B2)")
+   FMSQ(    0,15,  0, 0, 10, dP, "Intel Pentium 4 (Willamette C1)")
+   FMSQ(    0,15,  0, 0, 10, sX, "Intel Xeon (Foster C1)")
+   FMS (    0,15,  0, 0, 10,     "Intel Pentium 4 (unknown type) 4 (Willamette/Foster C1)")
+   FMQ (    0,15,  0, 0,     dP, "Intel Pentium 4 (Willamette)")
+   FMQ (    0,15,  0, 0,     sX, "Intel Xeon (Foster)")
+   FM  (    0,15,  0, 0,         "Intel Pentium 4 (unknown type) (Willamette/Foster)")
    // Intel docs (249199, 249678, 290741, 290749).
-   FMS (    0,15,  0, 1,  1,     "Intel Xeon MP (Foster C0)");
-   FMSQ(    0,15,  0, 1,  2, dP, "Intel Pentium 4 (Willamette D0)");
-   FMSQ(    0,15,  0, 1,  2, sX, "Intel Xeon (Foster D0)");
-   FMS (    0,15,  0, 1,  2,     "Intel Pentium 4 (unknown type) (Willamette/Foster D0)");
-   FMSQ(    0,15,  0, 1,  3, dP, "Intel Pentium 4(Willamette E0)");
-   FMSQ(    0,15,  0, 1,  3, dC, "Intel Celeron 478-pin (Willamette E0)");
-   FMS (    0,15,  0, 1,  3,     "Intel Pentium 4 (unknown type) (Willamette/Foster E0)");
-   FMQ (    0,15,  0, 1,     dP, "Intel Pentium 4 (Willamette)");
-   FMQ (    0,15,  0, 1,     sX, "Intel Xeon (Foster)");
-   FM  (    0,15,  0, 1,         "Intel Pentium 4 (unknown type) (Willamette/Foster)");
+   FMS (    0,15,  0, 1,  1,     "Intel Xeon MP (Foster C0)")
+   FMSQ(    0,15,  0, 1,  2, dP, "Intel Pentium 4 (Willamette D0)")
+   FMSQ(    0,15,  0, 1,  2, sX, "Intel Xeon (Foster D0)")
+   FMS (    0,15,  0, 1,  2,     "Intel Pentium 4 (unknown type) (Willamette/Foster D0)")
+   FMSQ(    0,15,  0, 1,  3, dP, "Intel Pentium 4(Willamette E0)")
+   FMSQ(    0,15,  0, 1,  3, dC, "Intel Celeron 478-pin (Willamette E0)")
+   FMS (    0,15,  0, 1,  3,     "Intel Pentium 4 (unknown type) (Willamette/Foster E0)")
+   FMQ (    0,15,  0, 1,     dP, "Intel Pentium 4 (Willamette)")
+   FMQ (    0,15,  0, 1,     sX, "Intel Xeon (Foster)")
+   FM  (    0,15,  0, 1,         "Intel Pentium 4 (unknown type) (Willamette/Foster)")
    // Intel docs (249199, 249678, 250721, 251309, 253176, 290741, 290749).
-   FMS (    0,15,  0, 2,  2,     "Intel Xeon MP (Gallatin A0)");
-   FMSQ(    0,15,  0, 2,  4, sX, "Intel Xeon (Prestonia B0)");
-   FMSQ(    0,15,  0, 2,  4, MM, "Intel Mobile Pentium 4 Processor-M (Northwood B0)");
-   FMSQ(    0,15,  0, 2,  4, MC, "Intel Mobile Celeron (Northwood B0)");
-   FMSQ(    0,15,  0, 2,  4, dP, "Intel Pentium 4 (Northwood B0)");
-   FMS (    0,15,  0, 2,  4,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia B0)");
-   FMSQ(    0,15,  0, 2,  5, dP, "Intel Pentium 4 (Northwood B1/M0)");
-   FMSQ(    0,15,  0, 2,  5, sM, "Intel Xeon MP (Gallatin B1)");
-   FMSQ(    0,15,  0, 2,  5, sX, "Intel Xeon (Prestonia B1)");
-   FMS (    0,15,  0, 2,  5,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin B1/M0)");
-   FMS (    0,15,  0, 2,  6,     "Intel Xeon MP (Gallatin C0)");
-   FMSQ(    0,15,  0, 2,  7, sX, "Intel Xeon (Prestonia C1)");
-   FMSQ(    0,15,  0, 2,  7, dC, "Intel Celeron 478-pin (Northwood C1)");
-   FMSQ(    0,15,  0, 2,  7, MC, "Intel Mobile Celeron (Northwood C1)");
-   FMSQ(    0,15,  0, 2,  7, MM, "Intel Mobile Pentium 4 Processor-M (Northwood C1)");
-   FMSQ(    0,15,  0, 2,  7, dP, "Intel Pentium 4 (Northwood C1)");
-   FMS (    0,15,  0, 2,  7,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia C1)");
-   FMSQ(    0,15,  0, 2,  9, sX, "Intel Xeon (Prestonia D1)");
-   FMSQ(    0,15,  0, 2,  9, dC, "Intel Celeron 478-pin (Northwood D1)");
-   FMSQ(    0,15,  0, 2,  9, MC, "Intel Mobile Celeron (Northwood D1)");
-   FMSQ(    0,15,  0, 2,  9, MM, "Intel Mobile Pentium 4 Processor-M (Northwood D1)");
-   FMSQ(    0,15,  0, 2,  9, MP, "Intel Mobile Pentium 4 (Northwood D1)");
-   FMSQ(    0,15,  0, 2,  9, dP, "Intel Pentium 4 (Northwood D1)");
-   FMS (    0,15,  0, 2,  9,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia D1)");
-   FMQ (    0,15,  0, 2,     dP, "Intel Pentium 4 (Northwood)");
-   FMQ (    0,15,  0, 2,     sM, "Intel Xeon MP (Gallatin)");
-   FMQ (    0,15,  0, 2,     sX, "Intel Xeon (Prestonia)");
-   FM  (    0,15,  0, 2,         "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin)");
+   FMS (    0,15,  0, 2,  2,     "Intel Xeon MP (Gallatin A0)")
+   FMSQ(    0,15,  0, 2,  4, sX, "Intel Xeon (Prestonia B0)")
+   FMSQ(    0,15,  0, 2,  4, MM, "Intel Mobile Pentium 4 Processor-M (Northwood B0)")
+   FMSQ(    0,15,  0, 2,  4, MC, "Intel Mobile Celeron (Northwood B0)")
+   FMSQ(    0,15,  0, 2,  4, dP, "Intel Pentium 4 (Northwood B0)")
+   FMS (    0,15,  0, 2,  4,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia B0)")
+   FMSQ(    0,15,  0, 2,  5, dP, "Intel Pentium 4 (Northwood B1/M0)")
+   FMSQ(    0,15,  0, 2,  5, sM, "Intel Xeon MP (Gallatin B1)")
+   FMSQ(    0,15,  0, 2,  5, sX, "Intel Xeon (Prestonia B1)")
+   FMS (    0,15,  0, 2,  5,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin B1/M0)")
+   FMS (    0,15,  0, 2,  6,     "Intel Xeon MP (Gallatin C0)")
+   FMSQ(    0,15,  0, 2,  7, sX, "Intel Xeon (Prestonia C1)")
+   FMSQ(    0,15,  0, 2,  7, dC, "Intel Celeron 478-pin (Northwood C1)")
+   FMSQ(    0,15,  0, 2,  7, MC, "Intel Mobile Celeron (Northwood C1)")
+   FMSQ(    0,15,  0, 2,  7, MM, "Intel Mobile Pentium 4 Processor-M (Northwood C1)")
+   FMSQ(    0,15,  0, 2,  7, dP, "Intel Pentium 4 (Northwood C1)")
+   FMS (    0,15,  0, 2,  7,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia C1)")
+   FMSQ(    0,15,  0, 2,  9, sX, "Intel Xeon (Prestonia D1)")
+   FMSQ(    0,15,  0, 2,  9, dC, "Intel Celeron 478-pin (Northwood D1)")
+   FMSQ(    0,15,  0, 2,  9, MC, "Intel Mobile Celeron (Northwood D1)")
+   FMSQ(    0,15,  0, 2,  9, MM, "Intel Mobile Pentium 4 Processor-M (Northwood D1)")
+   FMSQ(    0,15,  0, 2,  9, MP, "Intel Mobile Pentium 4 (Northwood D1)")
+   FMSQ(    0,15,  0, 2,  9, dP, "Intel Pentium 4 (Northwood D1)")
+   FMS (    0,15,  0, 2,  9,     "Intel Pentium 4 (unknown type) (Northwood/Prestonia D1)")
+   FMQ (    0,15,  0, 2,     dP, "Intel Pentium 4 (Northwood)")
+   FMQ (    0,15,  0, 2,     sM, "Intel Xeon MP (Gallatin)")
+   FMQ (    0,15,  0, 2,     sX, "Intel Xeon (Prestonia)")
+   FM  (    0,15,  0, 2,         "Intel Pentium 4 (unknown type) (Northwood/Prestonia/Gallatin)")
    // Intel docs (302352, 302402, 302403, 302441).
-   FMSQ(    0,15,  0, 3,  3, dP, "Intel Pentium 4 (Prescott C0)");
-   FMSQ(    0,15,  0, 3,  3, dC, "Intel Celeron D (Prescott C0)");
-   FMS (    0,15,  0, 3,  3,     "Intel Pentium 4 (unknown type) (Prescott C0)");
-   FMSQ(    0,15,  0, 3,  4, sX, "Intel Xeon (Nocona D0)");
-   FMSQ(    0,15,  0, 3,  4, dC, "Intel Celeron D (Prescott D0)");
-   FMSQ(    0,15,  0, 3,  4, MP, "Intel Mobile Pentium 4 (Prescott D0)");
-   FMSQ(    0,15,  0, 3,  4, dP, "Intel Pentium 4 (Prescott D0)");
-   FMS (    0,15,  0, 3,  4,     "Intel Pentium 4 (unknown type) (Prescott/Nocona D0)");
-   FMQ (    0,15,  0, 3,     sX, "Intel Xeon (Nocona)");
-   FMQ(     0,15,  0, 3,     dC, "Intel Celeron D (Prescott)");
-   FMQ (    0,15,  0, 3,     MP, "Intel Mobile Pentium 4 (Prescott)");
-   FMQ (    0,15,  0, 3,     dP, "Intel Pentium 4 (Prescott)");
-   FM  (    0,15,  0, 3,         "Intel Pentium 4 (unknown type) (Prescott/Nocona)");
+   FMSQ(    0,15,  0, 3,  3, dP, "Intel Pentium 4 (Prescott C0)")
+   FMSQ(    0,15,  0, 3,  3, dC, "Intel Celeron D (Prescott C0)")
+   FMS (    0,15,  0, 3,  3,     "Intel Pentium 4 (unknown type) (Prescott C0)")
+   FMSQ(    0,15,  0, 3,  4, sX, "Intel Xeon (Nocona D0)")
+   FMSQ(    0,15,  0, 3,  4, dC, "Intel Celeron D (Prescott D0)")
+   FMSQ(    0,15,  0, 3,  4, MP, "Intel Mobile Pentium 4 (Prescott D0)")
+   FMSQ(    0,15,  0, 3,  4, dP, "Intel Pentium 4 (Prescott D0)")
+   FMS (    0,15,  0, 3,  4,     "Intel Pentium 4 (unknown type) (Prescott/Nocona D0)")
+   FMQ (    0,15,  0, 3,     sX, "Intel Xeon (Nocona)")
+   FMQ(     0,15,  0, 3,     dC, "Intel Celeron D (Prescott)")
+   FMQ (    0,15,  0, 3,     MP, "Intel Mobile Pentium 4 (Prescott)")
+   FMQ (    0,15,  0, 3,     dP, "Intel Pentium 4 (Prescott)")
+   FM  (    0,15,  0, 3,         "Intel Pentium 4 (unknown type) (Prescott/Nocona)")
    // Intel docs (302354, 306752, 306757, 306832, 309159, 309627).
-   FMSQ(    0,15,  0, 4,  1, sP, "Intel Xeon MP (Potomac C0)");
-   FMSQ(    0,15,  0, 4,  1, sM, "Intel Xeon MP (Cranford A0)");
-   FMSQ(    0,15,  0, 4,  1, sX, "Intel Xeon (Nocona E0)");
-   FMSQ(    0,15,  0, 4,  1, dC, "Intel Celeron D (Prescott E0)");
-   FMSQ(    0,15,  0, 4,  1, MP, "Intel Mobile Pentium 4 (Prescott E0)");
-   FMSQ(    0,15,  0, 4,  1, dP, "Intel Pentium 4 (Prescott E0)");
-   FMS (    0,15,  0, 4,  1,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Cranford/Potomac E0)");
-   FMSQ(    0,15,  0, 4,  3, sI, "Intel Xeon (Irwindale N0)");
-   FMSQ(    0,15,  0, 4,  3, sX, "Intel Xeon (Nocona N0)");
-   FMSQ(    0,15,  0, 4,  3, dP, "Intel Pentium 4 (Prescott N0)");
-   FMS (    0,15,  0, 4,  3,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale N0)");
-   FMSQ(    0,15,  0, 4,  4, dd, "Intel Pentium D Processor 8x0 (Smithfield A0)");
-   FMSQ(    0,15,  0, 4,  4, dG, "Intel Pentium Extreme Edition Processor 840 (Smithfield A0)");
-   FMS (    0,15,  0, 4,  4,     "Intel Pentium D (unknown type) (Smithfield A0)");
-   FMSQ(    0,15,  0, 4,  7, dd, "Intel Pentium D Processor 8x0 (Smithfield B0)");
-   FMSQ(    0,15,  0, 4,  7, dG, "Pentium Extreme Edition Processor 840 (Smithfield B0)");
-   FMS (    0,15,  0, 4,  7,     "Intel Pentium D (unknown type) (Smithfield B0)");
-   FMSQ(    0,15,  0, 4,  8, s7, "Intel Dual-Core Xeon Processor 7000 (Paxville A0)");
-   FMSQ(    0,15,  0, 4,  8, sX, "Intel Dual-Core Xeon (Paxville A0)");
-   FMS (    0,15,  0, 4,  8,     "Intel Dual-Core Xeon (unknown type) (Paxville A0)");
-   FMSQ(    0,15,  0, 4,  9, sM, "Intel Xeon MP (Cranford B0)");
-   FMSQ(    0,15,  0, 4,  9, dC, "Intel Celeron D (Prescott G1)");
-   FMSQ(    0,15,  0, 4,  9, dP, "Intel Pentium 4 (Prescott G1)");
-   FMS (    0,15,  0, 4,  9,     "Intel Pentium 4 (unknown type) (Prescott/Cranford G1)");
-   FMSQ(    0,15,  0, 4, 10, sI, "Intel Xeon (Irwindale R0)");
-   FMSQ(    0,15,  0, 4, 10, sX, "Intel Xeon (Nocona R0)");
-   FMSQ(    0,15,  0, 4, 10, dP, "Intel Pentium 4 (Prescott R0)");
-   FMS (    0,15,  0, 4, 10,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale R0)");
-   FMQ (    0,15,  0, 4,     sM, "Intel Xeon MP (Nocona/Potomac)");
-   FMQ (    0,15,  0, 4,     sX, "Intel Xeon (Nocona/Irwindale)");
-   FMQ (    0,15,  0, 4,     dC, "Intel Celeron D (Prescott)");
-   FMQ (    0,15,  0, 4,     MP, "Intel Mobile Pentium 4 (Prescott)");
-   FMQ (    0,15,  0, 4,     dd, "Intel Pentium D (Smithfield A0)");
-   FMQ (    0,15,  0, 4,     dP, "Intel Pentium 4 (Prescott) / Pentium Extreme Edition (Smithfield A0)");
-   FM  (    0,15,  0, 4,         "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale/Smithfield/Cranford/Potomac)");
+   FMSQ(    0,15,  0, 4,  1, sP, "Intel Xeon MP (Potomac C0)")
+   FMSQ(    0,15,  0, 4,  1, sM, "Intel Xeon MP (Cranford A0)")
+   FMSQ(    0,15,  0, 4,  1, sX, "Intel Xeon (Nocona E0)")
+   FMSQ(    0,15,  0, 4,  1, dC, "Intel Celeron D (Prescott E0)")
+   FMSQ(    0,15,  0, 4,  1, MP, "Intel Mobile Pentium 4 (Prescott E0)")
+   FMSQ(    0,15,  0, 4,  1, dP, "Intel Pentium 4 (Prescott E0)")
+   FMS (    0,15,  0, 4,  1,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Cranford/Potomac E0)")
+   FMSQ(    0,15,  0, 4,  3, sI, "Intel Xeon (Irwindale N0)")
+   FMSQ(    0,15,  0, 4,  3, sX, "Intel Xeon (Nocona N0)")
+   FMSQ(    0,15,  0, 4,  3, dP, "Intel Pentium 4 (Prescott N0)")
+   FMS (    0,15,  0, 4,  3,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale N0)")
+   FMSQ(    0,15,  0, 4,  4, dd, "Intel Pentium D Processor 8x0 (Smithfield A0)")
+   FMSQ(    0,15,  0, 4,  4, dG, "Intel Pentium Extreme Edition Processor 840 (Smithfield A0)")
+   FMS (    0,15,  0, 4,  4,     "Intel Pentium D (unknown type) (Smithfield A0)")
+   FMSQ(    0,15,  0, 4,  7, dd, "Intel Pentium D Processor 8x0 (Smithfield B0)")
+   FMSQ(    0,15,  0, 4,  7, dG, "Pentium Extreme Edition Processor 840 (Smithfield B0)")
+   FMS (    0,15,  0, 4,  7,     "Intel Pentium D (unknown type) (Smithfield B0)")
+   FMSQ(    0,15,  0, 4,  8, s7, "Intel Dual-Core Xeon Processor 7000 (Paxville A0)")
+   FMSQ(    0,15,  0, 4,  8, sX, "Intel Dual-Core Xeon (Paxville A0)")
+   FMS (    0,15,  0, 4,  8,     "Intel Dual-Core Xeon (unknown type) (Paxville A0)")
+   FMSQ(    0,15,  0, 4,  9, sM, "Intel Xeon MP (Cranford B0)")
+   FMSQ(    0,15,  0, 4,  9, dC, "Intel Celeron D (Prescott G1)")
+   FMSQ(    0,15,  0, 4,  9, dP, "Intel Pentium 4 (Prescott G1)")
+   FMS (    0,15,  0, 4,  9,     "Intel Pentium 4 (unknown type) (Prescott/Cranford G1)")
+   FMSQ(    0,15,  0, 4, 10, sI, "Intel Xeon (Irwindale R0)")
+   FMSQ(    0,15,  0, 4, 10, sX, "Intel Xeon (Nocona R0)")
+   FMSQ(    0,15,  0, 4, 10, dP, "Intel Pentium 4 (Prescott R0)")
+   FMS (    0,15,  0, 4, 10,     "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale R0)")
+   FMQ (    0,15,  0, 4,     sM, "Intel Xeon MP (Nocona/Potomac)")
+   FMQ (    0,15,  0, 4,     sX, "Intel Xeon (Nocona/Irwindale)")
+   FMQ (    0,15,  0, 4,     dC, "Intel Celeron D (Prescott)")
+   FMQ (    0,15,  0, 4,     MP, "Intel Mobile Pentium 4 (Prescott)")
+   FMQ (    0,15,  0, 4,     dd, "Intel Pentium D (Smithfield A0)")
+   FMQ (    0,15,  0, 4,     dP, "Intel Pentium 4 (Prescott) / Pentium Extreme Edition (Smithfield A0)")
+   FM  (    0,15,  0, 4,         "Intel Pentium 4 (unknown type) (Prescott/Nocona/Irwindale/Smithfield/Cranford/Potomac)")
    // Intel docs (310307, 310309, 311827, 313065, 314554).
-   FMSQ(    0,15,  0, 6,  2, dd, "Intel Pentium D Processor 9xx (Presler B1)");
-   FMSQ(    0,15,  0, 6,  2, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill B1) / Pentium Extreme Edition Processor 955 (Presler B1)");
-   FMS (    0,15,  0, 6,  2,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler B1)");
-   FMSQ(    0,15,  0, 6,  4, dd, "Intel Pentium D Processor 9xx (Presler C1)");
-   FMSQ(    0,15,  0, 6,  4, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill C1) / Pentium Extreme Edition Processor 955 (Presler C1)");
-   FMSQ(    0,15,  0, 6,  4, dC, "Intel Celeron D Processor 34x/35x (Cedar Mill C1)");
-   FMSQ(    0,15,  0, 6,  4, sX, "Intel Xeon Processor 5000 (Dempsey C1)");
-   FMS (    0,15,  0, 6,  4,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey C1)");
-   FMSQ(    0,15,  0, 6,  5, dC, "Intel Celeron D Processor 36x (Cedar Mill D0)");
-   FMSQ(    0,15,  0, 6,  5, dd, "Intel Pentium D Processor 9xx (Presler D0)");
-   FMSQ(    0,15,  0, 6,  5, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill D0) / Pentium Extreme Edition Processor 955 (Presler D0)");
-   FMS (    0,15,  0, 6,  5,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler D0)");
-   FMS (    0,15,  0, 6,  8,     "Intel Xeon Processor 71x0 (Tulsa B0)");
-   FMQ (    0,15,  0, 6,     dd, "Intel Pentium D (Presler)");
-   FMQ (    0,15,  0, 6,     dP, "Intel Pentium 4 (Cedar Mill) / Pentium Extreme Edition (Presler)");
-   FMQ (    0,15,  0, 6,     dC, "Intel Celeron D (Cedar Mill)");
-   FMQ (    0,15,  0, 6,     sX, "Intel Xeon (Dempsey / Tulsa)");
-   FM  (    0,15,  0, 6,         "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey/Tulsa)");
-   FQ  (    0,15,            sM, "Intel Xeon MP (unknown model)");
-   FQ  (    0,15,            sX, "Intel Xeon (unknown model)");
-   FQ  (    0,15,            MC, "Intel Mobile Celeron (unknown model)");
-   FQ  (    0,15,            MC, "Intel Mobile Pentium 4 (unknown model)");
-   FQ  (    0,15,            MM, "Intel Mobile Pentium 4 Processor-M (unknown model)");
-   FQ  (    0,15,            dC, "Intel Celeron (unknown model)");
-   FQ  (    0,15,            dd, "Intel Pentium D (unknown model)");
-   FQ  (    0,15,            dP, "Intel Pentium 4 (unknown model)");
-   FQ  (    0,15,            dc, "Intel Pentium (unknown model)");
-   F   (    0,15,                "Intel Pentium 4 / Pentium D / Xeon / Xeon MP / Celeron / Celeron D (unknown model)");
+   FMSQ(    0,15,  0, 6,  2, dd, "Intel Pentium D Processor 9xx (Presler B1)")
+   FMSQ(    0,15,  0, 6,  2, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill B1) / Pentium Extreme Edition Processor 955 (Presler B1)")
+   FMS (    0,15,  0, 6,  2,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler B1)")
+   FMSQ(    0,15,  0, 6,  4, dd, "Intel Pentium D Processor 9xx (Presler C1)")
+   FMSQ(    0,15,  0, 6,  4, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill C1) / Pentium Extreme Edition Processor 955 (Presler C1)")
+   FMSQ(    0,15,  0, 6,  4, dC, "Intel Celeron D Processor 34x/35x (Cedar Mill C1)")
+   FMSQ(    0,15,  0, 6,  4, sX, "Intel Xeon Processor 5000 (Dempsey C1)")
+   FMS (    0,15,  0, 6,  4,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey C1)")
+   FMSQ(    0,15,  0, 6,  5, dC, "Intel Celeron D Processor 36x (Cedar Mill D0)")
+   FMSQ(    0,15,  0, 6,  5, dd, "Intel Pentium D Processor 9xx (Presler D0)")
+   FMSQ(    0,15,  0, 6,  5, dP, "Intel Pentium 4 Processor 6x1 (Cedar Mill D0) / Pentium Extreme Edition Processor 955 (Presler D0)")
+   FMS (    0,15,  0, 6,  5,     "Intel Pentium 4 (unknown type) (Cedar Mill/Presler D0)")
+   FMS (    0,15,  0, 6,  8,     "Intel Xeon Processor 71x0 (Tulsa B0)")
+   FMQ (    0,15,  0, 6,     dd, "Intel Pentium D (Presler)")
+   FMQ (    0,15,  0, 6,     dP, "Intel Pentium 4 (Cedar Mill) / Pentium Extreme Edition (Presler)")
+   FMQ (    0,15,  0, 6,     dC, "Intel Celeron D (Cedar Mill)")
+   FMQ (    0,15,  0, 6,     sX, "Intel Xeon (Dempsey / Tulsa)")
+   FM  (    0,15,  0, 6,         "Intel Pentium 4 (unknown type) (Cedar Mill/Presler/Dempsey/Tulsa)")
+   FQ  (    0,15,            sM, "Intel Xeon MP (unknown model)")
+   FQ  (    0,15,            sX, "Intel Xeon (unknown model)")
+   FQ  (    0,15,            MC, "Intel Mobile Celeron (unknown model)")
+   FQ  (    0,15,            MC, "Intel Mobile Pentium 4 (unknown model)")
+   FQ  (    0,15,            MM, "Intel Mobile Pentium 4 Processor-M (unknown model)")
+   FQ  (    0,15,            dC, "Intel Celeron (unknown model)")
+   FQ  (    0,15,            dd, "Intel Pentium D (unknown model)")
+   FQ  (    0,15,            dP, "Intel Pentium 4 (unknown model)")
+   FQ  (    0,15,            dc, "Intel Pentium (unknown model)")
+   F   (    0,15,                "Intel Pentium 4 / Pentium D / Xeon / Xeon MP / Celeron / Celeron D (unknown model)")
    // NOTE: Intel spec updates describe CPUID in Itanium Register 3 format:
    //    AAFFMMSSNN
    //    AA = archrev (not reported via CPUID instruction)
@@ -3536,761 +4120,776 @@ decode_synth_intel(unsigned int         val,  /* val_1_eax */
    //    SS = revision/stepping
    //    NN = number (not reported via CPUID instruction)
    // Intel docs (251141).
-   FMS (    1,15,  0, 0,  7,     "Intel Itanium2 (McKinley B3)");
-   FM  (    1,15,  0, 0,         "Intel Itanium2 (McKinley)");
+   FMS (    1,15,  0, 0,  7,     "Intel Itanium2 (McKinley B3)")
+   FM  (    1,15,  0, 0,         "Intel Itanium2 (McKinley)")
    // Intel docs (251141).
-   FMS (    1,15,  0, 1,  5,     "Intel Itanium2 (Madison/Deerfield/Hondo B1)");
-   FM  (    1,15,  0, 1,         "Intel Itanium2 (Madison/Deerfield/Hondo)");
+   FMS (    1,15,  0, 1,  5,     "Intel Itanium2 (Madison/Deerfield/Hondo B1)")
+   FM  (    1,15,  0, 1,         "Intel Itanium2 (Madison/Deerfield/Hondo)")
    // Intel docs (251141).
-   FMS (    1,15,  0, 2,  1,     "Intel Itanium2 (Madison 9M/Fanwood A1)");
-   FMS (    1,15,  0, 2,  2,     "Intel Itanium2 (Madison 9M/Fanwood A2)");
-   FM  (    1,15,  0, 2,         "Intel Itanium2 (Madison)");
-   F   (    1,15,                "Intel Itanium2 (unknown model)");
+   FMS (    1,15,  0, 2,  1,     "Intel Itanium2 (Madison 9M/Fanwood A1)")
+   FMS (    1,15,  0, 2,  2,     "Intel Itanium2 (Madison 9M/Fanwood A2)")
+   FM  (    1,15,  0, 2,         "Intel Itanium2 (Madison)")
+   F   (    1,15,                "Intel Itanium2 (unknown model)")
    // Intel docs (251141).
-   FMS (    2, 0,  0, 0,  5,     "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C1), 90nm");
-   FMS (    2, 0,  0, 0,  7,     "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C2), 90nm");
-   FM  (    2, 0,  0, 0,         "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington), 90nm");
+   FMS (    2, 0,  0, 0,  5,     "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C1), 90nm")
+   FMS (    2, 0,  0, 0,  7,     "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington C2), 90nm")
+   FM  (    2, 0,  0, 0,         "Intel Itanium2 Dual-Core Processor 9000 (Montecito/Millington), 90nm")
    // Intel docs (251141).
-   FMS (    2, 0,  0, 1,  1,     "Intel Itanium2 Dual-Core Processor 9100 (Montvale A1), 90nm");
-   FM  (    2, 0,  0, 1,         "Intel Itanium2 Dual-Core Processor 9100 (Montvale), 90nm");
+   FMS (    2, 0,  0, 1,  1,     "Intel Itanium2 Dual-Core Processor 9100 (Montvale A1), 90nm")
+   FM  (    2, 0,  0, 1,         "Intel Itanium2 Dual-Core Processor 9100 (Montvale), 90nm")
    // Intel docs (323169).
-   FMS (    2, 0,  0, 2,  4,     "Intel Itanium2 Processor 9300 (Tukwila E0), 65nm");
-   FM  (    2, 0,  0, 2,         "Intel Itanium2 Processor 9300 (Tukwila), 65nm");
-   F   (    2, 0,                "Intel Itanium2 (unknown model)");
+   FMS (    2, 0,  0, 2,  4,     "Intel Itanium2 Processor 9300 (Tukwila E0), 65nm")
+   FM  (    2, 0,  0, 2,         "Intel Itanium2 Processor 9300 (Tukwila), 65nm")
+   F   (    2, 0,                "Intel Itanium2 (unknown model)")
    // Intel docs (323169).
-   FMS (    2, 1,  0, 0,  4,     "Intel Itanium2 Processor 9500 (Poulson D0), 32nm");
-   FMS (    2, 1,  0, 0,  5,     "Intel Itanium2 Processor 9700 (Kittson E0), 22nm");
-   FM  (    2, 1,  0, 0,         "Intel Itanium2 (unknown model) (Poulson/Kittson)");
-   F   (    2, 1,                "Intel Itanium2 (unknown model)");
-   DEFAULT                      ("unknown");
-
+   FMS (    2, 1,  0, 0,  4,     "Intel Itanium2 Processor 9500 (Poulson D0), 32nm")
+   FMS (    2, 1,  0, 0,  5,     "Intel Itanium2 Processor 9700 (Kittson E0), 22nm")
+   FM  (    2, 1,  0, 0,         "Intel Itanium2 (unknown model) (Poulson/Kittson)")
+   F   (    2, 1,                "Intel Itanium2 (unknown model)")
+   };
+   static synth_family_t  families[SYNTH_MAX_FAMILIES];
+   static unsigned int    family_count = 0;
+
+   cstring  result = synth_table_lookup(table, LENGTH(table),
+                                        families, &family_count,
+                                        val, stash);
+   if (result == NULL) {
+      result = "unknown";
+   }
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_amd(unsigned int         val,
                  const code_stash_t*  stash)
 {
-   cstring  result = NULL;
-   
-   START;
-   FM  ( 0, 4,  0, 3,         "AMD 80486DX2");
-   FM  ( 0, 4,  0, 7,         "AMD 80486DX2WB");
-   FM  ( 0, 4,  0, 8,         "AMD 80486DX4");
-   FM  ( 0, 4,  0, 9,         "AMD 80486DX4WB");
-   FM  ( 0, 4,  0,10,         "AMD Elan SC400"); // sandpile.org
-   FM  ( 0, 4,  0,14,         "AMD 5x86");
-   FM  ( 0, 4,  0,15,         "AMD 5xWB");
-   F   ( 0, 4,                "AMD 80486 / 5x (unknown model)");
-   FM  ( 0, 5,  0, 0,         "AMD SSA5 (PR75, PR90, PR100)");
-   FM  ( 0, 5,  0, 1,         "AMD 5k86 (PR120, PR133)");
-   FM  ( 0, 5,  0, 2,         "AMD 5k86 (PR166)");
-   FM  ( 0, 5,  0, 3,         "AMD 5k86 (PR200)");
-   FM  ( 0, 5,  0, 5,         "AMD Geode GX");
-   FM  ( 0, 5,  0, 6,         "AMD K6");
-   FM  ( 0, 5,  0, 7,         "AMD K6 (Little Foot)");
-   FMS ( 0, 5,  0, 8,  0,     "AMD K6-2 (Chomper A)");
-   FMS ( 0, 5,  0, 8, 12,     "AMD K6-2 (Chomper A)");
-   FM  ( 0, 5,  0, 8,         "AMD K6-2 (Chomper)");
-   FMS ( 0, 5,  0, 9,  1,     "AMD K6-III (Sharptooth B)");
-   FM  ( 0, 5,  0, 9,         "AMD K6-III (Sharptooth)");
-   FM  ( 0, 5,  0,10,         "AMD Geode LX");
-   FM  ( 0, 5,  0,13,         "AMD K6-2+, K6-III+");
-   F   ( 0, 5,                "AMD 5k86 / K6 / Geode (unknown model)");
-   FM  ( 0, 6,  0, 1,         "AMD Athlon (Argon)");
-   FM  ( 0, 6,  0, 2,         "AMD Athlon (K75 / Pluto / Orion)");
-   FMS ( 0, 6,  0, 3,  0,     "AMD Duron / mobile Duron (Spitfire A0)");
-   FMS ( 0, 6,  0, 3,  1,     "AMD Duron / mobile Duron (Spitfire A2)");
-   FM  ( 0, 6,  0, 3,         "AMD Duron / mobile Duron (Spitfire)");
-   FMS ( 0, 6,  0, 4,  2,     "AMD Athlon (Thunderbird A4-A7)");
-   FMS ( 0, 6,  0, 4,  4,     "AMD Athlon (Thunderbird A9)");
-   FM  ( 0, 6,  0, 4,         "AMD Athlon (Thunderbird)");
-   FMSQ( 0, 6,  0, 6,  0, sA, "AMD Athlon MP (Palomino A0)");
-   FMSQ( 0, 6,  0, 6,  0, dA, "AMD Athlon (Palomino A0)");
-   FMSQ( 0, 6,  0, 6,  0, MA, "AMD mobile Athlon 4 (Palomino A0)");
-   FMSQ( 0, 6,  0, 6,  0, sD, "AMD Duron MP (Palomino A0)");
-   FMSQ( 0, 6,  0, 6,  0, MD, "AMD mobile Duron (Palomino A0)");
-   FMS ( 0, 6,  0, 6,  0,     "AMD Athlon (unknown type)  (Palomino A0)");
-   FMSQ( 0, 6,  0, 6,  1, sA, "AMD Athlon MP (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  1, dA, "AMD Athlon (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  1, MA, "AMD mobile Athlon 4 (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  1, sD, "AMD Duron MP (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  1, MD, "AMD mobile Duron (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  1, dD, "AMD Duron (Palomino A2)");
-   FMS ( 0, 6,  0, 6,  1,     "AMD Athlon (unknown type) (Palomino A2)");
-   FMSQ( 0, 6,  0, 6,  2, sA, "AMD Athlon MP (Palomino A5)");
-   FMSQ( 0, 6,  0, 6,  2, dX, "AMD Athlon XP (Palomino A5)");
-   FMSQ( 0, 6,  0, 6,  2, MA, "AMD mobile Athlon 4 (Palomino A5)");
-   FMSQ( 0, 6,  0, 6,  2, sD, "AMD Duron MP (Palomino A5)");
-   FMSQ( 0, 6,  0, 6,  2, MD, "AMD mobile Duron (Palomino A5)");
-   FMSQ( 0, 6,  0, 6,  2, dD, "AMD Duron (Palomino A5)");
-   FMS ( 0, 6,  0, 6,  2,     "AMD Athlon (unknown type) (Palomino A5)");
-   FMQ ( 0, 6,  0, 6,     MD, "AMD mobile Duron (Palomino)");
-   FMQ ( 0, 6,  0, 6,     dD, "AMD Duron (Palomino)");
-   FMQ ( 0, 6,  0, 6,     MA, "AMD mobile Athlon (Palomino)");
-   FMQ ( 0, 6,  0, 6,     dX, "AMD Athlon XP (Palomino)");
-   FMQ ( 0, 6,  0, 6,     dA, "AMD Athlon (Palomino)");
-   FM  ( 0, 6,  0, 6,         "AMD Athlon (unknown type) (Palomino)");
-   FMSQ( 0, 6,  0, 7,  0, sD, "AMD Duron MP (Morgan A0)");
-   FMSQ( 0, 6,  0, 7,  0, MD, "AMD mobile Duron (Morgan A0)");
-   FMSQ( 0, 6,  0, 7,  0, dD, "AMD Duron (Morgan A0)");
-   FMS ( 0, 6,  0, 7,  0,     "AMD Duron (unknown type)  (Morgan A0)");
-   FMSQ( 0, 6,  0, 7,  1, sD, "AMD Duron MP (Morgan A1)");
-   FMSQ( 0, 6,  0, 7,  1, MD, "AMD mobile Duron (Morgan A1)");
-   FMSQ( 0, 6,  0, 7,  1, dD, "AMD Duron (Morgan A1)");
-   FMS ( 0, 6,  0, 7,  1,     "AMD Duron (unknown type)  (Morgan A1)");
-   FMQ ( 0, 6,  0, 7,     sD, "AMD Duron MP (Morgan)");
-   FMQ ( 0, 6,  0, 7,     MD, "AMD mobile Duron (Morgan)");
-   FMQ ( 0, 6,  0, 7,     dD, "AMD Duron (Morgan)");
-   FM  ( 0, 6,  0, 7,         "AMD Duron (unknown type)  (Morgan)");
-   FMSQ( 0, 6,  0, 8,  0, dS, "AMD Sempron (Thoroughbred A0)");
-   FMSQ( 0, 6,  0, 8,  0, sD, "AMD Duron MP (Applebred A0)");
-   FMSQ( 0, 6,  0, 8,  0, dD, "AMD Duron (Applebred A0)");
-   FMSQ( 0, 6,  0, 8,  0, MX, "AMD mobile Athlon XP (Thoroughbred A0)");
-   FMSQ( 0, 6,  0, 8,  0, sA, "AMD Athlon MP (Thoroughbred A0)");
-   FMSQ( 0, 6,  0, 8,  0, dX, "AMD Athlon XP (Thoroughbred A0)");
-   FMSQ( 0, 6,  0, 8,  0, dA, "AMD Athlon (Thoroughbred A0)");
-   FMS ( 0, 6,  0, 8,  0,     "AMD Athlon (unknown type) (Thoroughbred A0)");
-   FMSQ( 0, 6,  0, 8,  1, MG, "AMD Geode NX (Thoroughbred B0)");
-   FMSQ( 0, 6,  0, 8,  1, dS, "AMD Sempron (Thoroughbred B0)");
-   FMSQ( 0, 6,  0, 8,  1, sD, "AMD Duron MP (Applebred B0)");
-   FMSQ( 0, 6,  0, 8,  1, dD, "AMD Duron (Applebred B0)");
-   FMSQ( 0, 6,  0, 8,  1, sA, "AMD Athlon MP (Thoroughbred B0)");
-   FMSQ( 0, 6,  0, 8,  1, dX, "AMD Athlon XP (Thoroughbred B0)");
-   FMSQ( 0, 6,  0, 8,  1, dA, "AMD Athlon (Thoroughbred B0)");
-   FMS ( 0, 6,  0, 8,  1,     "AMD Athlon (unknown type) (Thoroughbred B0)");
-   FMQ ( 0, 6,  0, 8,     MG, "AMD Geode NX (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     dS, "AMD Sempron (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     sD, "AMD Duron MP (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     dD, "AMD Duron (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     MX, "AMD mobile Athlon XP (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     sA, "AMD Athlon MP (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     dX, "AMD Athlon XP (Thoroughbred)");
-   FMQ ( 0, 6,  0, 8,     dA, "AMD Athlon XP (Thoroughbred)");
-   FM  ( 0, 6,  0, 8,         "AMD Athlon (unknown type) (Thoroughbred)");
-   FMSQ( 0, 6,  0,10,  0, dS, "AMD Sempron (Barton A2)");
-   FMSQ( 0, 6,  0,10,  0, ML, "AMD mobile Athlon XP-M (LV) (Barton A2)");
-   FMSQ( 0, 6,  0,10,  0, MX, "AMD mobile Athlon XP-M (Barton A2)");
-   FMSQ( 0, 6,  0,10,  0, dt, "AMD Athlon XP (Thorton A2)");
-   FMSQ( 0, 6,  0,10,  0, sA, "AMD Athlon MP (Barton A2)");
-   FMSQ( 0, 6,  0,10,  0, dX, "AMD Athlon XP (Barton A2)");
-   FMS ( 0, 6,  0,10,  0,     "AMD Athlon (unknown type) (Barton A2)");
-   FMQ ( 0, 6,  0,10,     dS, "AMD Sempron (Barton)");
-   FMQ ( 0, 6,  0,10,     ML, "AMD mobile Athlon XP-M (LV) (Barton)");
-   FMQ ( 0, 6,  0,10,     MX, "AMD mobile Athlon XP-M (Barton)");
-   FMQ ( 0, 6,  0,10,     sA, "AMD Athlon MP (Barton)");
-   FMQ ( 0, 6,  0,10,     dX, "AMD Athlon XP (Barton)");
-   FM  ( 0, 6,  0,10,         "AMD Athlon (unknown type) (Barton)");
-   F   ( 0, 6,                "AMD Athlon (unknown model)");
-   F   ( 0, 7,                "AMD Opteron (unknown model)");
-   FMS ( 0,15,  0, 4,  0,     "AMD Athlon 64 (SledgeHammer SH7-B0)");
-   FMSQ( 0,15,  0, 4,  8, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-C0)");
-   FMSQ( 0,15,  0, 4,  8, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-C0)");
-   FMSQ( 0,15,  0, 4,  8, dA, "AMD Athlon 64 (SledgeHammer SH7-C0)");
-   FMS ( 0,15,  0, 4,  8,     "AMD Athlon 64 (unknown type) (SledgeHammer SH7-C0)");
-   FMSQ( 0,15,  0, 4, 10, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-CG)");
-   FMSQ( 0,15,  0, 4, 10, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-CG)");
-   FMSQ( 0,15,  0, 4, 10, dA, "AMD Athlon 64 (SledgeHammer SH7-CG)");
-   FMS ( 0,15,  0, 4, 10,     "AMD Athlon 64 (unknown type) (SledgeHammer SH7-CG)");
-   FMQ ( 0,15,  0, 4,     MX, "AMD mobile Athlon XP-M (SledgeHammer SH7)");
-   FMQ ( 0,15,  0, 4,     MA, "AMD mobile Athlon 64 (SledgeHammer SH7)");
-   FMQ ( 0,15,  0, 4,     dA, "AMD Athlon 64 (SledgeHammer SH7)");
-   FM  ( 0,15,  0, 4,         "AMD Athlon 64 (unknown type) (SledgeHammer SH7)");
-   FMS ( 0,15,  0, 5,  0,     "AMD Opteron (DP SledgeHammer SH7-B0)");
-   FMS ( 0,15,  0, 5,  1,     "AMD Opteron (DP SledgeHammer SH7-B3)");
-   FMSQ( 0,15,  0, 5,  8, sO, "AMD Opteron (DP SledgeHammer SH7-C0)");
-   FMSQ( 0,15,  0, 5,  8, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-C0)");
-   FMS ( 0,15,  0, 5,  8,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-C0)");
-   FMSQ( 0,15,  0, 5, 10, sO, "AMD Opteron (DP SledgeHammer SH7-CG)");
-   FMSQ( 0,15,  0, 5, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)");
-   FMS ( 0,15,  0, 5, 10,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)");
-   FMQ ( 0,15,  0, 5,     sO, "AMD Opteron (SledgeHammer SH7)");
-   FMQ ( 0,15,  0, 5,     dF, "AMD Athlon 64 FX (SledgeHammer SH7)");
-   FM  ( 0,15,  0, 5,         "AMD Athlon 64 (unknown type) (SledgeHammer SH7) FX");
-   FMSQ( 0,15,  0, 7, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)");
-   FMSQ( 0,15,  0, 7, 10, dA, "AMD Athlon 64 (DP SledgeHammer SH7-CG)");
-   FMS ( 0,15,  0, 7, 10,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)");
-   FMQ ( 0,15,  0, 7,     dF, "AMD Athlon 64 FX (DP SledgeHammer SH7)");
-   FMQ ( 0,15,  0, 7,     dA, "AMD Athlon 64 (DP SledgeHammer SH7)");
-   FM  ( 0,15,  0, 7,         "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7)");
-   FMSQ( 0,15,  0, 8,  2, MS, "AMD mobile Sempron (ClawHammer CH7-CG)");
-   FMSQ( 0,15,  0, 8,  2, MX, "AMD mobile Athlon XP-M (ClawHammer CH7-CG)");
-   FMSQ( 0,15,  0, 8,  2, MA, "AMD mobile Athlon 64 (Odessa CH7-CG)");
-   FMSQ( 0,15,  0, 8,  2, dA, "AMD Athlon 64 (ClawHammer CH7-CG)");
-   FMS ( 0,15,  0, 8,  2,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7-CG)");
-   FMQ ( 0,15,  0, 8,     MS, "AMD mobile Sempron (Odessa CH7)");
-   FMQ ( 0,15,  0, 8,     MX, "AMD mobile Athlon XP-M (Odessa CH7)");
-   FMQ ( 0,15,  0, 8,     MA, "AMD mobile Athlon 64 (Odessa CH7)");
-   FMQ ( 0,15,  0, 8,     dA, "AMD Athlon 64 (ClawHammer CH7)");
-   FM  ( 0,15,  0, 8,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7)");
-   FMS ( 0,15,  0,11,  2,     "AMD Athlon 64 (ClawHammer CH7-CG)");
-   FM  ( 0,15,  0,11,         "AMD Athlon 64 (ClawHammer CH7)");
-   FMSQ( 0,15,  0,12,  0, MS, "AMD mobile Sempron (Dublin DH7-CG)");
-   FMSQ( 0,15,  0,12,  0, dS, "AMD Sempron (Paris DH7-CG)");
-   FMSQ( 0,15,  0,12,  0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)");
-   FMSQ( 0,15,  0,12,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-   FMSQ( 0,15,  0,12,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-   FMS ( 0,15,  0,12,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)");
-   FMQ ( 0,15,  0,12,     MS, "AMD mobile Sempron (Dublin DH7)");
-   FMQ ( 0,15,  0,12,     dS, "AMD Sempron (Paris DH7)");
-   FMQ ( 0,15,  0,12,     MX, "AMD mobile Athlon XP-M (NewCastle DH7)");
-   FMQ ( 0,15,  0,12,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-   FMQ ( 0,15,  0,12,     dA, "AMD Athlon 64 (NewCastle DH7)");
-   FM  ( 0,15,  0,12,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)");
-   FMSQ( 0,15,  0,14,  0, MS, "AMD mobile Sempron (Dublin DH7-CG)");
-   FMSQ( 0,15,  0,14,  0, dS, "AMD Sempron (Paris DH7-CG)");
-   FMSQ( 0,15,  0,14,  0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)");
-   FMSQ( 0,15,  0,14,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-   FMSQ( 0,15,  0,14,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-   FMS ( 0,15,  0,14,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)");
-   FMQ ( 0,15,  0,14,     dS, "AMD Sempron (Paris DH7)");
-   FMQ ( 0,15,  0,14,     MS, "AMD mobile Sempron (Dublin DH7)");
-   FMQ ( 0,15,  0,14,     MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7)");
-   FMQ ( 0,15,  0,14,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-   FMQ ( 0,15,  0,14,     dA, "AMD Athlon 64 (NewCastle DH7)");
-   FM  ( 0,15,  0,14,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)");
-   FMSQ( 0,15,  0,15,  0, dS, "AMD Sempron (Paris DH7-CG)");
-   FMSQ( 0,15,  0,15,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)");
-   FMSQ( 0,15,  0,15,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)");
-   FMS ( 0,15,  0,15,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7-CG)");
-   FMQ ( 0,15,  0,15,     dS, "AMD Sempron (Paris DH7)");
-   FMQ ( 0,15,  0,15,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)");
-   FMQ ( 0,15,  0,15,     dA, "AMD Athlon 64 (NewCastle DH7)");
-   FM  ( 0,15,  0,15,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7)");
-   FMSQ( 0,15,  1, 4,  0, MX, "AMD mobile Athlon XP-M (Oakville SH7-D0)");
-   FMSQ( 0,15,  1, 4,  0, MA, "AMD mobile Athlon 64 (Oakville SH7-D0)");
-   FMSQ( 0,15,  1, 4,  0, dA, "AMD Athlon 64 (Winchester SH7-D0)");
-   FMS ( 0,15,  1, 4,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7-D0)");
-   FMQ ( 0,15,  1, 4,     MX, "AMD mobile Athlon XP-M (Oakville SH7)");
-   FMQ ( 0,15,  1, 4,     MA, "AMD mobile Athlon 64 (Oakville SH7)");
-   FMQ ( 0,15,  1, 4,     dA, "AMD Athlon 64 (Winchester SH7)");
-   FM  ( 0,15,  1, 4,         "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7)");
-   FMSQ( 0,15,  1, 5,  0, sO, "AMD Opteron (Winchester SH7-D0)");
-   FMSQ( 0,15,  1, 5,  0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)");
-   FMS ( 0,15,  1, 5,  0,     "AMD Athlon 64 (unknown type) (Winchester SH7-D0)");
-   FMQ ( 0,15,  1, 5,     sO, "AMD Opteron (Winchester SH7)");
-   FMQ ( 0,15,  1, 5,     dF, "AMD Athlon 64 FX (Winchester SH7)");
-   FM  ( 0,15,  1, 5,         "AMD Athlon 64 (unknown type) (Winchester SH7)");
-   FMSQ( 0,15,  1, 7,  0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)");
-   FMSQ( 0,15,  1, 7,  0, dA, "AMD Athlon 64 (Winchester SH7-D0)");
-   FMS ( 0,15,  1, 7,  0,     "AMD Athlon 64 (unknown type) (Winchester SH7-D0)");
-   FMQ ( 0,15,  1, 7,     dF, "AMD Athlon 64 FX (Winchester SH7)");
-   FMQ ( 0,15,  1, 7,     dA, "AMD Athlon 64 (Winchester SH7)");
-   FM  ( 0,15,  1, 7,         "AMD Athlon 64 (unknown type) (Winchester SH7)");
-   FMSQ( 0,15,  1, 8,  0, MS, "AMD mobile Sempron (Georgetown/Sonora CH-D0)");
-   FMSQ( 0,15,  1, 8,  0, MX, "AMD mobile Athlon XP-M (Oakville CH-D0)");
-   FMSQ( 0,15,  1, 8,  0, MA, "AMD mobile Athlon 64 (Oakville CH-D0)");
-   FMSQ( 0,15,  1, 8,  0, dA, "AMD Athlon 64 (Winchester CH-D0)");
-   FMS ( 0,15,  1, 8,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH-D0)");
-   FMQ ( 0,15,  1, 8,     MS, "AMD mobile Sempron (Georgetown/Sonora CH)");
-   FMQ ( 0,15,  1, 8,     MX, "AMD mobile Athlon XP-M (Oakville CH)");
-   FMQ ( 0,15,  1, 8,     MA, "AMD mobile Athlon 64 (Oakville CH)");
-   FMQ ( 0,15,  1, 8,     dA, "AMD Athlon 64 (Winchester CH)");
-   FM  ( 0,15,  1, 8,         "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH)");
-   FMS ( 0,15,  1,11,  0,     "AMD Athlon 64 (Winchester CH-D0)");
-   FM  ( 0,15,  1,11,         "AMD Athlon 64 (Winchester CH)");
-   FMSQ( 0,15,  1,12,  0, MS, "AMD mobile Sempron (Georgetown/Sonora DH8-D0)");
-   FMSQ( 0,15,  1,12,  0, dS, "AMD Sempron (Palermo DH8-D0)");
-   FMSQ( 0,15,  1,12,  0, MX, "AMD Athlon XP-M (Winchester DH8-D0)");
-   FMSQ( 0,15,  1,12,  0, MA, "AMD mobile Athlon 64 (Oakville DH8-D0)");
-   FMSQ( 0,15,  1,12,  0, dA, "AMD Athlon 64 (Winchester DH8-D0)");
-   FMS ( 0,15,  1,12,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora/Palermo DH8-D0)");
-   FMQ ( 0,15,  1,12,     MS, "AMD mobile Sempron (Georgetown/Sonora DH8)");
-   FMQ ( 0,15,  1,12,     dS, "AMD Sempron (Palermo DH8)");
-   FMQ ( 0,15,  1,12,     MX, "AMD Athlon XP-M (Winchester DH8)");
-   FMQ ( 0,15,  1,12,     MA, "AMD mobile Athlon 64 (Oakville DH8)");
-   FMQ ( 0,15,  1,12,     dA, "AMD Athlon 64 (Winchester DH8)");
-   FM  ( 0,15,  1,12,         "AMD Athlon 64 (Winchester/Oakville/Georgetown/Sonora/Palermo DH8)");
-   FMSQ( 0,15,  1,15,  0, dS, "AMD Sempron (Palermo DH8-D0)");
-   FMSQ( 0,15,  1,15,  0, dA, "AMD Athlon 64 (Winchester DH8-D0)");
-   FMS ( 0,15,  1,15,  0,     "AMD Athlon 64 (Winchester DH8-D0) / Sempron (Palermo DH8-D0)");
-   FMQ ( 0,15,  1,15,     dS, "AMD Sempron (Palermo DH8)");
-   FMQ ( 0,15,  1,15,     dA, "AMD Athlon 64 (Winchester DH8)");
-   FM  ( 0,15,  1,15,         "AMD Athlon 64 (unknown type) (Winchester/Palermo DH8)");
-   FMSQ( 0,15,  2, 1,  0, s8, "AMD Dual Core Opteron (Egypt JH-E1)");
-   FMSQ( 0,15,  2, 1,  0, sO, "AMD Dual Core Opteron (Italy JH-E1)");
-   FMS ( 0,15,  2, 1,  0,     "AMD Dual Core Opteron (Italy/Egypt JH-E1)");
-   FMSQ( 0,15,  2, 1,  2, s8, "AMD Dual Core Opteron (Egypt JH-E6)");
-   FMSQ( 0,15,  2, 1,  2, sO, "AMD Dual Core Opteron (Italy JH-E6)");
-   FMS ( 0,15,  2, 1,  2,     "AMD Dual Core Opteron (Italy/Egypt JH-E6)");
-   FMQ ( 0,15,  2, 1,     s8, "AMD Dual Core Opteron (Egypt JH)");
-   FMQ ( 0,15,  2, 1,     sO, "AMD Dual Core Opteron (Italy JH)");
-   FM  ( 0,15,  2, 1,         "AMD Dual Core Opteron (Italy/Egypt JH)");
-   FMSQ( 0,15,  2, 3,  2, DO, "AMD Dual Core Opteron (Denmark JH-E6)");
-   FMSQ( 0,15,  2, 3,  2, dF, "AMD Athlon 64 FX (Toledo JH-E6)");
-   FMSQ( 0,15,  2, 3,  2, dm, "AMD Athlon 64 X2 (Manchester JH-E6)");
-   FMSQ( 0,15,  2, 3,  2, dA, "AMD Athlon 64 X2 (Toledo JH-E6)");
-   FMS ( 0,15,  2, 3,  2,     "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH-E6)");
-   FMQ ( 0,15,  2, 3,     sO, "AMD Dual Core Opteron (Denmark JH)");
-   FMQ ( 0,15,  2, 3,     dF, "AMD Athlon 64 FX (Toledo JH)");
-   FMQ ( 0,15,  2, 3,     dm, "AMD Athlon 64 X2 (Manchester JH)");
-   FMQ ( 0,15,  2, 3,     dA, "AMD Athlon 64 X2 (Toledo JH)");
-   FM  ( 0,15,  2, 3,         "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH)");
-   FMSQ( 0,15,  2, 4,  2, MA, "AMD mobile Athlon 64 (Newark SH-E5)");
-   FMSQ( 0,15,  2, 4,  2, MT, "AMD mobile Turion (Lancaster/Richmond SH-E5)");
-   FMS ( 0,15,  2, 4,  2,     "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH-E5)");
-   FMQ ( 0,15,  2, 4,     MA, "AMD mobile Athlon 64 (Newark SH)");
-   FMQ ( 0,15,  2, 4,     MT, "AMD mobile Turion (Lancaster/Richmond SH)");
-   FM  ( 0,15,  2, 4,         "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH)");
-   FMQ ( 0,15,  2, 5,     s8, "AMD Opteron (Athens SH-E4)");
-   FMQ ( 0,15,  2, 5,     sO, "AMD Opteron (Troy SH-E4)");
-   FM  ( 0,15,  2, 5,         "AMD Opteron (Troy/Athens SH-E4)");
-   FMSQ( 0,15,  2, 7,  1, sO, "AMD Opteron (Venus SH-E4)");
-   FMSQ( 0,15,  2, 7,  1, dF, "AMD Athlon 64 FX (San Diego SH-E4)");
-   FMSQ( 0,15,  2, 7,  1, dA, "AMD Athlon 64 (San Diego SH-E4)");
-   FMS ( 0,15,  2, 7,  1,     "AMD Athlon 64 (unknown type) (Venus/San Diego SH-E4)");
-   FMQ ( 0,15,  2, 7,     sO, "AMD Opteron (San Diego SH)");
-   FMQ ( 0,15,  2, 7,     dF, "AMD Athlon 64 FX (San Diego SH)");
-   FMQ ( 0,15,  2, 7,     dA, "AMD Athlon 64 (San Diego SH)");
-   FM  ( 0,15,  2, 7,         "AMD Athlon 64 (unknown type) (San Diego SH)");
-   FM  ( 0,15,  2,11,         "AMD Athlon 64 X2 (Manchester BH-E4)");
-   FMS ( 0,15,  2,12,  0,     "AMD Sempron (Palermo DH-E3)");
-   FMSQ( 0,15,  2,12,  2, MS, "AMD mobile Sempron (Albany/Roma DH-E6)");
-   FMSQ( 0,15,  2,12,  2, dS, "AMD Sempron (Palermo DH-E6)");
-   FMSQ( 0,15,  2,12,  2, dA, "AMD Athlon 64 (Venice DH-E6)");
-   FMS ( 0,15,  2,12,  2,     "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH-E6)");
-   FMQ ( 0,15,  2,12,     MS, "AMD mobile Sempron (Albany/Roma DH)");
-   FMQ ( 0,15,  2,12,     dS, "AMD Sempron (Palermo DH)");
-   FMQ ( 0,15,  2,12,     dA, "AMD Athlon 64 (Venice DH)");
-   FM  ( 0,15,  2,12,         "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH)");
-   FMSQ( 0,15,  2,15,  0, dS, "AMD Sempron (Palermo DH-E3)");
-   FMSQ( 0,15,  2,15,  0, dA, "AMD Athlon 64 (Venice DH-E3)");
-   FMS ( 0,15,  2,15,  0,     "AMD Athlon 64 (Venice/Palermo DH-E3)");
-   FMSQ( 0,15,  2,15,  2, dS, "AMD Sempron (Palermo DH-E6)");
-   FMSQ( 0,15,  2,15,  2, dA, "AMD Athlon 64 (Venice DH-E6)");
-   FMS ( 0,15,  2,15,  2,     "AMD Athlon 64 (Venice/Palermo DH-E6)");
-   FMQ ( 0,15,  2,15,     dS, "AMD Sempron (Palermo DH)");
-   FMQ ( 0,15,  2,15,     dA, "AMD Athlon 64 (Venice DH)");
-   FM  ( 0,15,  2,15,         "AMD Athlon 64 (Venice/Palermo DH)");
-   FMS ( 0,15,  4, 1,  2,     "AMD Dual-Core Opteron (Santa Rosa JH-F2)");
-   FMS ( 0,15,  4, 1,  3,     "AMD Dual-Core Opteron (Santa Rosa JH-F3)");
-   FM  ( 0,15,  4, 1,         "AMD Dual-Core Opteron (Santa Rosa)");
-   FMSQ( 0,15,  4, 3,  2, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F2)");
-   FMSQ( 0,15,  4, 3,  2, sO, "AMD Opteron (Santa Rosa JH-F2)");
-   FMSQ( 0,15,  4, 3,  2, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F2)");
-   FMSQ( 0,15,  4, 3,  2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F2)");
-   FMS ( 0,15,  4, 3,  2,     "AMD Athlon 64 (unknown type) (Windsor JH-F2)");
-   FMSQ( 0,15,  4, 3,  3, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F3)");
-   FMSQ( 0,15,  4, 3,  3, sO, "AMD Opteron (Santa Rosa JH-F3)");
-   FMSQ( 0,15,  4, 3,  3, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)");
-   FMSQ( 0,15,  4, 3,  3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F3)");
-   FMS ( 0,15,  4, 3,  3,     "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa JH-F3)");
-   FMQ ( 0,15,  4, 3,     DO, "AMD Dual-Core Opteron (Santa Rosa)");
-   FMQ ( 0,15,  4, 3,     sO, "AMD Opteron (Santa Rosa)");
-   FMQ ( 0,15,  4, 3,     dF, "AMD Athlon 64 FX Dual-Core (Windsor)");
-   FMQ ( 0,15,  4, 3,     dA, "AMD Athlon 64 X2 Dual-Core (Windsor)");
-   FM  ( 0,15,  4, 3,         "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa)");
-   FMSQ( 0,15,  4, 8,  2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)");
-   FMSQ( 0,15,  4, 8,  2, Mt, "AMD Turion 64 X2 (Trinidad BH-F2)");
-   FMSQ( 0,15,  4, 8,  2, MT, "AMD Turion 64 X2 (Taylor BH-F2)");
-   FMS ( 0,15,  4, 8,  2,     "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad BH-F2)");
-   FMQ ( 0,15,  4, 8,     dA, "AMD Athlon 64 X2 Dual-Core (Windsor)");
-   FMQ ( 0,15,  4, 8,     Mt, "AMD Turion 64 X2 (Trinidad)");
-   FMQ ( 0,15,  4, 8,     MT, "AMD Turion 64 X2 (Taylor)");
-   FM  ( 0,15,  4, 8,         "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad)");
-   FMS ( 0,15,  4,11,  2,     "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)");
-   FM  ( 0,15,  4,11,         "AMD Athlon 64 X2 Dual-Core (Windsor)");
-   FMSQ( 0,15,  4,12,  2, MS, "AMD mobile Sempron (Keene BH-F2)");
-   FMSQ( 0,15,  4,12,  2, dS, "AMD Sempron (Manila BH-F2)");
-   FMSQ( 0,15,  4,12,  2, Mt, "AMD Turion (Trinidad BH-F2)");
-   FMSQ( 0,15,  4,12,  2, MT, "AMD Turion (Taylor BH-F2)");
-   FMSQ( 0,15,  4,12,  2, dA, "AMD Athlon 64 (Orleans BH-F2)"); 
-   FMS ( 0,15,  4,12,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad BH-F2)");
-   FMQ ( 0,15,  4,12,     MS, "AMD mobile Sempron (Keene)");
-   FMQ ( 0,15,  4,12,     dS, "AMD Sempron (Manila)");
-   FMQ ( 0,15,  4,12,     Mt, "AMD Turion (Trinidad)");
-   FMQ ( 0,15,  4,12,     MT, "AMD Turion (Taylor)");
-   FMQ ( 0,15,  4,12,     dA, "AMD Athlon 64 (Orleans)"); 
-   FM  ( 0,15,  4,12,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad)");
-   FMSQ( 0,15,  4,15,  2, MS, "AMD mobile Sempron (Keene DH-F2)");
-   FMSQ( 0,15,  4,15,  2, dS, "AMD Sempron (Manila DH-F2)");
-   FMSQ( 0,15,  4,15,  2, dA, "AMD Athlon 64 (Orleans DH-F2)");
-   FMS ( 0,15,  4,15,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)");
-   FMQ ( 0,15,  4,15,     MS, "AMD mobile Sempron (Keene)");
-   FMQ ( 0,15,  4,15,     dS, "AMD Sempron (Manila)");
-   FMQ ( 0,15,  4,15,     dA, "AMD Athlon 64 (Orleans)");
-   FM  ( 0,15,  4,15,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)");
-   FMS ( 0,15,  5,13,  3,     "AMD Opteron (Santa Rosa JH-F3)");
-   FM  ( 0,15,  5,13,         "AMD Opteron (Santa Rosa)");
-   FMSQ( 0,15,  5,15,  2, MS, "AMD mobile Sempron (Keene DH-F2)");
-   FMSQ( 0,15,  5,15,  2, dS, "AMD Sempron (Manila DH-F2)");
-   FMSQ( 0,15,  5,15,  2, dA, "AMD Athlon 64 (Orleans DH-F2)");
-   FMS ( 0,15,  5,15,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)");
-   FMS ( 0,15,  5,15,  3,     "AMD Athlon 64 (Orleans DH-F3)");
-   FMQ ( 0,15,  5,15,     MS, "AMD mobile Sempron (Keene)");
-   FMQ ( 0,15,  5,15,     dS, "AMD Sempron (Manila)");
-   FMQ ( 0,15,  5,15,     dA, "AMD Athlon 64 (Orleans)");
-   FM  ( 0,15,  5,15,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)");
-   FM  ( 0,15,  5,15,         "AMD Athlon 64 (Orleans)");
-   FMS ( 0,15,  6, 8,  1,     "AMD Turion 64 X2 (Tyler BH-G1)");
-   FMSQ( 0,15,  6, 8,  2, MT, "AMD Turion 64 X2 (Tyler BH-G2)");
-   FMSQ( 0,15,  6, 8,  2, dS, "AMD Sempron Dual-Core (Tyler BH-G2)");
-   FMS ( 0,15,  6, 8,  2,     "AMD Turion 64 (unknown type) (Tyler BH-G2)");
-   FMQ ( 0,15,  6, 8,     MT, "AMD Turion 64 X2 (Tyler)");
-   FMQ ( 0,15,  6, 8,     dS, "AMD Sempron Dual-Core (Tyler)");
-   FM  ( 0,15,  6, 8,         "AMD Turion 64 (unknown type) (Tyler)");
-   FMSQ( 0,15,  6,11,  1, dS, "AMD Sempron Dual-Core (Sparta BH-G1)");
-   FMSQ( 0,15,  6,11,  1, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G1)");
-   FMS ( 0,15,  6,11,  1,     "AMD Athlon 64 (unknown type) (Brisbane/Sparta BH-G1)");
-   FMSQ( 0,15,  6,11,  2, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G2)");
-   FMSQ( 0,15,  6,11,  2, Mn, "AMD Turion Neo X2 Dual-Core (Huron BH-G2)");
-   FMSQ( 0,15,  6,11,  2, MN, "AMD Athlon Neo X2 (Huron BH-G2)");
-   FMS ( 0,15,  6,11,  2,     "AMD Athlon 64 (unknown type) (Brisbane/Huron BH-G2)");
-   FMQ ( 0,15,  6,11,     dS, "AMD Sempron Dual-Core (Sparta)");
-   FMQ ( 0,15,  6,11,     Mn, "AMD Turion Neo X2 Dual-Core (Huron)");
-   FMQ ( 0,15,  6,11,     MN, "AMD Athlon Neo X2 (Huron)");
-   FMQ ( 0,15,  6,11,     dA, "AMD Athlon 64 X2 Dual-Core (Brisbane)");
-   FM  ( 0,15,  6,11,         "AMD Athlon 64 (unknown type) (Brisbane/Sparta/Huron)");
-   FMSQ( 0,15,  6,12,  2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-   FMSQ( 0,15,  6,12,  2, dS, "AMD Sempron (Sparta DH-G2)");
-   FMSQ( 0,15,  6,12,  2, dA, "AMD Athlon 64 (Lima DH-G2)");
-   FMS ( 0,15,  6,12,  2,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G2)");
-   FMQ ( 0,15,  6,12,     MS, "AMD mobile Sempron (Sherman)");
-   FMQ ( 0,15,  6,12,     dS, "AMD Sempron (Sparta)");
-   FMQ ( 0,15,  6,12,     dA, "AMD Athlon 64 (Lima)");
-   FM  ( 0,15,  6,12,         "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman)");
-   FMSQ( 0,15,  6,15,  2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-   FMSQ( 0,15,  6,15,  2, dS, "AMD Sempron (Sparta DH-G2)");
-   FMSQ( 0,15,  6,15,  2, MN, "AMD Athlon Neo (Huron DH-G2)");
-   FMS ( 0,15,  6,15,  2,     "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman DH-G2)");
-   FMQ ( 0,15,  6,15,     MS, "AMD mobile Sempron (Sherman)");
-   FMQ ( 0,15,  6,15,     dS, "AMD Sempron (Sparta)");
-   FMQ ( 0,15,  6,15,     MN, "AMD Athlon Neo (Huron)");
-   FM  ( 0,15,  6,15,         "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman)");
-   FMSQ( 0,15,  7,12,  2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-   FMSQ( 0,15,  7,12,  2, dS, "AMD Sempron (Sparta DH-G2)");
-   FMSQ( 0,15,  7,12,  2, dA, "AMD Athlon (Lima DH-G2)");
-   FMS ( 0,15,  7,12,  2,     "AMD Athlon (unknown type) (Lima/Sparta/Sherman DH-G2)");
-   FMQ ( 0,15,  7,12,     MS, "AMD mobile Sempron (Sherman)");
-   FMQ ( 0,15,  7,12,     dS, "AMD Sempron (Sparta)");
-   FMQ ( 0,15,  7,12,     dA, "AMD Athlon (Lima)");
-   FM  ( 0,15,  7,12,         "AMD Athlon (unknown type) (Lima/Sparta/Sherman)");
-   FMSQ( 0,15,  7,15,  1, MS, "AMD mobile Sempron (Sherman DH-G1)");
-   FMSQ( 0,15,  7,15,  1, dS, "AMD Sempron (Sparta DH-G1)");
-   FMSQ( 0,15,  7,15,  1, dA, "AMD Athlon 64 (Lima DH-G1)");
-   FMS ( 0,15,  7,15,  1,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G1)");
-   FMSQ( 0,15,  7,15,  2, MS, "AMD mobile Sempron (Sherman DH-G2)");
-   FMSQ( 0,15,  7,15,  2, dS, "AMD Sempron (Sparta DH-G2)");
-   FMSQ( 0,15,  7,15,  2, MN, "AMD Athlon Neo (Huron DH-G2)");
-   FMSQ( 0,15,  7,15,  2, dA, "AMD Athlon 64 (Lima DH-G2)");
-   FMS ( 0,15,  7,15,  2,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron DH-G2)");
-   FMQ ( 0,15,  7,15,     MS, "AMD mobile Sempron (Sherman)");
-   FMQ ( 0,15,  7,15,     dS, "AMD Sempron (Sparta)");
-   FMQ ( 0,15,  7,15,     MN, "AMD Athlon Neo (Huron)");
-   FMQ ( 0,15,  7,15,     dA, "AMD Athlon 64 (Lima)");
-   FM  ( 0,15,  7,15,         "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron)");
-   FMS ( 0,15, 12, 1,  3,     "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)");
-   FM  ( 0,15, 12, 1,         "AMD Athlon 64 FX Dual-Core (Windsor)");
-   F   ( 0,15,                "AMD (unknown model)");
-   FMS ( 1,15,  0, 0,  0,     "AMD (unknown type) (Barcelona DR-A0)"); // sandpile.org
-   FMS ( 1,15,  0, 0,  1,     "AMD (unknown type) (Barcelona DR-A1)"); // sandpile.org
-   FMS ( 1,15,  0, 0,  2,     "AMD (unknown type) (Barcelona DR-A2)"); // sandpile.org
-   FMS ( 1,15,  0, 2,  0,     "AMD (unknown type) (Barcelona DR-B0)"); // sandpile.org
-   FMSQ( 1,15,  0, 2,  1, sO, "AMD Quad-Core Opteron (Barcelona DR-B1)");
-   FMS ( 1,15,  0, 2,  1,     "AMD (unknown type) (Barcelona DR-B1)");
-   FMSQ( 1,15,  0, 2,  2, EO, "AMD Embedded Opteron (Barcelona DR-B2)");
-   FMSQ( 1,15,  0, 2,  2, sO, "AMD Quad-Core Opteron (Barcelona DR-B2)");
-   FMSQ( 1,15,  0, 2,  2, Tp, "AMD Phenom Triple-Core (Toliman DR-B2)");
-   FMSQ( 1,15,  0, 2,  2, Qp, "AMD Phenom Quad-Core (Agena DR-B2)");
-   FMS ( 1,15,  0, 2,  2,     "AMD (unknown type) (Barcelona/Toliman/Agena DR-B2)");
-   FMSQ( 1,15,  0, 2,  3, EO, "AMD Embedded Opteron (Barcelona DR-B3)");
-   FMSQ( 1,15,  0, 2,  3, sO, "AMD Quad-Core Opteron (Barcelona DR-B3)");
-   FMSQ( 1,15,  0, 2,  3, Tp, "AMD Phenom Triple-Core (Toliman DR-B3)");
-   FMSQ( 1,15,  0, 2,  3, Qp, "AMD Phenom Quad-Core (Agena DR-B3)");
-   FMSQ( 1,15,  0, 2,  3, dA, "AMD Athlon Dual-Core (Kuma DR-B3)");
-   FMS ( 1,15,  0, 2,  3,     "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma DR-B3)");
-   FMS ( 1,15,  0, 2, 10,     "AMD Quad-Core Opteron (Barcelona DR-BA)");
-   FMQ ( 1,15,  0, 2,     EO, "AMD Embedded Opteron (Barcelona)");
-   FMQ ( 1,15,  0, 2,     sO, "AMD Quad-Core Opteron (Barcelona)");
-   FMQ ( 1,15,  0, 2,     Tp, "AMD Phenom Triple-Core (Toliman)");
-   FMQ ( 1,15,  0, 2,     Qp, "AMD Phenom Quad-Core (Agena)");
-   FMQ ( 1,15,  0, 2,     dA, "AMD Athlon Dual-Core (Kuma)");
-   FM  ( 1,15,  0, 2,         "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma)");
-   FMS ( 1,15,  0, 4,  0,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C0)"); // sandpile.org
-   FMS ( 1,15,  0, 4,  1,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C1)"); // sandpile.org
-   FMSQ( 1,15,  0, 4,  2, EO, "AMD Embedded Opteron (Shanghai RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, sO, "AMD Quad-Core Opteron (Shanghai RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, dr, "AMD Athlon Dual-Core (Propus RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, dA, "AMD Athlon Dual-Core (Regor RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, Dp, "AMD Phenom II X2 (Callisto RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, Tp, "AMD Phenom II X3 (Heka RB-C2)");
-   FMSQ( 1,15,  0, 4,  2, Qp, "AMD Phenom II X4 (Deneb RB-C2)");
-   FMS ( 1,15,  0, 4,  2,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C2)");
-   FMSQ( 1,15,  0, 4,  3, Dp, "AMD Phenom II X2 (Callisto RB-C3)");
-   FMSQ( 1,15,  0, 4,  3, Tp, "AMD Phenom II X3 (Heka RB-C3)");
-   FMSQ( 1,15,  0, 4,  3, Qp, "AMD Phenom II X4 (Deneb RB-C3)");
-   FMS ( 1,15,  0, 4,  3,     "AMD Phenom II (unknown type) (Callisto/Heka/Deneb RB-C3)");
-   FMQ ( 1,15,  0, 4,     EO, "AMD Embedded Opteron (Shanghai)");
-   FMQ ( 1,15,  0, 4,     sO, "AMD Quad-Core Opteron (Shanghai)");
-   FMQ ( 1,15,  0, 4,     dr, "AMD Athlon Dual-Core (Propus)");
-   FMQ ( 1,15,  0, 4,     dA, "AMD Athlon Dual-Core (Regor)");
-   FMQ ( 1,15,  0, 4,     Dp, "AMD Phenom II X2 (Callisto)");
-   FMQ ( 1,15,  0, 4,     Tp, "AMD Phenom II X3 (Heka)");
-   FMQ ( 1,15,  0, 4,     Qp, "AMD Phenom II X4 (Deneb)");
-   FM  ( 1,15,  0, 4,         "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb)");
-   FMS ( 1,15,  0, 5,  0,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C0)"); // sandpile.org
-   FMS ( 1,15,  0, 5,  1,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C1)"); // sandpile.org
-   FMSQ( 1,15,  0, 5,  2, DA, "AMD Athlon II X2 (Regor BL-C2)");
-   FMSQ( 1,15,  0, 5,  2, TA, "AMD Athlon II X3 (Rana BL-C2)");
-   FMSQ( 1,15,  0, 5,  2, QA, "AMD Athlon II X4 (Propus BL-C2)");
-   FMS ( 1,15,  0, 5,  2,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C2)");
-   FMSQ( 1,15,  0, 5,  3, TA, "AMD Athlon II X3 (Rana BL-C3)");
-   FMSQ( 1,15,  0, 5,  3, QA, "AMD Athlon II X4 (Propus BL-C3)");
-   FMSQ( 1,15,  0, 5,  3, Tp, "AMD Phenom II Triple-Core (Heka BL-C3)");
-   FMSQ( 1,15,  0, 5,  3, Qp, "AMD Phenom II Quad-Core (Deneb BL-C3)");
-   FMS ( 1,15,  0, 5,  3,     "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb BL-C3)");
-   FMQ ( 1,15,  0, 5,     DA, "AMD Athlon II X2 (Regor)");
-   FMQ ( 1,15,  0, 5,     TA, "AMD Athlon II X3 (Rana)");
-   FMQ ( 1,15,  0, 5,     QA, "AMD Athlon II X4 (Propus)");
-   FMQ ( 1,15,  0, 5,     Tp, "AMD Phenom II Triple-Core (Heka)");
-   FMQ ( 1,15,  0, 5,     Qp, "AMD Phenom II Quad-Core (Deneb)");
-   FM  ( 1,15,  0, 5,         "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb)");
-   FMS ( 1,15,  0, 6,  0,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C0)");
-   FMS ( 1,15,  0, 6,  1,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C1)");
-   FMSQ( 1,15,  0, 6,  2, MS, "AMD Sempron Mobile (Sargas DA-C2)");
-   FMSQ( 1,15,  0, 6,  2, dS, "AMD Sempron II (Sargas DA-C2)");
-   FMSQ( 1,15,  0, 6,  2, MT, "AMD Turion II Dual-Core Mobile (Caspian DA-C2)");
-   FMSQ( 1,15,  0, 6,  2, MA, "AMD Athlon II Dual-Core Mobile (Regor DA-C2)");
-   FMSQ( 1,15,  0, 6,  2, DA, "AMD Athlon II X2 (Regor DA-C2)");
-   FMSQ( 1,15,  0, 6,  2, dA, "AMD Athlon II (Sargas DA-C2)");
-   FMS ( 1,15,  0, 6,  2,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C2)");
-   FMSQ( 1,15,  0, 6,  3, Ms, "AMD V-Series Mobile (Champlain DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, DS, "AMD Sempron II X2 (Regor DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, dS, "AMD Sempron II (Sargas DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, MT, "AMD Turion II Dual-Core Mobile (Champlain DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, Mp, "AMD Phenom II Dual-Core Mobile (Champlain DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, MA, "AMD Athlon II Dual-Core Mobile (Champlain DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, DA, "AMD Athlon II X2 (Regor DA-C3)");
-   FMSQ( 1,15,  0, 6,  3, dA, "AMD Athlon II (Sargas DA-C3)");
-   FMS ( 1,15,  0, 6,  3,     "AMD Athlon (unknown type) (Regor/Sargas/Champlain DA-C3)");
-   FMQ ( 1,15,  0, 6,     Ms, "AMD V-Series Mobile (Champlain)");
-   FMQ ( 1,15,  0, 6,     MS, "AMD Sempron Mobile (Sargas)");
-   FMQ ( 1,15,  0, 6,     DS, "AMD Sempron II X2 (Regor)");
-   FMQ ( 1,15,  0, 6,     dS, "AMD Sempron II (Sargas)");
-   FMQ ( 1,15,  0, 6,     MT, "AMD Turion II Dual-Core Mobile (Caspian / Champlain)");
-   FMQ ( 1,15,  0, 6,     Mp, "AMD Phenom II Dual-Core Mobile (Champlain)");
-   FMQ ( 1,15,  0, 6,     MA, "AMD Athlon II Dual-Core Mobile (Regor / Champlain)");
-   FMQ ( 1,15,  0, 6,     DA, "AMD Athlon II X2 (Regor)");
-   FMQ ( 1,15,  0, 6,     dA, "AMD Athlon II (Sargas)");
-   FM  ( 1,15,  0, 6,         "AMD Athlon (unknown type) (Regor/Sargas/Caspian/Champlain)");
-   FMSQ( 1,15,  0, 8,  0, SO, "AMD Six-Core Opteron (Istanbul HY-D0)");
-   FMSQ( 1,15,  0, 8,  0, sO, "AMD Opteron 4100 (Lisbon HY-D0)");
-   FMS ( 1,15,  0, 8,  0,     "AMD Opteron (unknown type) (Lisbon/Istanbul HY-D0)");
-   FMS ( 1,15,  0, 8,  1,     "AMD Opteron 4100 (Lisbon HY-D1)");
-   FMQ ( 1,15,  0, 8,     SO, "AMD Six-Core Opteron (Istanbul)");
-   FMQ ( 1,15,  0, 8,     sO, "AMD Opteron 4100 (Lisbon)");
-   FM  ( 1,15,  0, 8,         "AMD Opteron (unknown type) (Lisbon/Istanbul)");
-   FMS ( 1,15,  0, 9,  0,     "AMD Opteron 6100 (Magny-Cours HY-D0)"); // sandpile.org
-   FMS ( 1,15,  0, 9,  1,     "AMD Opteron 6100 (Magny-Cours HY-D1)");
-   FM  ( 1,15,  0, 9,         "AMD Opteron 6100 (Magny-Cours)");
-   FMSQ( 1,15,  0,10,  0, Qp, "AMD Phenom II X4 (Zosma PH-E0)");
-   FMSQ( 1,15,  0,10,  0, Sp, "AMD Phenom II X6 (Thuban PH-E0)");
-   FMS ( 1,15,  0,10,  0,     "AMD Phenom II (unknown type) (Zosma/Thuban PH-E0)");
-   FMQ ( 1,15,  0,10,     Qp, "AMD Phenom II X4 (Zosma)");
-   FMQ ( 1,15,  0,10,     Sp, "AMD Phenom II X6 (Thuban)");
-   FM  ( 1,15,  0,10,         "AMD Phenom II (unknown type) (Zosma/Thuban)");
-   F   ( 1,15,                "AMD (unknown model)");
-   FMSQ( 2,15,  0, 3,  1, MU, "AMD Turion X2 Ultra Dual-Core Mobile (Griffin LG-B1)");
-   FMSQ( 2,15,  0, 3,  1, MT, "AMD Turion X2 Dual-Core Mobile (Lion LG-B1)");
-   FMSQ( 2,15,  0, 3,  1, DS, "AMD Sempron X2 Dual-Core (Sable LG-B1)");
-   FMSQ( 2,15,  0, 3,  1, dS, "AMD Sempron (Sable LG-B1)");
-   FMSQ( 2,15,  0, 3,  1, DA, "AMD Athlon X2 Dual-Core (Lion LG-B1)");
-   FMSQ( 2,15,  0, 3,  1, dA, "AMD Athlon (Lion LG-B1)");
-   FMS ( 2,15,  0, 3,  1,     "AMD Athlon (unknown type) (Lion/Sable LG-B1)");
-   FMQ ( 2,15,  0, 3,     MU, "AMD Turion X2 Ultra (Griffin)");
-   FMQ ( 2,15,  0, 3,     MT, "AMD Turion X2 (Lion)");
-   FMQ ( 2,15,  0, 3,     DS, "AMD Sempron X2 Dual-Core (Sable)");
-   FMQ ( 2,15,  0, 3,     dS, "AMD Sempron (Sable)");
-   FMQ ( 2,15,  0, 3,     DA, "AMD Athlon X2 Dual-Core (Lion)");
-   FMQ ( 2,15,  0, 3,     dA, "AMD Athlon (Lion)");
-   FM  ( 2,15,  0, 3,         "AMD Athlon (unknown type) (Lion/Sable)");
-   F   ( 2,15,                "AMD (unknown model)");
-   FMS ( 3,15,  0, 0,  0,     "AMD Athlon (unknown type) (Llano LN-A0)"); // sandpile.org
-   FMS ( 3,15,  0, 0,  1,     "AMD Athlon (unknown type) (Llano LN-A1)"); // sandpile.org
-   FMSQ( 3,15,  0, 1,  0, dS, "AMD Sempron Dual-Core (Llano LN-B0)");
-   FMSQ( 3,15,  0, 1,  0, dA, "AMD Athlon II Dual-Core (Llano LN-B0)");
-   FMSQ( 3,15,  0, 1,  0, Sa, "AMD A-Series (Llano LN-B0)");
-   FMSQ( 3,15,  0, 1,  0, Se, "AMD E2-Series (Llano LN-B0)");
-   FMS ( 3,15,  0, 1,  0,     "AMD Athlon (unknown type) (Llano LN-B0)");
-   FMQ ( 3,15,  0, 1,     dS, "AMD Sempron Dual-Core (Llano)");
-   FMQ ( 3,15,  0, 1,     dA, "AMD Athlon II Dual-Core (Llano)");
-   FMQ ( 3,15,  0, 1,     Sa, "AMD A-Series (Llano)");
-   FMQ ( 3,15,  0, 1,     Se, "AMD E2-Series (Llano)");
-   FM  ( 3,15,  0, 1,         "AMD Athlon (unknown type) (Llano)");
-   FMS ( 3,15,  0, 2,  0,     "AMD Athlon (unknown type) (Llano LN-B0)"); // sandpile.org
-   F   ( 3,15,                "AMD (unknown model) (Llano)");
-   FMSQ( 5,15,  0, 1,  0, Sc, "AMD C-Series (Ontario ON-B0)");
-   FMSQ( 5,15,  0, 1,  0, Se, "AMD E-Series (Zacate ON-B0)");
-   FMSQ( 5,15,  0, 1,  0, Sg, "AMD G-Series (Ontario/Zacate ON-B0)");
-   FMSQ( 5,15,  0, 1,  0, Sz, "AMD Z-Series (Desna ON-B0)");
-   FMS ( 5,15,  0, 1,  0,     "AMD (unknown type) (Ontario/Zacate/Desna ON-B0)");
-   FM  ( 5,15,  0, 1,         "AMD (unknown type) (Ontario/Zacate/Desna)");
-   FMSQ( 5,15,  0, 2,  0, Sc, "AMD C-Series (Ontario ON-C0)");
-   FMSQ( 5,15,  0, 2,  0, Se, "AMD E-Series (Zacate ON-C0)");
-   FMSQ( 5,15,  0, 2,  0, Sg, "AMD G-Series (Ontario/Zacate ON-C0)");
-   FMSQ( 5,15,  0, 2,  0, Sz, "AMD Z-Series (Desna ON-C0)");
-   FMS ( 5,15,  0, 2,  0,     "AMD (unknown type) (Ontario/Zacate/Desna ON-C0)");
-   FM  ( 5,15,  0, 2,         "AMD (unknown type) (Ontario/Zacate/Desna)");
-   F   ( 5,15,                "AMD (unknown model)");
-   FMS ( 6,15,  0, 0,  0,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A0)"); // sandpile.org
-   FMS ( 6,15,  0, 0,  1,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A1)"); // sandpile.org
-   FMS ( 6,15,  0, 1,  0,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B0)"); // sandpile.org
-   FMS ( 6,15,  0, 1,  1,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B1)"); // sandpile.org
-   FMSQ( 6,15,  0, 1,  2, sO, "AMD Opteron 6200 (Interlagos OR-B2) / Opteron 4200 (Valencia OR-B2) / Opteron 3200 (Zurich OR-B2)");
-   FMSQ( 6,15,  0, 1,  2, df, "AMD FX-Series (Zambezi OR-B2)");
-   FMS ( 6,15,  0, 1,  2,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B2)");
-   FMQ ( 6,15,  0, 1,     sO, "AMD Opteron 6200 (Interlagos) / Opteron 4200 (Valencia) / Opteron 3200 (Zurich)");
-   FMQ ( 6,15,  0, 1,     df, "AMD FX-Series (Zambezi)");
-   FM  ( 6,15,  0, 1,         "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi)");
-   FMSQ( 6,15,  0, 2,  0, sO, "AMD Opteron 6300 (Abu Dhabi OR-C0) / Opteron 4300 (Seoul OR-C0) / Opteron 3300 (Delhi OR-C0)");
-   FMSQ( 6,15,  0, 2,  0, df, "AMD FX-Series (Vishera OR-C0)");
-   FMS ( 6,15,  0, 2,  0,     "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera OR-C0)");
-   FMQ ( 6,15,  0, 2,     sO, "AMD Opteron 6300 (Abu Dhabi) / Opteron 4300 (Seoul) / Opteron 3300 (Delhi)");
-   FMQ ( 6,15,  0, 2,     df, "AMD FX-Series (Vishera)");
-   FM  ( 6,15,  0, 2,         "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera)");
-   FMSQ( 6,15,  1, 0,  1, Sa, "AMD A-Series (Trinity TN-A1)");
-   FMSQ( 6,15,  1, 0,  1, Sr, "AMD R-Series (Trinity TN-A1)");
-   FMSQ( 6,15,  1, 0,  1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity TN-A1)");
-   FMSQ( 6,15,  1, 0,  1, dS, "AMD Sempron Dual-Core (Trinity TN-A1)");
-   FMSQ( 6,15,  1, 0,  1, dI, "AMD FirePro (Trinity TN-A1)");
-   FMS ( 6,15,  1, 0,  1,     "AMD (unknown type) (Trinity TN-A1)");
-   FMQ ( 6,15,  1, 0,     Sa, "AMD A-Series (Trinity)");
-   FMQ ( 6,15,  1, 0,     Sr, "AMD R-Series (Trinity)");
-   FMQ ( 6,15,  1, 0,     dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity)");
-   FMQ ( 6,15,  1, 0,     dS, "AMD Sempron Dual-Core (Trinity)");
-   FMQ ( 6,15,  1, 0,     dI, "AMD FirePro (Trinity)");
-   FM  ( 6,15,  1, 0,         "AMD (unknown type) (Trinity TN-A1)");
-   FMSQ( 6,15,  1, 3,  1, Sa, "AMD A-Series (Richland RL-A1)");
-   FMSQ( 6,15,  1, 3,  1, Sr, "AMD R-Series (Richland RL-A1)");
-   FMSQ( 6,15,  1, 3,  1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland RL-A1)");
-   FMSQ( 6,15,  1, 3,  1, dS, "AMD Sempron Dual-Core (Richland RL-A1)");
-   FMSQ( 6,15,  1, 3,  1, dI, "AMD FirePro (Richland RL-A1)");
-   FMS ( 6,15,  1, 3,  1,     "AMD (unknown type) (Richland RL-A1)");
-   FMQ ( 6,15,  1, 3,     Sa, "AMD A-Series (Richland)");
-   FMQ ( 6,15,  1, 3,     Sr, "AMD R-Series (Richland)");
-   FMQ ( 6,15,  1, 3,     dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland)");
-   FMQ ( 6,15,  1, 3,     dS, "AMD Sempron Dual-Core (Richland)");
-   FMQ ( 6,15,  1, 3,     dI, "AMD FirePro (Richland)");
-   FM  ( 6,15,  1, 3,         "AMD (unknown type) (Richland)");
-   FMS ( 6,15,  3, 0,  0,     "AMD (unknown type) (Kaveri KV-A0)");
-   FMSQ( 6,15,  3, 0,  1, Sa, "AMD Elite Performance A-Series (Kaveri KV-A1)");
-   FMSQ( 6,15,  3, 0,  1, Mr, "AMD Mobile R-Series (Kaveri KV-A1)");
-   FMSQ( 6,15,  3, 0,  1, sO, "AMD Opteron X1200 / X2200 (Kaveri KV-A1)");
-   FMS ( 6,15,  3, 0,  1,     "AMD (unknown type) (Kaveri KV-A1)");
-   FMQ ( 6,15,  3, 0,     Sa, "AMD Elite Performance A-Series (Kaveri)");
-   FMQ ( 6,15,  3, 0,     Mr, "AMD Mobile R-Series (Kaveri)");
-   FMQ ( 6,15,  3, 0,     sO, "AMD Opteron X1200 / X2200 (Kaveri)");
-   FM  ( 6,15,  3, 0,         "AMD (unknown type) (Kaveri)");
-   FMSQ( 6,15,  3, 8,  1, Sa, "AMD A-Series (Godavari A1)"); // sandpile.org
-   FMS ( 6,15,  3, 8,  1,     "AMD (unknown type) (Godavari A1)"); // sandpile.org
-   FMQ ( 6,15,  3, 8,     Sa, "AMD A-Series (Godavari)");
-   FM  ( 6,15,  3, 8,         "AMD (unknown type) (Godavari)");
-   FMS ( 6,15,  6, 0,  0,     "AMD (unknown type) (Carrizo/Toronto CZ-A0)"); // sandpile.org
-   FMSQ( 6,15,  6, 0,  1, sO, "AMD Opteron (Toronto CZ-A1)"); // undocumented, but instlatx64 sample
-   FMSQ( 6,15,  6, 0,  1, df, "AMD FX-Series (Carrizo CZ-A1)"); // undocumented, but instlatx64 sample
-   FMS ( 6,15,  6, 0,  1,     "AMD (unknown type) (Carrizo/Toronto CZ-A1)"); // undocumented, but instlatx64 sample
-   FMQ ( 6,15,  6, 0,     sO, "AMD Opteron (Toronto)"); // undocumented, but instlatx64 sample
-   FMQ ( 6,15,  6, 0,     df, "AMD FX-Series (Carrizo)"); // undocumented, but instlatx64 sample
-   FM  ( 6,15,  6, 0,         "AMD (unknown type) (Carrizo/Toronto)"); // undocumented, but instlatx64 sample
-   FMSQ( 6,15,  6, 5,  1, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge CZ-A1/BR-A1)"); // undocumented, but samples from Alexandros Couloumbis & instlatx64; sandpile.org stepping
-   FMSQ( 6,15,  6, 5,  1, Se, "AMD E-Series (Stoney Ridge CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-   FMSQ( 6,15,  6, 5,  1, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-   FMSQ( 6,15,  6, 5,  1, Sr, "AMD R-Series (Merlin Falcon CZ-A1/BR-A1)"); // undocumented; sandpile.org stepping
-   FMS ( 6,15,  6, 5,  1,     "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon CZ-A1/BR-A1)"); // sandpile.org
-   FMQ ( 6,15,  6, 5,     Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)"); // undocumented, but samples from Alexandros Couloumbis & instlatx64
-   FMQ ( 6,15,  6, 5,     Se, "AMD E-Series (Stoney Ridge)"); // undocumented
-   FMQ ( 6,15,  6, 5,     Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)"); // undocumented
-   FMQ ( 6,15,  6, 5,     Sr, "AMD R-Series (Merlin Falcon)"); // undocumented
-   FM  ( 6,15,  6, 5,         "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)"); // undocumented, but sample from Alexandros Couloumbis
-   FMSQ( 6,15,  7, 0,  0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge ST-A0)");
-   FMSQ( 6,15,  7, 0,  0, Se, "AMD E-Series (Stoney Ridge ST-A0)");
-   FMSQ( 6,15,  7, 0,  0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon ST-A0)");
-   FMSQ( 6,15,  7, 0,  0, Sr, "AMD R-Series (Merlin Falcon ST-A0)");
-   FMS ( 6,15,  7, 0,  0,     "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon ST-A0)");
-   FMQ ( 6,15,  7, 0,     Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)");
-   FMQ ( 6,15,  7, 0,     Se, "AMD E-Series (Stoney Ridge)");
-   FMQ ( 6,15,  7, 0,     Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)");
-   FMQ ( 6,15,  7, 0,     Sr, "AMD R-Series (Merlin Falcon)");
-   FM  ( 6,15,  7, 0,         "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)");
-   F   ( 6,15,                "AMD (unknown model)");
-   FMS ( 7,15,  0, 0,  0,     "AMD (unknown type) (Kabini/Temash/Kyoto KB-A0)"); // sandpile.org
-   FMSQ( 7,15,  0, 0,  1, dA, "AMD Athlon (Kabini KB-A1)");
-   FMSQ( 7,15,  0, 0,  1, Sa, "AMD A-Series (Kabini/Temash KB-A1)");
-   FMSQ( 7,15,  0, 0,  1, Se, "AMD E-Series (Kabini KB-A1)");
-   FMSQ( 7,15,  0, 0,  1, Sg, "AMD G-Series (Kabini KB-A1)");
-   FMSQ( 7,15,  0, 0,  1, sO, "AMD Opteron X1100/X2100 Series (Kyoto KB-A1)");
-   FMS ( 7,15,  0, 0,  1,     "AMD (unknown type) (Kabini/Temash/Kyoto KB-A1)");
-   FMQ ( 7,15,  0, 0,     dA, "AMD Athlon (Kabini)");
-   FMQ ( 7,15,  0, 0,     Sa, "AMD A-Series (Kabini/Temash)");
-   FMQ ( 7,15,  0, 0,     Se, "AMD E-Series (Kabini)");
-   FMQ ( 7,15,  0, 0,     Sg, "AMD G-Series (Kabini)");
-   FMQ ( 7,15,  0, 0,     sO, "AMD Opteron X1100/X2100 Series (Kyoto)");
-   FM  ( 7,15,  0, 0,         "AMD (unknown type) (Kabini/Temash/Kyoto)");
-   FM  ( 7,15,  2, 6,         "AMD (unknown type) (Cato)"); // undocumented; instlatx64 sample; engr sample?
+   static const synth_entry_t  table[] = {
+   FM  ( 0, 4,  0, 3,         "AMD 80486DX2")
+   FM  ( 0, 4,  0, 7,         "AMD 80486DX2WB")
+   FM  ( 0, 4,  0, 8,         "AMD 80486DX4")
+   FM  ( 0, 4,  0, 9,         "AMD 80486DX4WB")
+   FM  ( 0, 4,  0,10,         "AMD Elan SC400") // sandpile.org
+   FM  ( 0, 4,  0,14,         "AMD 5x86")
+   FM  ( 0, 4,  0,15,         "AMD 5xWB")
+   F   ( 0, 4,                "AMD 80486 / 5x (unknown model)")
+   FM  ( 0, 5,  0, 0,         "AMD SSA5 (PR75, PR90, PR100)")
+   FM  ( 0, 5,  0, 1,         "AMD 5k86 (PR120, PR133)")
+   FM  ( 0, 5,  0, 2,         "AMD 5k86 (PR166)")
+   FM  ( 0, 5,  0, 3,         "AMD 5k86 (PR200)")
+   FM  ( 0, 5,  0, 5,         "AMD Geode GX")
+   FM  ( 0, 5,  0, 6,         "AMD K6")
+   FM  ( 0, 5,  0, 7,         "AMD K6 (Little Foot)")
+   FMS ( 0, 5,  0, 8,  0,     "AMD K6-2 (Chomper A)")
+   FMS ( 0, 5,  0, 8, 12,     "AMD K6-2 (Chomper A)")
+   FM  ( 0, 5,  0, 8,         "AMD K6-2 (Chomper)")
+   FMS ( 0, 5,  0, 9,  1,     "AMD K6-III (Sharptooth B)")
+   FM  ( 0, 5,  0, 9,         "AMD K6-III (Sharptooth)")
+   FM  ( 0, 5,  0,10,         "AMD Geode LX")
+   FM  ( 0, 5,  0,13,         "AMD K6-2+, K6-III+")
+   F   ( 0, 5,                "AMD 5k86 / K6 / Geode (unknown model)")
+   FM  ( 0, 6,  0, 1,         "AMD Athlon (Argon)")
+   FM  ( 0, 6,  0, 2,         "AMD Athlon (K75 / Pluto / Orion)")
+   FMS ( 0, 6,  0, 3,  0,     "AMD Duron / mobile Duron (Spitfire A0)")
+   FMS ( 0, 6,  0, 3,  1,     "AMD Duron / mobile Duron (Spitfire A2)")
+   FM  ( 0, 6,  0, 3,         "AMD Duron / mobile Duron (Spitfire)")
+   FMS ( 0, 6,  0, 4,  2,     "AMD Athlon (Thunderbird A4-A7)")
+   FMS ( 0, 6,  0, 4,  4,     "AMD Athlon (Thunderbird A9)")
+   FM  ( 0, 6,  0, 4,         "AMD Athlon (Thunderbird)")
+   FMSQ( 0, 6,  0, 6,  0, sA, "AMD Athlon MP (Palomino A0)")
+   FMSQ( 0, 6,  0, 6,  0, dA, "AMD Athlon (Palomino A0)")
+   FMSQ( 0, 6,  0, 6,  0, MA, "AMD mobile Athlon 4 (Palomino A0)")
+   FMSQ( 0, 6,  0, 6,  0, sD, "AMD Duron MP (Palomino A0)")
+   FMSQ( 0, 6,  0, 6,  0, MD, "AMD mobile Duron (Palomino A0)")
+   FMS ( 0, 6,  0, 6,  0,     "AMD Athlon (unknown type)  (Palomino A0)")
+   FMSQ( 0, 6,  0, 6,  1, sA, "AMD Athlon MP (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  1, dA, "AMD Athlon (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  1, MA, "AMD mobile Athlon 4 (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  1, sD, "AMD Duron MP (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  1, MD, "AMD mobile Duron (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  1, dD, "AMD Duron (Palomino A2)")
+   FMS ( 0, 6,  0, 6,  1,     "AMD Athlon (unknown type) (Palomino A2)")
+   FMSQ( 0, 6,  0, 6,  2, sA, "AMD Athlon MP (Palomino A5)")
+   FMSQ( 0, 6,  0, 6,  2, dX, "AMD Athlon XP (Palomino A5)")
+   FMSQ( 0, 6,  0, 6,  2, MA, "AMD mobile Athlon 4 (Palomino A5)")
+   FMSQ( 0, 6,  0, 6,  2, sD, "AMD Duron MP (Palomino A5)")
+   FMSQ( 0, 6,  0, 6,  2, MD, "AMD mobile Duron (Palomino A5)")
+   FMSQ( 0, 6,  0, 6,  2, dD, "AMD Duron (Palomino A5)")
+   FMS ( 0, 6,  0, 6,  2,     "AMD Athlon (unknown type) (Palomino A5)")
+   FMQ ( 0, 6,  0, 6,     MD, "AMD mobile Duron (Palomino)")
+   FMQ ( 0, 6,  0, 6,     dD, "AMD Duron (Palomino)")
+   FMQ ( 0, 6,  0, 6,     MA, "AMD mobile Athlon (Palomino)")
+   FMQ ( 0, 6,  0, 6,     dX, "AMD Athlon XP (Palomino)")
+   FMQ ( 0, 6,  0, 6,     dA, "AMD Athlon (Palomino)")
+   FM  ( 0, 6,  0, 6,         "AMD Athlon (unknown type) (Palomino)")
+   FMSQ( 0, 6,  0, 7,  0, sD, "AMD Duron MP (Morgan A0)")
+   FMSQ( 0, 6,  0, 7,  0, MD, "AMD mobile Duron (Morgan A0)")
+   FMSQ( 0, 6,  0, 7,  0, dD, "AMD Duron (Morgan A0)")
+   FMS ( 0, 6,  0, 7,  0,     "AMD Duron (unknown type)  (Morgan A0)")
+   FMSQ( 0, 6,  0, 7,  1, sD, "AMD Duron MP (Morgan A1)")
+   FMSQ( 0, 6,  0, 7,  1, MD, "AMD mobile Duron (Morgan A1)")
+   FMSQ( 0, 6,  0, 7,  1, dD, "AMD Duron (Morgan A1)")
+   FMS ( 0, 6,  0, 7,  1,     "AMD Duron (unknown type)  (Morgan A1)")
+   FMQ ( 0, 6,  0, 7,     sD, "AMD Duron MP (Morgan)")
+   FMQ ( 0, 6,  0, 7,     MD, "AMD mobile Duron (Morgan)")
+   FMQ ( 0, 6,  0, 7,     dD, "AMD Duron (Morgan)")
+   FM  ( 0, 6,  0, 7,         "AMD Duron (unknown type)  (Morgan)")
+   FMSQ( 0, 6,  0, 8,  0, dS, "AMD Sempron (Thoroughbred A0)")
+   FMSQ( 0, 6,  0, 8,  0, sD, "AMD Duron MP (Applebred A0)")
+   FMSQ( 0, 6,  0, 8,  0, dD, "AMD Duron (Applebred A0)")
+   FMSQ( 0, 6,  0, 8,  0, MX, "AMD mobile Athlon XP (Thoroughbred A0)")
+   FMSQ( 0, 6,  0, 8,  0, sA, "AMD Athlon MP (Thoroughbred A0)")
+   FMSQ( 0, 6,  0, 8,  0, dX, "AMD Athlon XP (Thoroughbred A0)")
+   FMSQ( 0, 6,  0, 8,  0, dA, "AMD Athlon (Thoroughbred A0)")
+   FMS ( 0, 6,  0, 8,  0,     "AMD Athlon (unknown type) (Thoroughbred A0)")
+   FMSQ( 0, 6,  0, 8,  1, MG, "AMD Geode NX (Thoroughbred B0)")
+   FMSQ( 0, 6,  0, 8,  1, dS, "AMD Sempron (Thoroughbred B0)")
+   FMSQ( 0, 6,  0, 8,  1, sD, "AMD Duron MP (Applebred B0)")
+   FMSQ( 0, 6,  0, 8,  1, dD, "AMD Duron (Applebred B0)")
+   FMSQ( 0, 6,  0, 8,  1, sA, "AMD Athlon MP (Thoroughbred B0)")
+   FMSQ( 0, 6,  0, 8,  1, dX, "AMD Athlon XP (Thoroughbred B0)")
+   FMSQ( 0, 6,  0, 8,  1, dA, "AMD Athlon (Thoroughbred B0)")
+   FMS ( 0, 6,  0, 8,  1,     "AMD Athlon (unknown type) (Thoroughbred B0)")
+   FMQ ( 0, 6,  0, 8,     MG, "AMD Geode NX (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     dS, "AMD Sempron (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     sD, "AMD Duron MP (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     dD, "AMD Duron (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     MX, "AMD mobile Athlon XP (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     sA, "AMD Athlon MP (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     dX, "AMD Athlon XP (Thoroughbred)")
+   FMQ ( 0, 6,  0, 8,     dA, "AMD Athlon XP (Thoroughbred)")
+   FM  ( 0, 6,  0, 8,         "AMD Athlon (unknown type) (Thoroughbred)")
+   FMSQ( 0, 6,  0,10,  0, dS, "AMD Sempron (Barton A2)")
+   FMSQ( 0, 6,  0,10,  0, ML, "AMD mobile Athlon XP-M (LV) (Barton A2)")
+   FMSQ( 0, 6,  0,10,  0, MX, "AMD mobile Athlon XP-M (Barton A2)")
+   FMSQ( 0, 6,  0,10,  0, dt, "AMD Athlon XP (Thorton A2)")
+   FMSQ( 0, 6,  0,10,  0, sA, "AMD Athlon MP (Barton A2)")
+   FMSQ( 0, 6,  0,10,  0, dX, "AMD Athlon XP (Barton A2)")
+   FMS ( 0, 6,  0,10,  0,     "AMD Athlon (unknown type) (Barton A2)")
+   FMQ ( 0, 6,  0,10,     dS, "AMD Sempron (Barton)")
+   FMQ ( 0, 6,  0,10,     ML, "AMD mobile Athlon XP-M (LV) (Barton)")
+   FMQ ( 0, 6,  0,10,     MX, "AMD mobile Athlon XP-M (Barton)")
+   FMQ ( 0, 6,  0,10,     sA, "AMD Athlon MP (Barton)")
+   FMQ ( 0, 6,  0,10,     dX, "AMD Athlon XP (Barton)")
+   FM  ( 0, 6,  0,10,         "AMD Athlon (unknown type) (Barton)")
+   F   ( 0, 6,                "AMD Athlon (unknown model)")
+   F   ( 0, 7,                "AMD Opteron (unknown model)")
+   FMS ( 0,15,  0, 4,  0,     "AMD Athlon 64 (SledgeHammer SH7-B0)")
+   FMSQ( 0,15,  0, 4,  8, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-C0)")
+   FMSQ( 0,15,  0, 4,  8, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-C0)")
+   FMSQ( 0,15,  0, 4,  8, dA, "AMD Athlon 64 (SledgeHammer SH7-C0)")
+   FMS ( 0,15,  0, 4,  8,     "AMD Athlon 64 (unknown type) (SledgeHammer SH7-C0)")
+   FMSQ( 0,15,  0, 4, 10, MX, "AMD mobile Athlon XP-M (SledgeHammer SH7-CG)")
+   FMSQ( 0,15,  0, 4, 10, MA, "AMD mobile Athlon 64 (SledgeHammer SH7-CG)")
+   FMSQ( 0,15,  0, 4, 10, dA, "AMD Athlon 64 (SledgeHammer SH7-CG)")
+   FMS ( 0,15,  0, 4, 10,     "AMD Athlon 64 (unknown type) (SledgeHammer SH7-CG)")
+   FMQ ( 0,15,  0, 4,     MX, "AMD mobile Athlon XP-M (SledgeHammer SH7)")
+   FMQ ( 0,15,  0, 4,     MA, "AMD mobile Athlon 64 (SledgeHammer SH7)")
+   FMQ ( 0,15,  0, 4,     dA, "AMD Athlon 64 (SledgeHammer SH7)")
+   FM  ( 0,15,  0, 4,         "AMD Athlon 64 (unknown type) (SledgeHammer SH7)")
+   FMS ( 0,15,  0, 5,  0,     "AMD Opteron (DP SledgeHammer SH7-B0)")
+   FMS ( 0,15,  0, 5,  1,     "AMD Opteron (DP SledgeHammer SH7-B3)")
+   FMSQ( 0,15,  0, 5,  8, sO, "AMD Opteron (DP SledgeHammer SH7-C0)")
+   FMSQ( 0,15,  0, 5,  8, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-C0)")
+   FMS ( 0,15,  0, 5,  8,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-C0)")
+   FMSQ( 0,15,  0, 5, 10, sO, "AMD Opteron (DP SledgeHammer SH7-CG)")
+   FMSQ( 0,15,  0, 5, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)")
+   FMS ( 0,15,  0, 5, 10,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)")
+   FMQ ( 0,15,  0, 5,     sO, "AMD Opteron (SledgeHammer SH7)")
+   FMQ ( 0,15,  0, 5,     dF, "AMD Athlon 64 FX (SledgeHammer SH7)")
+   FM  ( 0,15,  0, 5,         "AMD Athlon 64 (unknown type) (SledgeHammer SH7) FX")
+   FMSQ( 0,15,  0, 7, 10, dF, "AMD Athlon 64 FX (DP SledgeHammer SH7-CG)")
+   FMSQ( 0,15,  0, 7, 10, dA, "AMD Athlon 64 (DP SledgeHammer SH7-CG)")
+   FMS ( 0,15,  0, 7, 10,     "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7-CG)")
+   FMQ ( 0,15,  0, 7,     dF, "AMD Athlon 64 FX (DP SledgeHammer SH7)")
+   FMQ ( 0,15,  0, 7,     dA, "AMD Athlon 64 (DP SledgeHammer SH7)")
+   FM  ( 0,15,  0, 7,         "AMD Athlon 64 (unknown type) (DP SledgeHammer SH7)")
+   FMSQ( 0,15,  0, 8,  2, MS, "AMD mobile Sempron (ClawHammer CH7-CG)")
+   FMSQ( 0,15,  0, 8,  2, MX, "AMD mobile Athlon XP-M (ClawHammer CH7-CG)")
+   FMSQ( 0,15,  0, 8,  2, MA, "AMD mobile Athlon 64 (Odessa CH7-CG)")
+   FMSQ( 0,15,  0, 8,  2, dA, "AMD Athlon 64 (ClawHammer CH7-CG)")
+   FMS ( 0,15,  0, 8,  2,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7-CG)")
+   FMQ ( 0,15,  0, 8,     MS, "AMD mobile Sempron (Odessa CH7)")
+   FMQ ( 0,15,  0, 8,     MX, "AMD mobile Athlon XP-M (Odessa CH7)")
+   FMQ ( 0,15,  0, 8,     MA, "AMD mobile Athlon 64 (Odessa CH7)")
+   FMQ ( 0,15,  0, 8,     dA, "AMD Athlon 64 (ClawHammer CH7)")
+   FM  ( 0,15,  0, 8,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa CH7)")
+   FMS ( 0,15,  0,11,  2,     "AMD Athlon 64 (ClawHammer CH7-CG)")
+   FM  ( 0,15,  0,11,         "AMD Athlon 64 (ClawHammer CH7)")
+   FMSQ( 0,15,  0,12,  0, MS, "AMD mobile Sempron (Dublin DH7-CG)")
+   FMSQ( 0,15,  0,12,  0, dS, "AMD Sempron (Paris DH7-CG)")
+   FMSQ( 0,15,  0,12,  0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)")
+   FMSQ( 0,15,  0,12,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)")
+   FMSQ( 0,15,  0,12,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)")
+   FMS ( 0,15,  0,12,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)")
+   FMQ ( 0,15,  0,12,     MS, "AMD mobile Sempron (Dublin DH7)")
+   FMQ ( 0,15,  0,12,     dS, "AMD Sempron (Paris DH7)")
+   FMQ ( 0,15,  0,12,     MX, "AMD mobile Athlon XP-M (NewCastle DH7)")
+   FMQ ( 0,15,  0,12,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)")
+   FMQ ( 0,15,  0,12,     dA, "AMD Athlon 64 (NewCastle DH7)")
+   FM  ( 0,15,  0,12,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)")
+   FMSQ( 0,15,  0,14,  0, MS, "AMD mobile Sempron (Dublin DH7-CG)")
+   FMSQ( 0,15,  0,14,  0, dS, "AMD Sempron (Paris DH7-CG)")
+   FMSQ( 0,15,  0,14,  0, MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7-CG)")
+   FMSQ( 0,15,  0,14,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)")
+   FMSQ( 0,15,  0,14,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)")
+   FMS ( 0,15,  0,14,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7-CG)")
+   FMQ ( 0,15,  0,14,     dS, "AMD Sempron (Paris DH7)")
+   FMQ ( 0,15,  0,14,     MS, "AMD mobile Sempron (Dublin DH7)")
+   FMQ ( 0,15,  0,14,     MX, "AMD mobile Athlon XP-M (ClawHammer/Odessa DH7)")
+   FMQ ( 0,15,  0,14,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)")
+   FMQ ( 0,15,  0,14,     dA, "AMD Athlon 64 (NewCastle DH7)")
+   FM  ( 0,15,  0,14,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris/Dublin DH7)")
+   FMSQ( 0,15,  0,15,  0, dS, "AMD Sempron (Paris DH7-CG)")
+   FMSQ( 0,15,  0,15,  0, MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7-CG)")
+   FMSQ( 0,15,  0,15,  0, dA, "AMD Athlon 64 (NewCastle DH7-CG)")
+   FMS ( 0,15,  0,15,  0,     "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7-CG)")
+   FMQ ( 0,15,  0,15,     dS, "AMD Sempron (Paris DH7)")
+   FMQ ( 0,15,  0,15,     MA, "AMD mobile Athlon 64 (ClawHammer/Odessa DH7)")
+   FMQ ( 0,15,  0,15,     dA, "AMD Athlon 64 (NewCastle DH7)")
+   FM  ( 0,15,  0,15,         "AMD Athlon 64 (unknown type) (ClawHammer/Odessa/NewCastle/Paris DH7)")
+   FMSQ( 0,15,  1, 4,  0, MX, "AMD mobile Athlon XP-M (Oakville SH7-D0)")
+   FMSQ( 0,15,  1, 4,  0, MA, "AMD mobile Athlon 64 (Oakville SH7-D0)")
+   FMSQ( 0,15,  1, 4,  0, dA, "AMD Athlon 64 (Winchester SH7-D0)")
+   FMS ( 0,15,  1, 4,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7-D0)")
+   FMQ ( 0,15,  1, 4,     MX, "AMD mobile Athlon XP-M (Oakville SH7)")
+   FMQ ( 0,15,  1, 4,     MA, "AMD mobile Athlon 64 (Oakville SH7)")
+   FMQ ( 0,15,  1, 4,     dA, "AMD Athlon 64 (Winchester SH7)")
+   FM  ( 0,15,  1, 4,         "AMD Athlon 64 (unknown type) (Winchester/Oakville SH7)")
+   FMSQ( 0,15,  1, 5,  0, sO, "AMD Opteron (Winchester SH7-D0)")
+   FMSQ( 0,15,  1, 5,  0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)")
+   FMS ( 0,15,  1, 5,  0,     "AMD Athlon 64 (unknown type) (Winchester SH7-D0)")
+   FMQ ( 0,15,  1, 5,     sO, "AMD Opteron (Winchester SH7)")
+   FMQ ( 0,15,  1, 5,     dF, "AMD Athlon 64 FX (Winchester SH7)")
+   FM  ( 0,15,  1, 5,         "AMD Athlon 64 (unknown type) (Winchester SH7)")
+   FMSQ( 0,15,  1, 7,  0, dF, "AMD Athlon 64 FX (Winchester SH7-D0)")
+   FMSQ( 0,15,  1, 7,  0, dA, "AMD Athlon 64 (Winchester SH7-D0)")
+   FMS ( 0,15,  1, 7,  0,     "AMD Athlon 64 (unknown type) (Winchester SH7-D0)")
+   FMQ ( 0,15,  1, 7,     dF, "AMD Athlon 64 FX (Winchester SH7)")
+   FMQ ( 0,15,  1, 7,     dA, "AMD Athlon 64 (Winchester SH7)")
+   FM  ( 0,15,  1, 7,         "AMD Athlon 64 (unknown type) (Winchester SH7)")
+   FMSQ( 0,15,  1, 8,  0, MS, "AMD mobile Sempron (Georgetown/Sonora CH-D0)")
+   FMSQ( 0,15,  1, 8,  0, MX, "AMD mobile Athlon XP-M (Oakville CH-D0)")
+   FMSQ( 0,15,  1, 8,  0, MA, "AMD mobile Athlon 64 (Oakville CH-D0)")
+   FMSQ( 0,15,  1, 8,  0, dA, "AMD Athlon 64 (Winchester CH-D0)")
+   FMS ( 0,15,  1, 8,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH-D0)")
+   FMQ ( 0,15,  1, 8,     MS, "AMD mobile Sempron (Georgetown/Sonora CH)")
+   FMQ ( 0,15,  1, 8,     MX, "AMD mobile Athlon XP-M (Oakville CH)")
+   FMQ ( 0,15,  1, 8,     MA, "AMD mobile Athlon 64 (Oakville CH)")
+   FMQ ( 0,15,  1, 8,     dA, "AMD Athlon 64 (Winchester CH)")
+   FM  ( 0,15,  1, 8,         "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora CH)")
+   FMS ( 0,15,  1,11,  0,     "AMD Athlon 64 (Winchester CH-D0)")
+   FM  ( 0,15,  1,11,         "AMD Athlon 64 (Winchester CH)")
+   FMSQ( 0,15,  1,12,  0, MS, "AMD mobile Sempron (Georgetown/Sonora DH8-D0)")
+   FMSQ( 0,15,  1,12,  0, dS, "AMD Sempron (Palermo DH8-D0)")
+   FMSQ( 0,15,  1,12,  0, MX, "AMD Athlon XP-M (Winchester DH8-D0)")
+   FMSQ( 0,15,  1,12,  0, MA, "AMD mobile Athlon 64 (Oakville DH8-D0)")
+   FMSQ( 0,15,  1,12,  0, dA, "AMD Athlon 64 (Winchester DH8-D0)")
+   FMS ( 0,15,  1,12,  0,     "AMD Athlon 64 (unknown type) (Winchester/Oakville/Georgetown/Sonora/Palermo DH8-D0)")
+   FMQ ( 0,15,  1,12,     MS, "AMD mobile Sempron (Georgetown/Sonora DH8)")
+   FMQ ( 0,15,  1,12,     dS, "AMD Sempron (Palermo DH8)")
+   FMQ ( 0,15,  1,12,     MX, "AMD Athlon XP-M (Winchester DH8)")
+   FMQ ( 0,15,  1,12,     MA, "AMD mobile Athlon 64 (Oakville DH8)")
+   FMQ ( 0,15,  1,12,     dA, "AMD Athlon 64 (Winchester DH8)")
+   FM  ( 0,15,  1,12,         "AMD Athlon 64 (Winchester/Oakville/Georgetown/Sonora/Palermo DH8)")
+   FMSQ( 0,15,  1,15,  0, dS, "AMD Sempron (Palermo DH8-D0)")
+   FMSQ( 0,15,  1,15,  0, dA, "AMD Athlon 64 (Winchester DH8-D0)")
+   FMS ( 0,15,  1,15,  0,     "AMD Athlon 64 (Winchester DH8-D0) / Sempron (Palermo DH8-D0)")
+   FMQ ( 0,15,  1,15,     dS, "AMD Sempron (Palermo DH8)")
+   FMQ ( 0,15,  1,15,     dA, "AMD Athlon 64 (Winchester DH8)")
+   FM  ( 0,15,  1,15,         "AMD Athlon 64 (unknown type) (Winchester/Palermo DH8)")
+   FMSQ( 0,15,  2, 1,  0, s8, "AMD Dual Core Opteron (Egypt JH-E1)")
+   FMSQ( 0,15,  2, 1,  0, sO, "AMD Dual Core Opteron (Italy JH-E1)")
+   FMS ( 0,15,  2, 1,  0,     "AMD Dual Core Opteron (Italy/Egypt JH-E1)")
+   FMSQ( 0,15,  2, 1,  2, s8, "AMD Dual Core Opteron (Egypt JH-E6)")
+   FMSQ( 0,15,  2, 1,  2, sO, "AMD Dual Core Opteron (Italy JH-E6)")
+   FMS ( 0,15,  2, 1,  2,     "AMD Dual Core Opteron (Italy/Egypt JH-E6)")
+   FMQ ( 0,15,  2, 1,     s8, "AMD Dual Core Opteron (Egypt JH)")
+   FMQ ( 0,15,  2, 1,     sO, "AMD Dual Core Opteron (Italy JH)")
+   FM  ( 0,15,  2, 1,         "AMD Dual Core Opteron (Italy/Egypt JH)")
+   FMSQ( 0,15,  2, 3,  2, DO, "AMD Dual Core Opteron (Denmark JH-E6)")
+   FMSQ( 0,15,  2, 3,  2, dF, "AMD Athlon 64 FX (Toledo JH-E6)")
+   FMSQ( 0,15,  2, 3,  2, dm, "AMD Athlon 64 X2 (Manchester JH-E6)")
+   FMSQ( 0,15,  2, 3,  2, dA, "AMD Athlon 64 X2 (Toledo JH-E6)")
+   FMS ( 0,15,  2, 3,  2,     "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH-E6)")
+   FMQ ( 0,15,  2, 3,     sO, "AMD Dual Core Opteron (Denmark JH)")
+   FMQ ( 0,15,  2, 3,     dF, "AMD Athlon 64 FX (Toledo JH)")
+   FMQ ( 0,15,  2, 3,     dm, "AMD Athlon 64 X2 (Manchester JH)")
+   FMQ ( 0,15,  2, 3,     dA, "AMD Athlon 64 X2 (Toledo JH)")
+   FM  ( 0,15,  2, 3,         "AMD Athlon 64 (unknown type) (Toledo/Manchester/Denmark JH)")
+   FMSQ( 0,15,  2, 4,  2, MA, "AMD mobile Athlon 64 (Newark SH-E5)")
+   FMSQ( 0,15,  2, 4,  2, MT, "AMD mobile Turion (Lancaster/Richmond SH-E5)")
+   FMS ( 0,15,  2, 4,  2,     "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH-E5)")
+   FMQ ( 0,15,  2, 4,     MA, "AMD mobile Athlon 64 (Newark SH)")
+   FMQ ( 0,15,  2, 4,     MT, "AMD mobile Turion (Lancaster/Richmond SH)")
+   FM  ( 0,15,  2, 4,         "AMD mobile Athlon 64 (unknown type) (Newark/Lancaster/Richmond SH)")
+   FMQ ( 0,15,  2, 5,     s8, "AMD Opteron (Athens SH-E4)")
+   FMQ ( 0,15,  2, 5,     sO, "AMD Opteron (Troy SH-E4)")
+   FM  ( 0,15,  2, 5,         "AMD Opteron (Troy/Athens SH-E4)")
+   FMSQ( 0,15,  2, 7,  1, sO, "AMD Opteron (Venus SH-E4)")
+   FMSQ( 0,15,  2, 7,  1, dF, "AMD Athlon 64 FX (San Diego SH-E4)")
+   FMSQ( 0,15,  2, 7,  1, dA, "AMD Athlon 64 (San Diego SH-E4)")
+   FMS ( 0,15,  2, 7,  1,     "AMD Athlon 64 (unknown type) (Venus/San Diego SH-E4)")
+   FMQ ( 0,15,  2, 7,     sO, "AMD Opteron (San Diego SH)")
+   FMQ ( 0,15,  2, 7,     dF, "AMD Athlon 64 FX (San Diego SH)")
+   FMQ ( 0,15,  2, 7,     dA, "AMD Athlon 64 (San Diego SH)")
+   FM  ( 0,15,  2, 7,         "AMD Athlon 64 (unknown type) (San Diego SH)")
+   FM  ( 0,15,  2,11,         "AMD Athlon 64 X2 (Manchester BH-E4)")
+   FMS ( 0,15,  2,12,  0,     "AMD Sempron (Palermo DH-E3)")
+   FMSQ( 0,15,  2,12,  2, MS, "AMD mobile Sempron (Albany/Roma DH-E6)")
+   FMSQ( 0,15,  2,12,  2, dS, "AMD Sempron (Palermo DH-E6)")
+   FMSQ( 0,15,  2,12,  2, dA, "AMD Athlon 64 (Venice DH-E6)")
+   FMS ( 0,15,  2,12,  2,     "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH-E6)")
+   FMQ ( 0,15,  2,12,     MS, "AMD mobile Sempron (Albany/Roma DH)")
+   FMQ ( 0,15,  2,12,     dS, "AMD Sempron (Palermo DH)")
+   FMQ ( 0,15,  2,12,     dA, "AMD Athlon 64 (Venice DH)")
+   FM  ( 0,15,  2,12,         "AMD Athlon 64 (Venice/Palermo/Albany/Roma DH)")
+   FMSQ( 0,15,  2,15,  0, dS, "AMD Sempron (Palermo DH-E3)")
+   FMSQ( 0,15,  2,15,  0, dA, "AMD Athlon 64 (Venice DH-E3)")
+   FMS ( 0,15,  2,15,  0,     "AMD Athlon 64 (Venice/Palermo DH-E3)")
+   FMSQ( 0,15,  2,15,  2, dS, "AMD Sempron (Palermo DH-E6)")
+   FMSQ( 0,15,  2,15,  2, dA, "AMD Athlon 64 (Venice DH-E6)")
+   FMS ( 0,15,  2,15,  2,     "AMD Athlon 64 (Venice/Palermo DH-E6)")
+   FMQ ( 0,15,  2,15,     dS, "AMD Sempron (Palermo DH)")
+   FMQ ( 0,15,  2,15,     dA, "AMD Athlon 64 (Venice DH)")
+   FM  ( 0,15,  2,15,         "AMD Athlon 64 (Venice/Palermo DH)")
+   FMS ( 0,15,  4, 1,  2,     "AMD Dual-Core Opteron (Santa Rosa JH-F2)")
+   FMS ( 0,15,  4, 1,  3,     "AMD Dual-Core Opteron (Santa Rosa JH-F3)")
+   FM  ( 0,15,  4, 1,         "AMD Dual-Core Opteron (Santa Rosa)")
+   FMSQ( 0,15,  4, 3,  2, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F2)")
+   FMSQ( 0,15,  4, 3,  2, sO, "AMD Opteron (Santa Rosa JH-F2)")
+   FMSQ( 0,15,  4, 3,  2, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F2)")
+   FMSQ( 0,15,  4, 3,  2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F2)")
+   FMS ( 0,15,  4, 3,  2,     "AMD Athlon 64 (unknown type) (Windsor JH-F2)")
+   FMSQ( 0,15,  4, 3,  3, DO, "AMD Dual-Core Opteron (Santa Rosa JH-F3)")
+   FMSQ( 0,15,  4, 3,  3, sO, "AMD Opteron (Santa Rosa JH-F3)")
+   FMSQ( 0,15,  4, 3,  3, dF, "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)")
+   FMSQ( 0,15,  4, 3,  3, dA, "AMD Athlon 64 X2 Dual-Core (Windsor JH-F3)")
+   FMS ( 0,15,  4, 3,  3,     "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa JH-F3)")
+   FMQ ( 0,15,  4, 3,     DO, "AMD Dual-Core Opteron (Santa Rosa)")
+   FMQ ( 0,15,  4, 3,     sO, "AMD Opteron (Santa Rosa)")
+   FMQ ( 0,15,  4, 3,     dF, "AMD Athlon 64 FX Dual-Core (Windsor)")
+   FMQ ( 0,15,  4, 3,     dA, "AMD Athlon 64 X2 Dual-Core (Windsor)")
+   FM  ( 0,15,  4, 3,         "AMD Athlon 64 (unknown type) (Windsor/Santa Rosa)")
+   FMSQ( 0,15,  4, 8,  2, dA, "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)")
+   FMSQ( 0,15,  4, 8,  2, Mt, "AMD Turion 64 X2 (Trinidad BH-F2)")
+   FMSQ( 0,15,  4, 8,  2, MT, "AMD Turion 64 X2 (Taylor BH-F2)")
+   FMS ( 0,15,  4, 8,  2,     "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad BH-F2)")
+   FMQ ( 0,15,  4, 8,     dA, "AMD Athlon 64 X2 Dual-Core (Windsor)")
+   FMQ ( 0,15,  4, 8,     Mt, "AMD Turion 64 X2 (Trinidad)")
+   FMQ ( 0,15,  4, 8,     MT, "AMD Turion 64 X2 (Taylor)")
+   FM  ( 0,15,  4, 8,         "AMD Athlon 64 (unknown type) (Windsor/Taylor/Trinidad)")
+   FMS ( 0,15,  4,11,  2,     "AMD Athlon 64 X2 Dual-Core (Windsor BH-F2)")
+   FM  ( 0,15,  4,11,         "AMD Athlon 64 X2 Dual-Core (Windsor)")
+   FMSQ( 0,15,  4,12,  2, MS, "AMD mobile Sempron (Keene BH-F2)")
+   FMSQ( 0,15,  4,12,  2, dS, "AMD Sempron (Manila BH-F2)")
+   FMSQ( 0,15,  4,12,  2, Mt, "AMD Turion (Trinidad BH-F2)")
+   FMSQ( 0,15,  4,12,  2, MT, "AMD Turion (Taylor BH-F2)")
+   FMSQ( 0,15,  4,12,  2, dA, "AMD Athlon 64 (Orleans BH-F2)")
+   FMS ( 0,15,  4,12,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad BH-F2)")
+   FMQ ( 0,15,  4,12,     MS, "AMD mobile Sempron (Keene)")
+   FMQ ( 0,15,  4,12,     dS, "AMD Sempron (Manila)")
+   FMQ ( 0,15,  4,12,     Mt, "AMD Turion (Trinidad)")
+   FMQ ( 0,15,  4,12,     MT, "AMD Turion (Taylor)")
+   FMQ ( 0,15,  4,12,     dA, "AMD Athlon 64 (Orleans)")
+   FM  ( 0,15,  4,12,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene/Taylor/Trinidad)")
+   FMSQ( 0,15,  4,15,  2, MS, "AMD mobile Sempron (Keene DH-F2)")
+   FMSQ( 0,15,  4,15,  2, dS, "AMD Sempron (Manila DH-F2)")
+   FMSQ( 0,15,  4,15,  2, dA, "AMD Athlon 64 (Orleans DH-F2)")
+   FMS ( 0,15,  4,15,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)")
+   FMQ ( 0,15,  4,15,     MS, "AMD mobile Sempron (Keene)")
+   FMQ ( 0,15,  4,15,     dS, "AMD Sempron (Manila)")
+   FMQ ( 0,15,  4,15,     dA, "AMD Athlon 64 (Orleans)")
+   FM  ( 0,15,  4,15,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)")
+   FMS ( 0,15,  5,13,  3,     "AMD Opteron (Santa Rosa JH-F3)")
+   FM  ( 0,15,  5,13,         "AMD Opteron (Santa Rosa)")
+   FMSQ( 0,15,  5,15,  2, MS, "AMD mobile Sempron (Keene DH-F2)")
+   FMSQ( 0,15,  5,15,  2, dS, "AMD Sempron (Manila DH-F2)")
+   FMSQ( 0,15,  5,15,  2, dA, "AMD Athlon 64 (Orleans DH-F2)")
+   FMS ( 0,15,  5,15,  2,     "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene DH-F2)")
+   FMS ( 0,15,  5,15,  3,     "AMD Athlon 64 (Orleans DH-F3)")
+   FMQ ( 0,15,  5,15,     MS, "AMD mobile Sempron (Keene)")
+   FMQ ( 0,15,  5,15,     dS, "AMD Sempron (Manila)")
+   FMQ ( 0,15,  5,15,     dA, "AMD Athlon 64 (Orleans)")
+   FM  ( 0,15,  5,15,         "AMD Athlon 64 (unknown type) (Orleans/Manila/Keene)")
+   FM  ( 0,15,  5,15,         "AMD Athlon 64 (Orleans)")
+   FMS ( 0,15,  6, 8,  1,     "AMD Turion 64 X2 (Tyler BH-G1)")
+   FMSQ( 0,15,  6, 8,  2, MT, "AMD Turion 64 X2 (Tyler BH-G2)")
+   FMSQ( 0,15,  6, 8,  2, dS, "AMD Sempron Dual-Core (Tyler BH-G2)")
+   FMS ( 0,15,  6, 8,  2,     "AMD Turion 64 (unknown type) (Tyler BH-G2)")
+   FMQ ( 0,15,  6, 8,     MT, "AMD Turion 64 X2 (Tyler)")
+   FMQ ( 0,15,  6, 8,     dS, "AMD Sempron Dual-Core (Tyler)")
+   FM  ( 0,15,  6, 8,         "AMD Turion 64 (unknown type) (Tyler)")
+   FMSQ( 0,15,  6,11,  1, dS, "AMD Sempron Dual-Core (Sparta BH-G1)")
+   FMSQ( 0,15,  6,11,  1, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G1)")
+   FMS ( 0,15,  6,11,  1,     "AMD Athlon 64 (unknown type) (Brisbane/Sparta BH-G1)")
+   FMSQ( 0,15,  6,11,  2, dA, "AMD Athlon 64 X2 Dual-Core (Brisbane BH-G2)")
+   FMSQ( 0,15,  6,11,  2, Mn, "AMD Turion Neo X2 Dual-Core (Huron BH-G2)")
+   FMSQ( 0,15,  6,11,  2, MN, "AMD Athlon Neo X2 (Huron BH-G2)")
+   FMS ( 0,15,  6,11,  2,     "AMD Athlon 64 (unknown type) (Brisbane/Huron BH-G2)")
+   FMQ ( 0,15,  6,11,     dS, "AMD Sempron Dual-Core (Sparta)")
+   FMQ ( 0,15,  6,11,     Mn, "AMD Turion Neo X2 Dual-Core (Huron)")
+   FMQ ( 0,15,  6,11,     MN, "AMD Athlon Neo X2 (Huron)")
+   FMQ ( 0,15,  6,11,     dA, "AMD Athlon 64 X2 Dual-Core (Brisbane)")
+   FM  ( 0,15,  6,11,         "AMD Athlon 64 (unknown type) (Brisbane/Sparta/Huron)")
+   FMSQ( 0,15,  6,12,  2, MS, "AMD mobile Sempron (Sherman DH-G2)")
+   FMSQ( 0,15,  6,12,  2, dS, "AMD Sempron (Sparta DH-G2)")
+   FMSQ( 0,15,  6,12,  2, dA, "AMD Athlon 64 (Lima DH-G2)")
+   FMS ( 0,15,  6,12,  2,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G2)")
+   FMQ ( 0,15,  6,12,     MS, "AMD mobile Sempron (Sherman)")
+   FMQ ( 0,15,  6,12,     dS, "AMD Sempron (Sparta)")
+   FMQ ( 0,15,  6,12,     dA, "AMD Athlon 64 (Lima)")
+   FM  ( 0,15,  6,12,         "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman)")
+   FMSQ( 0,15,  6,15,  2, MS, "AMD mobile Sempron (Sherman DH-G2)")
+   FMSQ( 0,15,  6,15,  2, dS, "AMD Sempron (Sparta DH-G2)")
+   FMSQ( 0,15,  6,15,  2, MN, "AMD Athlon Neo (Huron DH-G2)")
+   FMS ( 0,15,  6,15,  2,     "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman DH-G2)")
+   FMQ ( 0,15,  6,15,     MS, "AMD mobile Sempron (Sherman)")
+   FMQ ( 0,15,  6,15,     dS, "AMD Sempron (Sparta)")
+   FMQ ( 0,15,  6,15,     MN, "AMD Athlon Neo (Huron)")
+   FM  ( 0,15,  6,15,         "AMD Athlon Neo (unknown type) (Huron/Sparta/Sherman)")
+   FMSQ( 0,15,  7,12,  2, MS, "AMD mobile Sempron (Sherman DH-G2)")
+   FMSQ( 0,15,  7,12,  2, dS, "AMD Sempron (Sparta DH-G2)")
+   FMSQ( 0,15,  7,12,  2, dA, "AMD Athlon (Lima DH-G2)")
+   FMS ( 0,15,  7,12,  2,     "AMD Athlon (unknown type) (Lima/Sparta/Sherman DH-G2)")
+   FMQ ( 0,15,  7,12,     MS, "AMD mobile Sempron (Sherman)")
+   FMQ ( 0,15,  7,12,     dS, "AMD Sempron (Sparta)")
+   FMQ ( 0,15,  7,12,     dA, "AMD Athlon (Lima)")
+   FM  ( 0,15,  7,12,         "AMD Athlon (unknown type) (Lima/Sparta/Sherman)")
+   FMSQ( 0,15,  7,15,  1, MS, "AMD mobile Sempron (Sherman DH-G1)")
+   FMSQ( 0,15,  7,15,  1, dS, "AMD Sempron (Sparta DH-G1)")
+   FMSQ( 0,15,  7,15,  1, dA, "AMD Athlon 64 (Lima DH-G1)")
+   FMS ( 0,15,  7,15,  1,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman DH-G1)")
+   FMSQ( 0,15,  7,15,  2, MS, "AMD mobile Sempron (Sherman DH-G2)")
+   FMSQ( 0,15,  7,15,  2, dS, "AMD Sempron (Sparta DH-G2)")
+   FMSQ( 0,15,  7,15,  2, MN, "AMD Athlon Neo (Huron DH-G2)")
+   FMSQ( 0,15,  7,15,  2, dA, "AMD Athlon 64 (Lima DH-G2)")
+   FMS ( 0,15,  7,15,  2,     "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron DH-G2)")
+   FMQ ( 0,15,  7,15,     MS, "AMD mobile Sempron (Sherman)")
+   FMQ ( 0,15,  7,15,     dS, "AMD Sempron (Sparta)")
+   FMQ ( 0,15,  7,15,     MN, "AMD Athlon Neo (Huron)")
+   FMQ ( 0,15,  7,15,     dA, "AMD Athlon 64 (Lima)")
+   FM  ( 0,15,  7,15,         "AMD Athlon 64 (unknown type) (Lima/Sparta/Sherman/Huron)")
+   FMS ( 0,15, 12, 1,  3,     "AMD Athlon 64 FX Dual-Core (Windsor JH-F3)")
+   FM  ( 0,15, 12, 1,         "AMD Athlon 64 FX Dual-Core (Windsor)")
+   F   ( 0,15,                "AMD (unknown model)")
+   FMS ( 1,15,  0, 0,  0,     "AMD (unknown type) (Barcelona DR-A0)") // sandpile.org
+   FMS ( 1,15,  0, 0,  1,     "AMD (unknown type) (Barcelona DR-A1)") // sandpile.org
+   FMS ( 1,15,  0, 0,  2,     "AMD (unknown type) (Barcelona DR-A2)") // sandpile.org
+   FMS ( 1,15,  0, 2,  0,     "AMD (unknown type) (Barcelona DR-B0)") // sandpile.org
+   FMSQ( 1,15,  0, 2,  1, sO, "AMD Quad-Core Opteron (Barcelona DR-B1)")
+   FMS ( 1,15,  0, 2,  1,     "AMD (unknown type) (Barcelona DR-B1)")
+   FMSQ( 1,15,  0, 2,  2, EO, "AMD Embedded Opteron (Barcelona DR-B2)")
+   FMSQ( 1,15,  0, 2,  2, sO, "AMD Quad-Core Opteron (Barcelona DR-B2)")
+   FMSQ( 1,15,  0, 2,  2, Tp, "AMD Phenom Triple-Core (Toliman DR-B2)")
+   FMSQ( 1,15,  0, 2,  2, Qp, "AMD Phenom Quad-Core (Agena DR-B2)")
+   FMS ( 1,15,  0, 2,  2,     "AMD (unknown type) (Barcelona/Toliman/Agena DR-B2)")
+   FMSQ( 1,15,  0, 2,  3, EO, "AMD Embedded Opteron (Barcelona DR-B3)")
+   FMSQ( 1,15,  0, 2,  3, sO, "AMD Quad-Core Opteron (Barcelona DR-B3)")
+   FMSQ( 1,15,  0, 2,  3, Tp, "AMD Phenom Triple-Core (Toliman DR-B3)")
+   FMSQ( 1,15,  0, 2,  3, Qp, "AMD Phenom Quad-Core (Agena DR-B3)")
+   FMSQ( 1,15,  0, 2,  3, dA, "AMD Athlon Dual-Core (Kuma DR-B3)")
+   FMS ( 1,15,  0, 2,  3,     "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma DR-B3)")
+   FMS ( 1,15,  0, 2, 10,     "AMD Quad-Core Opteron (Barcelona DR-BA)")
+   FMQ ( 1,15,  0, 2,     EO, "AMD Embedded Opteron (Barcelona)")
+   FMQ ( 1,15,  0, 2,     sO, "AMD Quad-Core Opteron (Barcelona)")
+   FMQ ( 1,15,  0, 2,     Tp, "AMD Phenom Triple-Core (Toliman)")
+   FMQ ( 1,15,  0, 2,     Qp, "AMD Phenom Quad-Core (Agena)")
+   FMQ ( 1,15,  0, 2,     dA, "AMD Athlon Dual-Core (Kuma)")
+   FM  ( 1,15,  0, 2,         "AMD (unknown type) (Barcelona/Toliman/Agena/Kuma)")
+   FMS ( 1,15,  0, 4,  0,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C0)") // sandpile.org
+   FMS ( 1,15,  0, 4,  1,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C1)") // sandpile.org
+   FMSQ( 1,15,  0, 4,  2, EO, "AMD Embedded Opteron (Shanghai RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, sO, "AMD Quad-Core Opteron (Shanghai RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, dr, "AMD Athlon Dual-Core (Propus RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, dA, "AMD Athlon Dual-Core (Regor RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, Dp, "AMD Phenom II X2 (Callisto RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, Tp, "AMD Phenom II X3 (Heka RB-C2)")
+   FMSQ( 1,15,  0, 4,  2, Qp, "AMD Phenom II X4 (Deneb RB-C2)")
+   FMS ( 1,15,  0, 4,  2,     "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb RB-C2)")
+   FMSQ( 1,15,  0, 4,  3, Dp, "AMD Phenom II X2 (Callisto RB-C3)")
+   FMSQ( 1,15,  0, 4,  3, Tp, "AMD Phenom II X3 (Heka RB-C3)")
+   FMSQ( 1,15,  0, 4,  3, Qp, "AMD Phenom II X4 (Deneb RB-C3)")
+   FMS ( 1,15,  0, 4,  3,     "AMD Phenom II (unknown type) (Callisto/Heka/Deneb RB-C3)")
+   FMQ ( 1,15,  0, 4,     EO, "AMD Embedded Opteron (Shanghai)")
+   FMQ ( 1,15,  0, 4,     sO, "AMD Quad-Core Opteron (Shanghai)")
+   FMQ ( 1,15,  0, 4,     dr, "AMD Athlon Dual-Core (Propus)")
+   FMQ ( 1,15,  0, 4,     dA, "AMD Athlon Dual-Core (Regor)")
+   FMQ ( 1,15,  0, 4,     Dp, "AMD Phenom II X2 (Callisto)")
+   FMQ ( 1,15,  0, 4,     Tp, "AMD Phenom II X3 (Heka)")
+   FMQ ( 1,15,  0, 4,     Qp, "AMD Phenom II X4 (Deneb)")
+   FM  ( 1,15,  0, 4,         "AMD Athlon (unknown type) (Regor/Propus/Shanghai/Callisto/Heka/Deneb)")
+   FMS ( 1,15,  0, 5,  0,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C0)") // sandpile.org
+   FMS ( 1,15,  0, 5,  1,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C1)") // sandpile.org
+   FMSQ( 1,15,  0, 5,  2, DA, "AMD Athlon II X2 (Regor BL-C2)")
+   FMSQ( 1,15,  0, 5,  2, TA, "AMD Athlon II X3 (Rana BL-C2)")
+   FMSQ( 1,15,  0, 5,  2, QA, "AMD Athlon II X4 (Propus BL-C2)")
+   FMS ( 1,15,  0, 5,  2,     "AMD Athlon (unknown type) (Regor/Rana/Propus BL-C2)")
+   FMSQ( 1,15,  0, 5,  3, TA, "AMD Athlon II X3 (Rana BL-C3)")
+   FMSQ( 1,15,  0, 5,  3, QA, "AMD Athlon II X4 (Propus BL-C3)")
+   FMSQ( 1,15,  0, 5,  3, Tp, "AMD Phenom II Triple-Core (Heka BL-C3)")
+   FMSQ( 1,15,  0, 5,  3, Qp, "AMD Phenom II Quad-Core (Deneb BL-C3)")
+   FMS ( 1,15,  0, 5,  3,     "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb BL-C3)")
+   FMQ ( 1,15,  0, 5,     DA, "AMD Athlon II X2 (Regor)")
+   FMQ ( 1,15,  0, 5,     TA, "AMD Athlon II X3 (Rana)")
+   FMQ ( 1,15,  0, 5,     QA, "AMD Athlon II X4 (Propus)")
+   FMQ ( 1,15,  0, 5,     Tp, "AMD Phenom II Triple-Core (Heka)")
+   FMQ ( 1,15,  0, 5,     Qp, "AMD Phenom II Quad-Core (Deneb)")
+   FM  ( 1,15,  0, 5,         "AMD Athlon (unknown type) (Regor/Rana/Propus/Callisto/Heka/Deneb)")
+   FMS ( 1,15,  0, 6,  0,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C0)")
+   FMS ( 1,15,  0, 6,  1,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C1)")
+   FMSQ( 1,15,  0, 6,  2, MS, "AMD Sempron Mobile (Sargas DA-C2)")
+   FMSQ( 1,15,  0, 6,  2, dS, "AMD Sempron II (Sargas DA-C2)")
+   FMSQ( 1,15,  0, 6,  2, MT, "AMD Turion II Dual-Core Mobile (Caspian DA-C2)")
+   FMSQ( 1,15,  0, 6,  2, MA, "AMD Athlon II Dual-Core Mobile (Regor DA-C2)")
+   FMSQ( 1,15,  0, 6,  2, DA, "AMD Athlon II X2 (Regor DA-C2)")
+   FMSQ( 1,15,  0, 6,  2, dA, "AMD Athlon II (Sargas DA-C2)")
+   FMS ( 1,15,  0, 6,  2,     "AMD Athlon (unknown type) (Regor/Sargas/Caspain DA-C2)")
+   FMSQ( 1,15,  0, 6,  3, Ms, "AMD V-Series Mobile (Champlain DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, DS, "AMD Sempron II X2 (Regor DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, dS, "AMD Sempron II (Sargas DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, MT, "AMD Turion II Dual-Core Mobile (Champlain DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, Mp, "AMD Phenom II Dual-Core Mobile (Champlain DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, MA, "AMD Athlon II Dual-Core Mobile (Champlain DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, DA, "AMD Athlon II X2 (Regor DA-C3)")
+   FMSQ( 1,15,  0, 6,  3, dA, "AMD Athlon II (Sargas DA-C3)")
+   FMS ( 1,15,  0, 6,  3,     "AMD Athlon (unknown type) (Regor/Sargas/Champlain DA-C3)")
+   FMQ ( 1,15,  0, 6,     Ms, "AMD V-Series Mobile (Champlain)")
+   FMQ ( 1,15,  0, 6,     MS, "AMD Sempron Mobile (Sargas)")
+   FMQ ( 1,15,  0, 6,     DS, "AMD Sempron II X2 (Regor)")
+   FMQ ( 1,15,  0, 6,     dS, "AMD Sempron II (Sargas)")
+   FMQ ( 1,15,  0, 6,     MT, "AMD Turion II Dual-Core Mobile (Caspian / Champlain)")
+   FMQ ( 1,15,  0, 6,     Mp, "AMD Phenom II Dual-Core Mobile (Champlain)")
+   FMQ ( 1,15,  0, 6,     MA, "AMD Athlon II Dual-Core Mobile (Regor / Champlain)")
+   FMQ ( 1,15,  0, 6,     DA, "AMD Athlon II X2 (Regor)")
+   FMQ ( 1,15,  0, 6,     dA, "AMD Athlon II (Sargas)")
+   FM  ( 1,15,  0, 6,         "AMD Athlon (unknown type) (Regor/Sargas/Caspian/Champlain)")
+   FMSQ( 1,15,  0, 8,  0, SO, "AMD Six-Core Opteron (Istanbul HY-D0)")
+   FMSQ( 1,15,  0, 8,  0, sO, "AMD Opteron 4100 (Lisbon HY-D0)")
+   FMS ( 1,15,  0, 8,  0,     "AMD Opteron (unknown type) (Lisbon/Istanbul HY-D0)")
+   FMS ( 1,15,  0, 8,  1,     "AMD Opteron 4100 (Lisbon HY-D1)")
+   FMQ ( 1,15,  0, 8,     SO, "AMD Six-Core Opteron (Istanbul)")
+   FMQ ( 1,15,  0, 8,     sO, "AMD Opteron 4100 (Lisbon)")
+   FM  ( 1,15,  0, 8,         "AMD Opteron (unknown type) (Lisbon/Istanbul)")
+   FMS ( 1,15,  0, 9,  0,     "AMD Opteron 6100 (Magny-Cours HY-D0)") // sandpile.org
+   FMS ( 1,15,  0, 9,  1,     "AMD Opteron 6100 (Magny-Cours HY-D1)")
+   FM  ( 1,15,  0, 9,         "AMD Opteron 6100 (Magny-Cours)")
+   FMSQ( 1,15,  0,10,  0, Qp, "AMD Phenom II X4 (Zosma PH-E0)")
+   FMSQ( 1,15,  0,10,  0, Sp, "AMD Phenom II X6 (Thuban PH-E0)")
+   FMS ( 1,15,  0,10,  0,     "AMD Phenom II (unknown type) (Zosma/Thuban PH-E0)")
+   FMQ ( 1,15,  0,10,     Qp, "AMD Phenom II X4 (Zosma)")
+   FMQ ( 1,15,  0,10,     Sp, "AMD Phenom II X6 (Thuban)")
+   FM  ( 1,15,  0,10,         "AMD Phenom II (unknown type) (Zosma/Thuban)")
+   F   ( 1,15,                "AMD (unknown model)")
+   FMSQ( 2,15,  0, 3,  1, MU, "AMD Turion X2 Ultra Dual-Core Mobile (Griffin LG-B1)")
+   FMSQ( 2,15,  0, 3,  1, MT, "AMD Turion X2 Dual-Core Mobile (Lion LG-B1)")
+   FMSQ( 2,15,  0, 3,  1, DS, "AMD Sempron X2 Dual-Core (Sable LG-B1)")
+   FMSQ( 2,15,  0, 3,  1, dS, "AMD Sempron (Sable LG-B1)")
+   FMSQ( 2,15,  0, 3,  1, DA, "AMD Athlon X2 Dual-Core (Lion LG-B1)")
+   FMSQ( 2,15,  0, 3,  1, dA, "AMD Athlon (Lion LG-B1)")
+   FMS ( 2,15,  0, 3,  1,     "AMD Athlon (unknown type) (Lion/Sable LG-B1)")
+   FMQ ( 2,15,  0, 3,     MU, "AMD Turion X2 Ultra (Griffin)")
+   FMQ ( 2,15,  0, 3,     MT, "AMD Turion X2 (Lion)")
+   FMQ ( 2,15,  0, 3,     DS, "AMD Sempron X2 Dual-Core (Sable)")
+   FMQ ( 2,15,  0, 3,     dS, "AMD Sempron (Sable)")
+   FMQ ( 2,15,  0, 3,     DA, "AMD Athlon X2 Dual-Core (Lion)")
+   FMQ ( 2,15,  0, 3,     dA, "AMD Athlon (Lion)")
+   FM  ( 2,15,  0, 3,         "AMD Athlon (unknown type) (Lion/Sable)")
+   F   ( 2,15,                "AMD (unknown model)")
+   FMS ( 3,15,  0, 0,  0,     "AMD Athlon (unknown type) (Llano LN-A0)") // sandpile.org
+   FMS ( 3,15,  0, 0,  1,     "AMD Athlon (unknown type) (Llano LN-A1)") // sandpile.org
+   FMSQ( 3,15,  0, 1,  0, dS, "AMD Sempron Dual-Core (Llano LN-B0)")
+   FMSQ( 3,15,  0, 1,  0, dA, "AMD Athlon II Dual-Core (Llano LN-B0)")
+   FMSQ( 3,15,  0, 1,  0, Sa, "AMD A-Series (Llano LN-B0)")
+   FMSQ( 3,15,  0, 1,  0, Se, "AMD E2-Series (Llano LN-B0)")
+   FMS ( 3,15,  0, 1,  0,     "AMD Athlon (unknown type) (Llano LN-B0)")
+   FMQ ( 3,15,  0, 1,     dS, "AMD Sempron Dual-Core (Llano)")
+   FMQ ( 3,15,  0, 1,     dA, "AMD Athlon II Dual-Core (Llano)")
+   FMQ ( 3,15,  0, 1,     Sa, "AMD A-Series (Llano)")
+   FMQ ( 3,15,  0, 1,     Se, "AMD E2-Series (Llano)")
+   FM  ( 3,15,  0, 1,         "AMD Athlon (unknown type) (Llano)")
+   FMS ( 3,15,  0, 2,  0,     "AMD Athlon (unknown type) (Llano LN-B0)") // sandpile.org
+   F   ( 3,15,                "AMD (unknown model) (Llano)")
+   FMSQ( 5,15,  0, 1,  0, Sc, "AMD C-Series (Ontario ON-B0)")
+   FMSQ( 5,15,  0, 1,  0, Se, "AMD E-Series (Zacate ON-B0)")
+   FMSQ( 5,15,  0, 1,  0, Sg, "AMD G-Series (Ontario/Zacate ON-B0)")
+   FMSQ( 5,15,  0, 1,  0, Sz, "AMD Z-Series (Desna ON-B0)")
+   FMS ( 5,15,  0, 1,  0,     "AMD (unknown type) (Ontario/Zacate/Desna ON-B0)")
+   FM  ( 5,15,  0, 1,         "AMD (unknown type) (Ontario/Zacate/Desna)")
+   FMSQ( 5,15,  0, 2,  0, Sc, "AMD C-Series (Ontario ON-C0)")
+   FMSQ( 5,15,  0, 2,  0, Se, "AMD E-Series (Zacate ON-C0)")
+   FMSQ( 5,15,  0, 2,  0, Sg, "AMD G-Series (Ontario/Zacate ON-C0)")
+   FMSQ( 5,15,  0, 2,  0, Sz, "AMD Z-Series (Desna ON-C0)")
+   FMS ( 5,15,  0, 2,  0,     "AMD (unknown type) (Ontario/Zacate/Desna ON-C0)")
+   FM  ( 5,15,  0, 2,         "AMD (unknown type) (Ontario/Zacate/Desna)")
+   F   ( 5,15,                "AMD (unknown model)")
+   FMS ( 6,15,  0, 0,  0,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A0)") // sandpile.org
+   FMS ( 6,15,  0, 0,  1,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-A1)") // sandpile.org
+   FMS ( 6,15,  0, 1,  0,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B0)") // sandpile.org
+   FMS ( 6,15,  0, 1,  1,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B1)") // sandpile.org
+   FMSQ( 6,15,  0, 1,  2, sO, "AMD Opteron 6200 (Interlagos OR-B2) / Opteron 4200 (Valencia OR-B2) / Opteron 3200 (Zurich OR-B2)")
+   FMSQ( 6,15,  0, 1,  2, df, "AMD FX-Series (Zambezi OR-B2)")
+   FMS ( 6,15,  0, 1,  2,     "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi OR-B2)")
+   FMQ ( 6,15,  0, 1,     sO, "AMD Opteron 6200 (Interlagos) / Opteron 4200 (Valencia) / Opteron 3200 (Zurich)")
+   FMQ ( 6,15,  0, 1,     df, "AMD FX-Series (Zambezi)")
+   FM  ( 6,15,  0, 1,         "AMD (unknown type) (Interlagos/Valencia/Zurich/Zambezi)")
+   FMSQ( 6,15,  0, 2,  0, sO, "AMD Opteron 6300 (Abu Dhabi OR-C0) / Opteron 4300 (Seoul OR-C0) / Opteron 3300 (Delhi OR-C0)")
+   FMSQ( 6,15,  0, 2,  0, df, "AMD FX-Series (Vishera OR-C0)")
+   FMS ( 6,15,  0, 2,  0,     "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera OR-C0)")
+   FMQ ( 6,15,  0, 2,     sO, "AMD Opteron 6300 (Abu Dhabi) / Opteron 4300 (Seoul) / Opteron 3300 (Delhi)")
+   FMQ ( 6,15,  0, 2,     df, "AMD FX-Series (Vishera)")
+   FM  ( 6,15,  0, 2,         "AMD (unknown type) (Abu Dhabi/Seoul/Delhi/Vishera)")
+   FMSQ( 6,15,  1, 0,  1, Sa, "AMD A-Series (Trinity TN-A1)")
+   FMSQ( 6,15,  1, 0,  1, Sr, "AMD R-Series (Trinity TN-A1)")
+   FMSQ( 6,15,  1, 0,  1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity TN-A1)")
+   FMSQ( 6,15,  1, 0,  1, dS, "AMD Sempron Dual-Core (Trinity TN-A1)")
+   FMSQ( 6,15,  1, 0,  1, dI, "AMD FirePro (Trinity TN-A1)")
+   FMS ( 6,15,  1, 0,  1,     "AMD (unknown type) (Trinity TN-A1)")
+   FMQ ( 6,15,  1, 0,     Sa, "AMD A-Series (Trinity)")
+   FMQ ( 6,15,  1, 0,     Sr, "AMD R-Series (Trinity)")
+   FMQ ( 6,15,  1, 0,     dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Trinity)")
+   FMQ ( 6,15,  1, 0,     dS, "AMD Sempron Dual-Core (Trinity)")
+   FMQ ( 6,15,  1, 0,     dI, "AMD FirePro (Trinity)")
+   FM  ( 6,15,  1, 0,         "AMD (unknown type) (Trinity TN-A1)")
+   FMSQ( 6,15,  1, 3,  1, Sa, "AMD A-Series (Richland RL-A1)")
+   FMSQ( 6,15,  1, 3,  1, Sr, "AMD R-Series (Richland RL-A1)")
+   FMSQ( 6,15,  1, 3,  1, dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland RL-A1)")
+   FMSQ( 6,15,  1, 3,  1, dS, "AMD Sempron Dual-Core (Richland RL-A1)")
+   FMSQ( 6,15,  1, 3,  1, dI, "AMD FirePro (Richland RL-A1)")
+   FMS ( 6,15,  1, 3,  1,     "AMD (unknown type) (Richland RL-A1)")
+   FMQ ( 6,15,  1, 3,     Sa, "AMD A-Series (Richland)")
+   FMQ ( 6,15,  1, 3,     Sr, "AMD R-Series (Richland)")
+   FMQ ( 6,15,  1, 3,     dA, "AMD Athlon Dual-Core / Athlon Quad-Core (Richland)")
+   FMQ ( 6,15,  1, 3,     dS, "AMD Sempron Dual-Core (Richland)")
+   FMQ ( 6,15,  1, 3,     dI, "AMD FirePro (Richland)")
+   FM  ( 6,15,  1, 3,         "AMD (unknown type) (Richland)")
+   FMS ( 6,15,  3, 0,  0,     "AMD (unknown type) (Kaveri KV-A0)")
+   FMSQ( 6,15,  3, 0,  1, Sa, "AMD Elite Performance A-Series (Kaveri KV-A1)")
+   FMSQ( 6,15,  3, 0,  1, Mr, "AMD Mobile R-Series (Kaveri KV-A1)")
+   FMSQ( 6,15,  3, 0,  1, sO, "AMD Opteron X1200 / X2200 (Kaveri KV-A1)")
+   FMS ( 6,15,  3, 0,  1,     "AMD (unknown type) (Kaveri KV-A1)")
+   FMQ ( 6,15,  3, 0,     Sa, "AMD Elite Performance A-Series (Kaveri)")
+   FMQ ( 6,15,  3, 0,     Mr, "AMD Mobile R-Series (Kaveri)")
+   FMQ ( 6,15,  3, 0,     sO, "AMD Opteron X1200 / X2200 (Kaveri)")
+   FM  ( 6,15,  3, 0,         "AMD (unknown type) (Kaveri)")
+   FMSQ( 6,15,  3, 8,  1, Sa, "AMD A-Series (Godavari A1)") // sandpile.org
+   FMS ( 6,15,  3, 8,  1,     "AMD (unknown type) (Godavari A1)") // sandpile.org
+   FMQ ( 6,15,  3, 8,     Sa, "AMD A-Series (Godavari)")
+   FM  ( 6,15,  3, 8,         "AMD (unknown type) (Godavari)")
+   FMS ( 6,15,  6, 0,  0,     "AMD (unknown type) (Carrizo/Toronto CZ-A0)") // sandpile.org
+   FMSQ( 6,15,  6, 0,  1, sO, "AMD Opteron (Toronto CZ-A1)") // undocumented, but instlatx64 sample
+   FMSQ( 6,15,  6, 0,  1, df, "AMD FX-Series (Carrizo CZ-A1)") // undocumented, but instlatx64 sample
+   FMS ( 6,15,  6, 0,  1,     "AMD (unknown type) (Carrizo/Toronto CZ-A1)") // undocumented, but instlatx64 sample
+   FMQ ( 6,15,  6, 0,     sO, "AMD Opteron (Toronto)") // undocumented, but instlatx64 sample
+   FMQ ( 6,15,  6, 0,     df, "AMD FX-Series (Carrizo)") // undocumented, but instlatx64 sample
+   FM  ( 6,15,  6, 0,         "AMD (unknown type) (Carrizo/Toronto)") // undocumented, but instlatx64 sample
+   FMSQ( 6,15,  6, 5,  1, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge CZ-A1/BR-A1)") // undocumented, but samples from Alexandros Couloumbis & instlatx64; sandpile.org stepping
+   FMSQ( 6,15,  6, 5,  1, Se, "AMD E-Series (Stoney Ridge CZ-A1/BR-A1)") // undocumented; sandpile.org stepping
+   FMSQ( 6,15,  6, 5,  1, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon CZ-A1/BR-A1)") // undocumented; sandpile.org stepping
+   FMSQ( 6,15,  6, 5,  1, Sr, "AMD R-Series (Merlin Falcon CZ-A1/BR-A1)") // undocumented; sandpile.org stepping
+   FMS ( 6,15,  6, 5,  1,     "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon CZ-A1/BR-A1)") // sandpile.org
+   FMQ ( 6,15,  6, 5,     Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)") // undocumented, but samples from Alexandros Couloumbis & instlatx64
+   FMQ ( 6,15,  6, 5,     Se, "AMD E-Series (Stoney Ridge)") // undocumented
+   FMQ ( 6,15,  6, 5,     Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)") // undocumented
+   FMQ ( 6,15,  6, 5,     Sr, "AMD R-Series (Merlin Falcon)") // undocumented
+   FM  ( 6,15,  6, 5,         "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)") // undocumented, but sample from Alexandros Couloumbis
+   FMSQ( 6,15,  7, 0,  0, Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge ST-A0)")
+   FMSQ( 6,15,  7, 0,  0, Se, "AMD E-Series (Stoney Ridge ST-A0)")
+   FMSQ( 6,15,  7, 0,  0, Sg, "AMD G-Series (Brown Falcon/Prairie Falcon ST-A0)")
+   FMSQ( 6,15,  7, 0,  0, Sr, "AMD R-Series (Merlin Falcon ST-A0)")
+   FMS ( 6,15,  7, 0,  0,     "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon ST-A0)")
+   FMQ ( 6,15,  7, 0,     Sa, "AMD A-Series (Carrizo/Bristol Ridge/Stoney Ridge)")
+   FMQ ( 6,15,  7, 0,     Se, "AMD E-Series (Stoney Ridge)")
+   FMQ ( 6,15,  7, 0,     Sg, "AMD G-Series (Brown Falcon/Prairie Falcon)")
+   FMQ ( 6,15,  7, 0,     Sr, "AMD R-Series (Merlin Falcon)")
+   FM  ( 6,15,  7, 0,         "AMD (unknown type) (Carrizo/Bristol Ridge/Stoney Ridge/Toronto/Brown Falcon/Merlin Falcon/Prairie Falcon)")
+   F   ( 6,15,                "AMD (unknown model)")
+   FMS ( 7,15,  0, 0,  0,     "AMD (unknown type) (Kabini/Temash/Kyoto KB-A0)") // sandpile.org
+   FMSQ( 7,15,  0, 0,  1, dA, "AMD Athlon (Kabini KB-A1)")
+   FMSQ( 7,15,  0, 0,  1, Sa, "AMD A-Series (Kabini/Temash KB-A1)")
+   FMSQ( 7,15,  0, 0,  1, Se, "AMD E-Series (Kabini KB-A1)")
+   FMSQ( 7,15,  0, 0,  1, Sg, "AMD G-Series (Kabini KB-A1)")
+   FMSQ( 7,15,  0, 0,  1, sO, "AMD Opteron X1100/X2100 Series (Kyoto KB-A1)")
+   FMS ( 7,15,  0, 0,  1,     "AMD (unknown type) (Kabini/Temash/Kyoto KB-A1)")
+   FMQ ( 7,15,  0, 0,     dA, "AMD Athlon (Kabini)")
+   FMQ ( 7,15,  0, 0,     Sa, "AMD A-Series (Kabini/Temash)")
+   FMQ ( 7,15,  0, 0,     Se, "AMD E-Series (Kabini)")
+   FMQ ( 7,15,  0, 0,     Sg, "AMD G-Series (Kabini)")
+   FMQ ( 7,15,  0, 0,     sO, "AMD Opteron X1100/X2100 Series (Kyoto)")
+   FM  ( 7,15,  0, 0,         "AMD (unknown type) (Kabini/Temash/Kyoto)")
+   FM  ( 7,15,  2, 6,         "AMD (unknown type) (Cato)") // undocumented; instlatx64 sample; engr sample?
    // sandpile.org mentions (7,15),(0,4) Jaguar-esque "BV" cores
    // (with stepping 1 = A1), but I have no idea of any such code name.
    // The AMD docs (53072) omit the CPUID entirely.  But if this sticks to the
    // recent AMD pattern, these must be (7,15),(3,0).
-   FMSQ( 7,15,  3, 0,  1, Sa, "AMD A-Series (Beema ML-A1)");
-   FMSQ( 7,15,  3, 0,  1, Se, "AMD E-Series (Beema ML-A1)");
-   FMSQ( 7,15,  3, 0,  1, Sg, "AMD G-Series (Steppe Eagle/Crowned Eagle ML-A1)"); // undocumented; instlatx64 sample
-   FMSQ( 7,15,  3, 0,  1, Ta, "AMD A-Series Micro (Mullins ML-A1)");
-   FMSQ( 7,15,  3, 0,  1, Te, "AMD E-Series Micro (Mullins ML-A1)");
-   FMS ( 7,15,  3, 0,  1,     "AMD (unknown type) (Beema/Mullins ML-A1)");
-   FMQ ( 7,15,  3, 0,     Sa, "AMD A-Series (Beema)");
-   FMQ ( 7,15,  3, 0,     Se, "AMD E-Series (Beema)");
-   FMQ ( 7,15,  3, 0,     Sg, "AMD E-Series (Steppe Eagle/Crowned Eagle)");
-   FMQ ( 7,15,  3, 0,     Ta, "AMD A-Series Micro (Mullins)");
-   FMQ ( 7,15,  3, 0,     Te, "AMD E-Series Micro (Mullins)");
-   FM  ( 7,15,  3, 0,         "AMD (unknown type) (Beema/Mullins/Steppe Eagle/Crowned Eagle)");
+   FMSQ( 7,15,  3, 0,  1, Sa, "AMD A-Series (Beema ML-A1)")
+   FMSQ( 7,15,  3, 0,  1, Se, "AMD E-Series (Beema ML-A1)")
+   FMSQ( 7,15,  3, 0,  1, Sg, "AMD G-Series (Steppe Eagle/Crowned Eagle ML-A1)") // undocumented; instlatx64 sample
+   FMSQ( 7,15,  3, 0,  1, Ta, "AMD A-Series Micro (Mullins ML-A1)")
+   FMSQ( 7,15,  3, 0,  1, Te, "AMD E-Series Micro (Mullins ML-A1)")
+   FMS ( 7,15,  3, 0,  1,     "AMD (unknown type) (Beema/Mullins ML-A1)")
+   FMQ ( 7,15,  3, 0,     Sa, "AMD A-Series (Beema)")
+   FMQ ( 7,15,  3, 0,     Se, "AMD E-Series (Beema)")
+   FMQ ( 7,15,  3, 0,     Sg, "AMD E-Series (Steppe Eagle/Crowned Eagle)")
+   FMQ ( 7,15,  3, 0,     Ta, "AMD A-Series Micro (Mullins)")
+   FMQ ( 7,15,  3, 0,     Te, "AMD E-Series Micro (Mullins)")
+   FM  ( 7,15,  3, 0,         "AMD (unknown type) (Beema/Mullins/Steppe Eagle/Crowned Eagle)")
    // sandpile.org mentions (7,15),(6,0) Puma-esque "NL" cores
    // (with stepping 1 = A1), but I have no idea of any such code name.
-   F   ( 7,15,                "AMD (unknown model)");
-   FMS ( 8,15,  0, 0,  1,     "AMD (unknown type) (Summit Ridge/Naples ZP-A1)"); // sandpile.org
-   FMSQ( 8,15,  0, 1,  0, EE, "AMD EPYC (Snowy Owl ZP-B0)");
-   FMSQ( 8,15,  0, 1,  0, sE, "AMD EPYC (Naples ZP-B0)");
-   FMSQ( 8,15,  0, 1,  0, dR, "AMD Ryzen (Summit Ridge ZP-B0)");
-   FMS ( 8,15,  0, 1,  0,     "AMD (unknown type) (Summit Ridge/Naples ZP-B0)");
-   FMSQ( 8,15,  0, 1,  1, EE, "AMD EPYC (Snowy Owl ZP-B1)");
-   FMSQ( 8,15,  0, 1,  1, sE, "AMD EPYC (Naples ZP-B1)");
-   FMSQ( 8,15,  0, 1,  1, dR, "AMD Ryzen (Summit Ridge ZP-B1)");
-   FMS ( 8,15,  0, 1,  1,     "AMD (unknown type) (Summit Ridge/Naples ZP-B1)");
-   FMSQ( 8,15,  0, 1,  2, EE, "AMD EPYC (Snowy Owl ZP-B2)");
-   FMSQ( 8,15,  0, 1,  2, sE, "AMD EPYC (Naples ZP-B2)");
-   FMSQ( 8,15,  0, 1,  2, dR, "AMD Ryzen (Summit Ridge ZP-B2)");
-   FMS ( 8,15,  0, 1,  2,     "AMD (unknown type) (Summit Ridge/Naples ZP-B2)");
-   FMQ ( 8,15,  0, 1,     EE, "AMD EPYC (Snowy Owl)");
-   FMQ ( 8,15,  0, 1,     sE, "AMD EPYC (Naples)");
-   FMQ ( 8,15,  0, 1,     dR, "AMD Ryzen (Summit Ridge)");
-   FM  ( 8,15,  0, 1,         "AMD (unknown type) (Summit Ridge/Naples)");
-   FMS ( 8,15,  0, 8,  2,     "AMD Ryzen (Pinnacle Ridge PiR-B2)");
-   FM  ( 8,15,  0, 8,         "AMD Ryzen (Pinnacle Ridge)");
-   FMS ( 8,15,  1, 0,  1,     "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-A1)"); // found only on en.wikichip.org & instlatx64 examples; sandpile.org
-   FMSQ( 8,15,  1, 1,  0, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel RV-B0)"); // only instlatx64 example; stepping from usual pattern
-   FMSQ( 8,15,  1, 1,  0, AR, "AMD Ryzen (Raven Ridge RV-B0)"); // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
-   FMS ( 8,15,  1, 1,  0,     "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-B0)"); // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
-   FMQ ( 8,15,  1, 1,     ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel)"); // only instlatx64 example
-   FMQ ( 8,15,  1, 1,     AR, "AMD Ryzen (Raven Ridge)"); // found only on en.wikichip.org & instlatx64 examples
-   FM  ( 8,15,  1, 1,         "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel)"); // found only on en.wikichip.org & instlatx64 examples
-   FMS ( 8,15,  1, 8,  1,     "AMD Ryzen (Picasso A1)");
-   FM  ( 8,15,  1, 8,         "AMD Ryzen (Picasso)");
-   FMS ( 8,15,  2, 0,  1,     "AMD Ryzen (Dali A1)");
-   FM  ( 8,15,  2, 0,         "AMD Ryzen (Dali)");
-   FMSQ( 8,15,  3, 1,  0, dR, "AMD Ryzen (Castle Peak B0)");
-   FMQ ( 8,15,  3, 1,     dR, "AMD Ryzen (Castle Peak)");
-   FMSQ( 8,15,  3, 1,  0, sE, "AMD EPYC (Rome B0)");
-   FMQ ( 8,15,  3, 1,     sE, "AMD EPYC (Rome)");
-   FMS ( 8,15,  3, 1,  0,     "AMD Ryzen (Castle Peak B0) / EPYC (Rome B0)");
-   FM  ( 8,15,  3, 1,         "AMD Ryzen (Castle Peak) / EPYC (Rome)");
-   FM  ( 8,15,  5, 0,         "AMD DG02SRTBP4MFA (Fenghuang 15FF)"); // internal model, only instlatx64 example
-   FMS ( 8,15,  6, 0,  1,     "AMD Ryzen (Renoir A1)");
-   FM  ( 8,15,  6, 0,         "AMD Ryzen (Renoir)");
-   FMS ( 8,15,  7, 1,  0,     "AMD Ryzen (Matisse B0)"); // undocumented, but samples from Steven Noonan
-   FM  ( 8,15,  7, 1,         "AMD Ryzen (Matisse)"); // undocumented, but samples from Steven Noonan
-   F   ( 8,15,                "AMD (unknown model)");
-   FM  (10,15,  0, 1,         "AMD EPYC (Milan)");
-   F   (10,15,                "AMD (unknown model)"); // undocumented, but samples from Steven Noonan
-   DEFAULT                  ("unknown");
+   F   ( 7,15,                "AMD (unknown model)")
+   FMS ( 8,15,  0, 0,  1,     "AMD (unknown type) (Summit Ridge/Naples ZP-A1)") // sandpile.org
+   FMSQ( 8,15,  0, 1,  0, EE, "AMD EPYC (Snowy Owl ZP-B0)")
+   FMSQ( 8,15,  0, 1,  0, sE, "AMD EPYC (Naples ZP-B0)")
+   FMSQ( 8,15,  0, 1,  0, dR, "AMD Ryzen (Summit Ridge ZP-B0)")
+   FMS ( 8,15,  0, 1,  0,     "AMD (unknown type) (Summit Ridge/Naples ZP-B0)")
+   FMSQ( 8,15,  0, 1,  1, EE, "AMD EPYC (Snowy Owl ZP-B1)")
+   FMSQ( 8,15,  0, 1,  1, sE, "AMD EPYC (Naples ZP-B1)")
+   FMSQ( 8,15,  0, 1,  1, dR, "AMD Ryzen (Summit Ridge ZP-B1)")
+   FMS ( 8,15,  0, 1,  1,     "AMD (unknown type) (Summit Ridge/Naples ZP-B1)")
+   FMSQ( 8,15,  0, 1,  2, EE, "AMD EPYC (Snowy Owl ZP-B2)")
+   FMSQ( 8,15,  0, 1,  2, sE, "AMD EPYC (Naples ZP-B2)")
+   FMSQ( 8,15,  0, 1,  2, dR, "AMD Ryzen (Summit Ridge ZP-B2)")
+   FMS ( 8,15,  0, 1,  2,     "AMD (unknown type) (Summit Ridge/Naples ZP-B2)")
+   FMQ ( 8,15,  0, 1,     EE, "AMD EPYC (Snowy Owl)")
+   FMQ ( 8,15,  0, 1,     sE, "AMD EPYC (Naples)")
+   FMQ ( 8,15,  0, 1,     dR, "AMD Ryzen (Summit Ridge)")
+   FM  ( 8,15,  0, 1,         "AMD (unknown type) (Summit Ridge/Naples)")
+   FMS ( 8,15,  0, 8,  2,     "AMD Ryzen (Pinnacle Ridge PiR-B2)")
+   FM  ( 8,15,  0, 8,         "AMD Ryzen (Pinnacle Ridge)")
+   FMS ( 8,15,  1, 0,  1,     "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-A1)") // found only on en.wikichip.org & instlatx64 examples; sandpile.org
+   FMSQ( 8,15,  1, 1,  0, ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel RV-B0)") // only instlatx64 example; stepping from usual pattern
+   FMSQ( 8,15,  1, 1,  0, AR, "AMD Ryzen (Raven Ridge RV-B0)") // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
+   FMS ( 8,15,  1, 1,  0,     "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel RV-B0)") // found only on en.wikichip.org & instlatx64 examples; stepping from usual pattern
+   FMQ ( 8,15,  1, 1,     ER, "AMD Ryzen Embedded (Great Horned Owl/Banded Kestrel)") // only instlatx64 example
+   FMQ ( 8,15,  1, 1,     AR, "AMD Ryzen (Raven Ridge)") // found only on en.wikichip.org & instlatx64 examples
+   FM  ( 8,15,  1, 1,         "AMD Ryzen (unknown type) (Raven Ridge/Snowy Owl/Great Horned Owl/Banded Kestrel)") // found only on en.wikichip.org & instlatx64 examples
+   FMS ( 8,15,  1, 8,  1,     "AMD Ryzen (Picasso A1)")
+   FM  ( 8,15,  1, 8,         "AMD Ryzen (Picasso)")
+   FMS ( 8,15,  2, 0,  1,     "AMD Ryzen (Dali A1)")
+   FM  ( 8,15,  2, 0,         "AMD Ryzen (Dali)")
+   FMSQ( 8,15,  3, 1,  0, dR, "AMD Ryzen (Castle Peak B0)")
+   FMQ ( 8,15,  3, 1,     dR, "AMD Ryzen (Castle Peak)")
+   FMSQ( 8,15,  3, 1,  0, sE, "AMD EPYC (Rome B0)")
+   FMQ ( 8,15,  3, 1,     sE, "AMD EPYC (Rome)")
+   FMS ( 8,15,  3, 1,  0,     "AMD Ryzen (Castle Peak B0) / EPYC (Rome B0)")
+   FM  ( 8,15,  3, 1,         "AMD Ryzen (Castle Peak) / EPYC (Rome)")
+   FM  ( 8,15,  5, 0,         "AMD DG02SRTBP4MFA (Fenghuang 15FF)") // internal model, only instlatx64 example
+   FMS ( 8,15,  6, 0,  1,     "AMD Ryzen (Renoir A1)")
+   FM  ( 8,15,  6, 0,         "AMD Ryzen (Renoir)")
+   FMS ( 8,15,  7, 1,  0,     "AMD Ryzen (Matisse B0)") // undocumented, but samples from Steven Noonan
+   FM  ( 8,15,  7, 1,         "AMD Ryzen (Matisse)") // undocumented, but samples from Steven Noonan
+   F   ( 8,15,                "AMD (unknown model)")
+   FM  (10,15,  0, 1,         "AMD EPYC (Milan)")
+   F   (10,15,                "AMD (unknown model)") // undocumented, but samples from Steven Noonan
+   };
+   static synth_family_t  families[SYNTH_MAX_FAMILIES];
+   static unsigned int    family_count = 0;
+
+   cstring  result = synth_table_lookup(table, LENGTH(table),
+                                        families, &family_count,
+                                        val, stash);
+   if (result == NULL) {
+      result = "unknown";
+   }
 
    const char*  brand_pre;
    const char*  brand_post;
@@ -4301,11 +4900,40 @@ decode_synth_amd(unsigned int         val,
       sprintf(buffer, "%s %s", result, proc);
       return buffer;
    }
-   
+
    return result;
 }
 
-static cstring
+/* Restore the if-chain forms for the remaining, much smaller chains. */
+#undef F
+#undef FM
+#undef FMS
+#undef TF
+#undef TFM
+#undef TFMS
+#undef FQ
+#undef FMQ
+#undef FMSQ
+#define F(xf,f,...) \
+   else if (__F(val)    ==       _XF(xf)        +_F(f)                              ) ACT(__VA_ARGS__)
+#define FM(xf,f,xm,m,...) \
+   else if (__FM(val)   ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)                        ) ACT(__VA_ARGS__)
+#define FMS(xf,f,xm,m,s,...) \
+   else if (__FMS(val)  ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)                  ) ACT(__VA_ARGS__)
+#define TF(t,xf,f,...) \
+   else if (__TF(val)   == _T(t)+_XF(xf)        +_F(f)                              ) ACT(__VA_ARGS__)
+#define TFM(t,xf,f,xm,m,...) \
+   else if (__TFM(val)  == _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)                        ) ACT(__VA_ARGS__)
+#define TFMS(t,xf,f,xm,m,s,...) \
+   else if (__TFMS(val) == _T(t)+_XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s)                  ) ACT(__VA_ARGS__)
+#define FQ(xf,f,q,...) \
+   else if (__F(val)    ==       _XF(xf)        +_F(f)             && (stash) && (q)) ACT(__VA_ARGS__)
+#define FMQ(xf,f,xm,m,q,...) \
+   else if (__FM(val)   ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)       && (stash) && (q)) ACT(__VA_ARGS__)
+#define FMSQ(xf,f,xm,m,s,q,...) \
+   else if (__FMS(val)  ==       _XF(xf)+_XM(xm)+_F(f)+_M(m)+_S(s) && (stash) && (q)) ACT(__VA_ARGS__)
+
+static cstring COLD
 decode_synth_cyrix(unsigned int         val,
                    const code_stash_t*  stash)
 {
@@ -4329,7 +4957,7 @@ decode_synth_cyrix(unsigned int         val,
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_via(unsigned int         val,
                  const code_stash_t*  stash)
 {
@@ -4397,7 +5025,7 @@ decode_synth_via(unsigned int         val,
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_umc(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4411,7 +5039,7 @@ decode_synth_umc(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_nexgen(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4424,7 +5052,7 @@ decode_synth_nexgen(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_rise(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4439,7 +5067,7 @@ decode_synth_rise(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_transmeta(unsigned int         val,
                        const code_stash_t*  stash)
 {
@@ -4465,7 +5093,7 @@ decode_synth_transmeta(unsigned int         val,
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_sis(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4477,7 +5105,7 @@ decode_synth_sis(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_nsc(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4492,7 +5120,7 @@ decode_synth_nsc(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_vortex(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4505,7 +5133,7 @@ decode_synth_vortex(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_rdc(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4517,7 +5145,7 @@ decode_synth_rdc(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_hygon(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4530,7 +5158,7 @@ decode_synth_hygon(unsigned int  val)
    return result;
 }
 
-static cstring
+static cstring COLD
 decode_synth_zhaoxin(unsigned int  val)
 {
    cstring  result = NULL;
@@ -4946,7 +5574,17 @@ static int bits_needed(unsigned long  v)
 #define GET_V2_TOPO_WIDTH(val_1f_eax) \
    (BIT_EXTRACT_LE((val_1f_eax), 0, 5))
 
-static void print_apic_synth (code_stash_t*  stash)
+/*
+** apic_synth_widths() derives the bit widths of the SMT, core, and (AMD
+** Family 10h-16h only) CU fields of the APIC ID.  It is the width-derivation
+** half of print_apic_synth(), split out so that topology-only modes can
+** carve IDs out of APIC IDs without a full decode.  Returns FALSE if the
+** available leaves do not describe the topology.
+*/
+static boolean apic_synth_widths (const code_stash_t*  stash,
+                                  unsigned int*        smt_width_p,
+                                  unsigned int*        core_width_p,
+                                  unsigned int*        cu_width_p)
 {
    unsigned int  smt_width  = 0;
    unsigned int  core_width = 0;
@@ -4983,7 +5621,7 @@ static void print_apic_synth (code_stash_t*  stash)
          smt_width   = bits_needed(smt_count);
          core_width  = bits_needed(core_count);
       } else {
-         return;
+         return FALSE;
       }
       break;
    case VENDOR_AMD:
@@ -5030,17 +5668,33 @@ static void print_apic_synth (code_stash_t*  stash)
          core_width = bits_needed(core_count);
          cu_width   = bits_needed(cu_count);
       } else {
-         return;
+         return FALSE;
       }
       break;
    default:
-      return;
+      return FALSE;
    }
 
    // Possibly this should be expanded with Intel leaf 1f's module, tile, and
    // die levels.  They could be made into hidden architectural levels unless
    // actually present, much like the CU level.
 
+   *smt_width_p  = smt_width;
+   *core_width_p = core_width;
+   *cu_width_p   = cu_width;
+   return TRUE;
+}
+
+static void print_apic_synth (code_stash_t*  stash)
+{
+   unsigned int  smt_width;
+   unsigned int  core_width;
+   unsigned int  cu_width;
+
+   if (!apic_synth_widths(stash, &smt_width, &core_width, &cu_width)) {
+      return;
+   }
+
    printf("   (APIC widths synth):");
    if (cu_width != 0) {
       printf(" CU_width=%u", cu_width);
@@ -5126,7 +5780,7 @@ print_1_eax(unsigned int  value,
    static ccstring  processor[1<<2] = { "primary processor (0)",
                                         "Intel OverDrive (1)",
                                         "secondary processor (2)" };
-   static named_item  names[]
+   static const named_item  names[]
       = { { "processor type"                          , 12, 13, processor },
           { "family"                                  ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
@@ -5211,7 +5865,7 @@ print_brand(unsigned int  val_eax,
 static void
 print_1_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "process local APIC physical ID"          , 24, 31, NIL_IMAGES },
           { "maximum IDs for CPUs in pkg"             , 16, 23, NIL_IMAGES },
           { "CLFLUSH line size"                       ,  8, 15, NIL_IMAGES },
@@ -5226,7 +5880,7 @@ print_1_ebx(unsigned int  value)
 static void
 print_1_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "PNI/SSE3: Prescott New Instructions"     ,  0,  0, bools },
           { "PCLMULDQ instruction"                    ,  1,  1, bools },
           { "DTES64: 64-bit debug store"              ,  2,  2, bools },
@@ -5268,7 +5922,7 @@ print_1_ecx(unsigned int  value)
 static void
 print_1_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "x87 FPU on chip"                         ,  0,  0, bools },
           { "VME: virtual-8086 mode enhancement"      ,  1,  1, bools },
           { "DE: debugging extensions"                ,  2,  2, bools },
@@ -5490,7 +6144,7 @@ print_4_eax(unsigned int  value)
                                          "data cache (1)",
                                          "instruction cache (2)",
                                          "unified cache (3)" };
-   static named_item  names[]
+   static const named_item  names[]
       = { { "cache type"                              ,  0,  4, cache_type },
           { "cache level"                             ,  5,  7, NIL_IMAGES },
           { "self-initializing cache level"           ,  8,  8, bools },
@@ -5506,7 +6160,7 @@ print_4_eax(unsigned int  value)
 static void
 print_4_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "system coherency line size"              ,  0, 11, MINUS1_IMAGES },
           { "physical line partitions"                , 12, 21, MINUS1_IMAGES },
           { "ways of associativity"                   , 22, 31, MINUS1_IMAGES },
@@ -5519,7 +6173,7 @@ print_4_ebx(unsigned int  value)
 static void
 print_4_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "number of sets"                          ,  0, 31, MINUS1_IMAGES },
         };
 
@@ -5530,7 +6184,7 @@ print_4_ecx(unsigned int  value)
 static void
 print_4_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "WBINVD/INVD acts on lower caches"        ,  0,  0, bools },
           { "inclusive to lower caches"               ,  1,  1, bools },
           { "complex cache indexing"                  ,  2,  2, bools },
@@ -5569,7 +6223,7 @@ print_4_synth(const unsigned int  words[])
 static void
 print_5_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "smallest monitor-line size (bytes)"      ,  0, 15, NIL_IMAGES },
         };
 
@@ -5580,7 +6234,7 @@ print_5_eax(unsigned int  value)
 static void
 print_5_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "largest monitor-line size (bytes)"       ,  0, 15, NIL_IMAGES },
         };
 
@@ -5591,7 +6245,7 @@ print_5_ebx(unsigned int  value)
 static void
 print_5_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "enum of Monitor-MWAIT exts supported"    ,  0,  0, bools },
           { "supports intrs as break-event for MWAIT" ,  1,  1, bools },
         };
@@ -5603,7 +6257,7 @@ print_5_ecx(unsigned int  value)
 static void
 print_5_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "number of C0 sub C-states using MWAIT"   ,  0,  3, NIL_IMAGES },
           { "number of C1 sub C-states using MWAIT"   ,  4,  7, NIL_IMAGES },
           { "number of C2 sub C-states using MWAIT"   ,  8, 11, NIL_IMAGES },
@@ -5621,7 +6275,7 @@ print_5_edx(unsigned int  value)
 static void
 print_6_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "digital thermometer"                     ,  0,  0, bools },
           { "Intel Turbo Boost Technology"            ,  1,  1, bools },
           { "ARAT always running APIC timer"          ,  2,  2, bools },
@@ -5651,7 +6305,7 @@ print_6_eax(unsigned int  value)
 static void
 print_6_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "digital thermometer thresholds"          ,  0,  3, NIL_IMAGES },
         };
 
@@ -5662,7 +6316,7 @@ print_6_ebx(unsigned int  value)
 static void
 print_6_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "hardware coordination feedback"          ,  0,  0, bools },
           { "ACNT2 available"                         ,  1,  1, bools },
           { "performance-energy bias capability"      ,  3,  3, bools },
@@ -5676,7 +6330,7 @@ print_6_ecx(unsigned int  value)
 static void
 print_6_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "performance capability reporting"        ,  0,  0, bools },
           { "energy efficiency capability reporting"  ,  1,  1, bools },
           { "size of feedback struct (4KB pages)"     ,  8, 11, MINUS1_IMAGES },
@@ -5690,7 +6344,7 @@ print_6_edx(unsigned int  value)
 static void
 print_7_0_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "FSGSBASE instructions"                   ,  0,  0, bools },
           { "IA32_TSC_ADJUST MSR supported"           ,  1,  1, bools },
           { "SGX: Software Guard Extensions supported",  2,  2, bools },
@@ -5732,7 +6386,7 @@ print_7_0_ebx(unsigned int  value)
 static void
 print_7_0_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "PREFETCHWT1"                             ,  0,  0, bools },
           { "AVX512VBMI: vector byte manipulation"    ,  1,  1, bools },
           { "UMIP: user-mode instruction prevention"  ,  2,  2, bools },
@@ -5767,7 +6421,7 @@ print_7_0_ecx(unsigned int  value)
 static void
 print_7_0_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "AVX512_4VNNIW: neural network instrs"    ,  2,  2, bools },
           { "AVX512_4FMAPS: multiply acc single prec" ,  3,  3, bools },
           { "fast short REP MOV"                      ,  4,  4, bools },
@@ -5799,7 +6453,7 @@ print_7_0_edx(unsigned int  value)
 static void
 print_7_1_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "AVX-VNNI: AVX VNNI neural network instrs",  4,  4, bools },
           { "AVX512_BF16: bfloat16 instructions"      ,  5,  5, bools },
           { "zero-length MOVSB"                       , 10, 10, bools },
@@ -5814,7 +6468,7 @@ print_7_1_eax(unsigned int  value)
 static void
 print_a_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "version ID"                              ,  0,  7, NIL_IMAGES },
           { "number of counters per logical processor",  8, 15, NIL_IMAGES },
           { "bit width of counter"                    , 16, 23, NIL_IMAGES },
@@ -5828,7 +6482,7 @@ print_a_eax(unsigned int  value)
 static void
 print_a_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "core cycle event not available"          ,  0,  0, bools },
           { "instruction retired event not available" ,  1,  1, bools },
           { "reference cycles event not available"    ,  2,  2, bools },
@@ -5856,7 +6510,7 @@ print_a_ecx(unsigned int  value)
 static void
 print_a_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "number of fixed counters"                ,  0,  4, NIL_IMAGES },
           { "bit width of fixed counters"             ,  5, 12, NIL_IMAGES },
           { "anythread deprecation"                   , 15, 15, bools },
@@ -5869,7 +6523,7 @@ print_a_edx(unsigned int  value)
 static void
 print_b_1f_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "bit width of level"                      ,  0,  4, NIL_IMAGES },
         };
 
@@ -5880,7 +6534,7 @@ print_b_1f_eax(unsigned int  value)
 static void
 print_b_1f_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "number of logical processors at level"   ,  0, 15, NIL_IMAGES },
         };
 
@@ -5898,7 +6552,7 @@ print_b_1f_ecx(unsigned int  value)
                                          "tile (4)",
                                          "die (5)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "level number"                            ,  0,  7, NIL_IMAGES },
           { "level type"                              ,  8, 15, level_type },
         };
@@ -5921,7 +6575,7 @@ print_d_0_eax(unsigned int  value)
    ** 
    ** These align with the supported features[] in print_d_n() for values > 1.
    */
-   static named_item  names[]
+   static const named_item  names[]
       = { { "   XCR0 supported: x87 state"            ,  0,  0, bools },
           { "   XCR0 supported: SSE state"            ,  1,  1, bools },
           { "   XCR0 supported: AVX state"            ,  2,  2, bools },
@@ -5949,7 +6603,7 @@ print_d_0_eax(unsigned int  value)
 static void
 print_d_1_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "XSAVEOPT instruction"                    ,  0,  0, bools },
           { "XSAVEC instruction"                      ,  1,  1, bools },
           { "XGETBV instruction"                      ,  2,  2, bools },
@@ -5967,7 +6621,7 @@ print_d_n_ecx(unsigned int  value)
    static ccstring  which[] = { "XCR0 (user state)",
                                 "IA32_XSS (supervisor state)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "supported in IA32_XSS or XCR0"           ,  0,  0, which },
           { "64-byte alignment in compacted XSAVE"    ,  1,  1, bools },
           { "XFD faulting supported"                  ,  2,  2, bools },
@@ -6075,7 +6729,7 @@ print_d_n(const unsigned int  words[WORD_NUM],
 static void
 print_f_0_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "supports L3 cache QoS monitoring"        ,  1,  1, bools },
         };
 
@@ -6086,7 +6740,7 @@ print_f_0_edx(unsigned int  value)
 static void
 print_f_1_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "IA32_QM_CTR bit 61 is overflow"          ,  8,  8, bools },
         };
 
@@ -6097,7 +6751,7 @@ print_f_1_eax(unsigned int  value)
 static void
 print_f_1_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "supports L3 occupancy monitoring"        ,  0,  0, bools },
           { "supports L3 total bandwidth monitoring"  ,  1,  1, bools },
           { "supports L3 local bandwidth monitoring"  ,  2,  2, bools },
@@ -6110,7 +6764,7 @@ print_f_1_edx(unsigned int  value)
 static void
 print_10_0_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "L3 cache allocation technology supported",  1,  1, bools },
           { "L2 cache allocation technology supported",  2,  2, bools },
           { "memory bandwidth allocation supported"   ,  3,  3, bools },
@@ -6123,7 +6777,7 @@ print_10_0_ebx(unsigned int  value)
 static void
 print_10_n_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "length of capacity bit mask"             ,  0,  4, MINUS1_IMAGES },
         };
 
@@ -6134,7 +6788,7 @@ print_10_n_eax(unsigned int  value)
 static void
 print_10_n_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "infrequent updates of COS"               ,  1,  1, bools },
           { "code and data prioritization supported"  ,  2,  2, bools },
         };
@@ -6146,7 +6800,7 @@ print_10_n_ecx(unsigned int  value)
 static void
 print_10_n_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "highest COS number supported"            ,  0, 15, NIL_IMAGES },
         };
 
@@ -6157,7 +6811,7 @@ print_10_n_edx(unsigned int  value)
 static void
 print_10_3_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "maximum throttling value"                ,  0, 11, MINUS1_IMAGES },
         };
 
@@ -6168,7 +6822,7 @@ print_10_3_eax(unsigned int  value)
 static void
 print_10_3_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "per-thread MBA control"                  ,  0,  0, bools },
           { "delay values are linear"                 ,  2,  2, bools },
         };
@@ -6180,7 +6834,7 @@ print_10_3_ecx(unsigned int  value)
 static void
 print_12_0_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "SGX1 supported"                          ,  0,  0, bools },
           { "SGX2 supported"                          ,  1,  1, bools },
           { "SGX ENCLV E*VIRTCHILD, ESETCONTEXT"      ,  5,  5, bools },
@@ -6198,7 +6852,7 @@ print_12_0_ebx(unsigned int  value)
    ** MISCSELECT is described in Table 38-4: Bit Vector Layout of MISCSELECT
    ** Field of Extended Information.
    */
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MISCSELECT.EXINFO supported: #PF & #GP"  ,  0,  0, bools },
           { "MISCSELECT.CPINFO supported: #CP"        ,  1,  1, bools },
         };
@@ -6210,7 +6864,7 @@ print_12_0_ebx(unsigned int  value)
 static void
 print_12_0_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MaxEnclaveSize_Not64 (log2)"             ,  0,  7, NIL_IMAGES },
           { "MaxEnclaveSize_64 (log2)"                ,  8, 15, NIL_IMAGES },
         };
@@ -6226,7 +6880,7 @@ print_12_n_ecx(unsigned int  value)
                                    /* 1 => */ "confidentiality & integrity"
                                               " protection" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "section property"                        ,  0,  3, props },
         };
 
@@ -6237,7 +6891,7 @@ print_12_n_ecx(unsigned int  value)
 static void
 print_14_0_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "IA32_RTIT_CR3_MATCH is accessible"       ,  0,  0, bools },
           { "configurable PSB & cycle-accurate"       ,  1,  1, bools },
           { "IP & TraceStop filtering; PT preserve"   ,  2,  2, bools },
@@ -6253,7 +6907,7 @@ print_14_0_ebx(unsigned int  value)
 static void
 print_14_0_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "ToPA output scheme support"              ,  0,  0, bools },
           { "ToPA can hold many output entries"       ,  1,  1, bools },
           { "single-range output scheme support"      ,  2,  2, bools },
@@ -6268,7 +6922,7 @@ print_14_0_ecx(unsigned int  value)
 static void
 print_14_1_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "configurable address ranges"             ,  0,  2, NIL_IMAGES },
           { "supported MTC periods bitmask"           , 16, 31, NIL_IMAGES },
         };
@@ -6280,7 +6934,7 @@ print_14_1_eax(unsigned int  value)
 static void
 print_14_1_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "supported cycle threshold bitmask"       ,  0, 15, NIL_IMAGES },
           { "supported config PSB freq bitmask"       , 16, 31, NIL_IMAGES },
         };
@@ -6292,7 +6946,7 @@ print_14_1_ebx(unsigned int  value)
 static void
 print_16_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "Core Base Frequency (MHz)"               ,  0, 15, NIL_IMAGES },
         };
 
@@ -6303,7 +6957,7 @@ print_16_eax(unsigned int  value)
 static void
 print_16_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "Core Maximum Frequency (MHz)"            ,  0, 15, NIL_IMAGES },
         };
 
@@ -6314,7 +6968,7 @@ print_16_ebx(unsigned int  value)
 static void
 print_16_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "Bus (Reference) Frequency (MHz)"         ,  0, 15, NIL_IMAGES },
         };
 
@@ -6328,7 +6982,7 @@ print_17_0_ebx(unsigned int  value)
    static ccstring schemes[] = { /* 0 => */ "assigned by intel",
                                  /* 1 => */ "industry standard" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "vendor id"                               ,  0, 15, NIL_IMAGES },
           { "vendor scheme"                           , 16, 16, schemes },
         };
@@ -6349,7 +7003,7 @@ print_18_n_ebx(unsigned int  value)
                                    /* 6 => */ NULL,
                                    /* 7 => */ NULL };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "4KB page size entries supported"         ,  0,  0, bools },
           { "2MB page size entries supported"         ,  1,  1, bools },
           { "4MB page size entries supported"         ,  2,  2, bools },
@@ -6372,7 +7026,7 @@ print_18_n_edx(unsigned int  value)
                                   /* 00100b => */ "load-only TLB",
                                   /* 00101b => */ "store-only TLB" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "translation cache type"                  ,  0,  4, tlbs },
           { "translation cache level"                 ,  5,  7, MINUS1_IMAGES },
           { "fully associative"                       ,  8,  8, bools },
@@ -6386,7 +7040,7 @@ print_18_n_edx(unsigned int  value)
 static void
 print_19_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "CPL0-only restriction supported"         ,  0,  0, bools },
           { "no-encrypt restriction supported"        ,  1,  1, bools },
           { "no-decrypt restriction supported"        ,  2,  2, bools },
@@ -6399,7 +7053,7 @@ print_19_eax(unsigned int  value)
 static void
 print_19_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "AESKLE: AES instructions"                ,  0,  0, bools },
           { "AES wide instructions"                   ,  2,  2, bools },
           { "MSRs & IWKEY backups"                    ,  4,  4, bools },
@@ -6412,7 +7066,7 @@ print_19_ebx(unsigned int  value)
 static void
 print_19_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "LOADIWKEY NoBackup parameter"            ,  0,  0, bools },
           { "IWKEY randomization supported"           ,  1,  1, bools },
         };
@@ -6443,7 +7097,7 @@ print_1a_0_eax(unsigned int  value)
                                                         NULL, NULL, NULL, NULL,
                                        /* 40h     => */ "Intel Core" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "native model ID of core"                 ,  0, 23, NIL_IMAGES },
           { "core type"                               , 24, 31, coretypes },
         };
@@ -6458,7 +7112,7 @@ print_1b_n_eax(unsigned int  value)
    static ccstring types[1<<12] = { /* 0 => */ "invalid (0)",    
                                     /* 1 => */ "target identifier (1)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "sub-leaf type"                           ,  0, 11, types },
         };
 
@@ -6472,7 +7126,7 @@ print_1c_eax(unsigned int  value)
    static ccstring ipvs[1<<1] = { /* 0 => */ "EIP (0)",    
                                   /* 1 => */ "LIP (1)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "IA32_LBR_DEPTH.DEPTH  8 supported"       ,  0,  0, bools },
           { "IA32_LBR_DEPTH.DEPTH 16 supported"       ,  1,  1, bools },
           { "IA32_LBR_DEPTH.DEPTH 24 supported"       ,  2,  2, bools },
@@ -6492,7 +7146,7 @@ print_1c_eax(unsigned int  value)
 static void
 print_1c_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "CPL filtering supported"                 ,  0,  0, bools },
           { "branch filtering supported"              ,  1,  1, bools },
           { "call-stack mode supported"               ,  2,  2, bools },
@@ -6505,7 +7159,7 @@ print_1c_ebx(unsigned int  value)
 static void
 print_1c_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "mispredict bit supported"                ,  0,  0, bools },
           { "timed LBRs supported"                    ,  1,  1, bools },
           { "branch type field supported"             ,  2,  2, bools },
@@ -6518,7 +7172,7 @@ print_1c_ecx(unsigned int  value)
 static void
 print_1d_n_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "total_tile_bytes"                        ,  0, 15, NIL_IMAGES },
           { "bytes_per_tile"                          , 16, 31, NIL_IMAGES },
         };
@@ -6530,7 +7184,7 @@ print_1d_n_eax(unsigned int  value)
 static void
 print_1d_n_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "bytes_per_row"                           ,  0, 15, NIL_IMAGES },
           { "max_names"                               , 16, 31, NIL_IMAGES },
         };
@@ -6542,7 +7196,7 @@ print_1d_n_ebx(unsigned int  value)
 static void
 print_1d_n_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "max_rows"                                ,  0, 15, NIL_IMAGES },
         };
 
@@ -6553,7 +7207,7 @@ print_1d_n_ecx(unsigned int  value)
 static void
 print_1e_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "tmul_maxk"                               ,  0,  7, NIL_IMAGES },
           { "tmul_maxn"                               ,  8, 23, NIL_IMAGES },
         };
@@ -6568,7 +7222,7 @@ print_20_ebx(unsigned int  value)
    /*
    ** The meanings of the bits correlate with the IA32_HRESET_ENABLE MSR bits.
    */
-   static named_item  names[]
+   static const named_item  names[]
       = { { "HRESET supported: EHFI history"          ,  0,  0, bools },
         };
 
@@ -6584,7 +7238,7 @@ print_20000001_edx(unsigned int  value)
    // information."  But I found no document that specifies that information.
    // sandpile.org had the following bit.
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "k1om"                                    ,  0,  0, bools },
         };
 
@@ -6596,7 +7250,7 @@ print_20000001_edx(unsigned int  value)
 static void
 print_40000001_eax_kvm(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "kvmclock available at MSR 0x11"          ,  0,  0, bools },
           { "delays unnecessary for PIO ops"          ,  1,  1, bools },
           { "mmu_op"                                  ,  2,  2, bools },
@@ -6622,7 +7276,7 @@ print_40000001_eax_kvm(unsigned int  value)
 static void
 print_40000001_edx_kvm(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "realtime hint: no unbound preemption"    ,  0,  0, bools },
         };
 
@@ -6634,7 +7288,7 @@ print_40000001_edx_kvm(unsigned int  value)
 static void
 print_40000002_ecx_xen(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MMU_PT_UPDATE_PRESERVE_AD supported"     ,  0,  0, bools },
         };
 
@@ -6645,7 +7299,7 @@ print_40000002_ecx_xen(unsigned int  value)
 static void
 print_40000003_eax_xen(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "vtsc"                                    ,  0,  0, bools },
           { "host tsc is safe"                        ,  1,  1, bools },
           { "boot cpu has RDTSCP"                     ,  2,  2, bools },
@@ -6658,7 +7312,7 @@ print_40000003_eax_xen(unsigned int  value)
 static void
 print_40000003_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "VP run time"                             ,  0,  0, bools },
           { "partition reference counter"             ,  1,  1, bools },
           { "basic synIC MSRs"                        ,  2,  2, bools },
@@ -6683,7 +7337,7 @@ print_40000003_eax_microsoft(unsigned int  value)
 static void
 print_40000003_ebx_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "CreatePartitions"                        ,  0,  0, bools },
           { "AccessPartitionId"                       ,  1,  1, bools },
           { "AccessMemoryPool"                        ,  2,  2, bools },
@@ -6710,7 +7364,7 @@ print_40000003_ebx_microsoft(unsigned int  value)
 static void
 print_40000003_ecx_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "maximum process power state"             ,  0,  3, NIL_IMAGES },
         };
 
@@ -6722,7 +7376,7 @@ print_40000003_ecx_microsoft(unsigned int  value)
 static void
 print_40000003_edx_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MWAIT available"                         ,  0,  0, bools },
           { "guest debugging support available"       ,  1,  1, bools },
           { "performance monitor support available"   ,  2,  2, bools },
@@ -6752,7 +7406,7 @@ print_40000003_edx_microsoft(unsigned int  value)
 static void
 print_40000004_eax_xen(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "virtualized APIC registers"              ,  0,  0, bools },
           { "virtualized x2APIC accesses"             ,  1,  1, bools },
           { "IOMMU mappings for other domain memory"  ,  2,  2, bools },
@@ -6768,7 +7422,7 @@ print_40000004_eax_xen(unsigned int  value)
 static void
 print_40000004_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "use hypercalls for AS switches"          ,  0,  0, bools },
           { "use hypercalls for local TLB flushes"    ,  1,  1, bools },
           { "use hypercalls for remote TLB flushes"   ,  2,  2, bools },
@@ -6794,7 +7448,7 @@ print_40000004_eax_microsoft(unsigned int  value)
 static void
 print_40000005_0_ebx_xen(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "maximum machine address width"           ,  0,  7, NIL_IMAGES },
         };
 
@@ -6806,7 +7460,7 @@ print_40000005_0_ebx_xen(unsigned int  value)
 static void
 print_40000006_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "APIC overlay assist"                     ,  0,  0, bools },
           { "MSR bitmaps"                             ,  1,  1, bools },
           { "performance counters"                    ,  2,  2, bools },
@@ -6827,7 +7481,7 @@ print_40000006_eax_microsoft(unsigned int  value)
 static void
 print_40000007_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "StartLogicalProcessor"                   ,  0,  0, bools },
           { "CreateRootvirtualProcessor"              ,  1,  1, bools },
         };
@@ -6839,7 +7493,7 @@ print_40000007_eax_microsoft(unsigned int  value)
 static void
 print_40000007_ebx_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "ProcessorPowerManagement"                ,  0,  0, bools },
           { "MwaitIdleStates"                         ,  1,  1, bools },
           { "LogicalProcessorIdling"                  ,  2,  2, bools },
@@ -6852,7 +7506,7 @@ print_40000007_ebx_microsoft(unsigned int  value)
 static void
 print_40000008_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "SvmSupported"                            ,  0,  0, bools },
           { "MaxPasidSpacePasidCount"                 , 11, 31, NIL_IMAGES },
         };
@@ -6864,7 +7518,7 @@ print_40000008_eax_microsoft(unsigned int  value)
 static void
 print_40000009_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "AccessSynicRegs"                         ,  2,  2, bools },
           { "AccessIntrCtrlRegs"                      ,  4,  4, bools },
           { "AccessHypercallMsrs"                     ,  5,  5, bools },
@@ -6879,7 +7533,7 @@ print_40000009_eax_microsoft(unsigned int  value)
 static void
 print_40000009_edx_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "XmmRegistersForFastHypercallAvailable"   ,  4,  4, bools },
           { "FastHypercallOutputAvailable"            , 15, 15, bools },
           { "SintPoillingModeAvailable"               , 17, 17, bools },
@@ -6892,7 +7546,7 @@ print_40000009_edx_microsoft(unsigned int  value)
 static void
 print_4000000a_eax_microsoft(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "enlightened VMCS version (low)"          ,  0,  7, NIL_IMAGES },
           { "enlightened VMCS version (high)"         ,  8, 15, NIL_IMAGES },
           { "direct virtual flush hypercalls support" , 17, 17, bools },
@@ -6907,7 +7561,7 @@ print_4000000a_eax_microsoft(unsigned int  value)
 static void
 print_80000001_eax_amd(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "family/generation"                       ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
           { "stepping id"                             ,  0,  3, NIL_IMAGES },
@@ -6930,7 +7584,7 @@ print_80000001_eax_amd(unsigned int  value)
 static void
 print_80000001_eax_hygon(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "family/generation"                       ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
           { "stepping id"                             ,  0,  3, NIL_IMAGES },
@@ -6953,7 +7607,7 @@ print_80000001_eax_hygon(unsigned int  value)
 static void
 print_80000001_eax_via(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "generation"                              ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
           { "stepping"                                ,  0,  3, NIL_IMAGES },
@@ -6969,7 +7623,7 @@ print_80000001_eax_via(unsigned int  value)
 static void
 print_80000001_eax_transmeta(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "generation"                              ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
           { "stepping"                                ,  0,  3, NIL_IMAGES },
@@ -7023,7 +7677,7 @@ print_80000001_eax(unsigned int  value,
 static void
 print_80000001_edx_intel(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "SYSCALL and SYSRET instructions"         , 11, 11, bools },
           { "execution disable"                       , 20, 20, bools },
           { "1-GB large page support"                 , 26, 26, bools },
@@ -7039,7 +7693,7 @@ print_80000001_edx_intel(unsigned int  value)
 static void
 print_80000001_edx_amd(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "x87 FPU on chip"                         ,  0,  0, bools },
           { "virtual-8086 mode enhancement"           ,  1,  1, bools },
           { "debugging extensions"                    ,  2,  2, bools },
@@ -7078,7 +7732,7 @@ print_80000001_edx_amd(unsigned int  value)
 static void
 print_80000001_edx_cyrix_via(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "x87 FPU on chip"                         ,  0,  0, bools },
           { "virtual-8086 mode enhancement"           ,  1,  1, bools },
           { "debugging extensions"                    ,  2,  2, bools },
@@ -7114,7 +7768,7 @@ print_80000001_edx_cyrix_via(unsigned int  value)
 static void
 print_80000001_edx_transmeta(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "x87 FPU on chip"                         ,  0,  0, bools },
           { "virtual-8086 mode enhancement"           ,  1,  1, bools },
           { "debugging extensions"                    ,  2,  2, bools },
@@ -7142,7 +7796,7 @@ print_80000001_edx_transmeta(unsigned int  value)
 static void
 print_80000001_edx_nsc(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "x87 FPU on chip"                         ,  0,  0, bools },
           { "virtual-8086 mode enhancement"           ,  1,  1, bools },
           { "debugging extensions"                    ,  2,  2, bools },
@@ -7202,7 +7856,7 @@ print_80000001_edx(unsigned int  value,
 static void
 print_80000001_ecx_amd(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "LAHF/SAHF supported in 64-bit mode"      ,  0,  0, bools },
           { "CMP Legacy"                              ,  1,  1, bools },
           { "SVM: secure virtual machine"             ,  2,  2, bools },
@@ -7239,7 +7893,7 @@ print_80000001_ecx_amd(unsigned int  value)
 static void
 print_80000001_ecx_intel(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "LAHF/SAHF supported in 64-bit mode"      ,  0,  0, bools },
           { "LZCNT advanced bit manipulation"         ,  5,  5, bools },
           { "3DNow! PREFETCH/PREFETCHW instructions"  ,  8,  8, bools },
@@ -7291,7 +7945,7 @@ print_80000001_ebx_amd(unsigned int  value,
 
    if (__F(val_1_eax) == _XF(0) + _F(15)
        && __M(val_1_eax) < _XM(4) + _M(0)) {
-      static named_item  names[]
+      static const named_item  names[]
          = { { "raw"                                     ,  0, 31, NIL_IMAGES },
              { "BrandId"                                 ,  0, 16, NIL_IMAGES },
              { "BrandTableIndex"                         ,  6, 12, NIL_IMAGES },
@@ -7303,7 +7957,7 @@ print_80000001_ebx_amd(unsigned int  value,
                   /* max_len => */ 0);
    } else if (__F(val_1_eax) == _XF(0) + _F(15)
               && __M(val_1_eax) >= _XM(4) + _M(0)) {
-      static named_item  names[]
+      static const named_item  names[]
          = { { "raw"                                     ,  0, 31, NIL_IMAGES },
              { "BrandId"                                 ,  0, 16, NIL_IMAGES },
              { "PwrLmt:high"                             ,  6,  8, NIL_IMAGES },
@@ -7318,7 +7972,7 @@ print_80000001_ebx_amd(unsigned int  value,
                   /* max_len => */ 0);
    } else if (__F(val_1_eax) == _XF(1) + _F(15)
               || __F(val_1_eax) == _XF(2) + _F(15)) {
-      static named_item  names[]
+      static const named_item  names[]
          = { { "raw"                                     ,  0, 31, NIL_IMAGES },
              { "BrandId"                                 ,  0, 15, NIL_IMAGES },
              { "str1"                                    , 11, 14, NIL_IMAGES },
@@ -7332,7 +7986,7 @@ print_80000001_ebx_amd(unsigned int  value,
       print_names(value, names, LENGTH(names),
                   /* max_len => */ max_len);
    } else {
-      static named_item  names[]
+      static const named_item  names[]
          = { { "raw"                                     ,  0, 31, NIL_IMAGES },
              { "BrandId"                                 ,  0, 15, NIL_IMAGES },
            };
@@ -7474,7 +8128,7 @@ print_80000001_ebx(unsigned int  value,
 static void
 print_80000005_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0,  7, NIL_IMAGES },
           { "instruction associativity"               ,  8, 15, NIL_IMAGES },
           { "data # entries"                          , 16, 23, NIL_IMAGES },
@@ -7490,7 +8144,7 @@ print_80000005_eax(unsigned int  value)
 static void
 print_80000005_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0,  7, NIL_IMAGES },
           { "instruction associativity"               ,  8, 15, NIL_IMAGES },
           { "data # entries"                          , 16, 23, NIL_IMAGES },
@@ -7506,7 +8160,7 @@ print_80000005_ebx(unsigned int  value)
 static void
 print_80000005_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
           { "lines per tag"                           ,  8, 15, NIL_IMAGES },
           { "associativity"                           , 16, 23, NIL_IMAGES },
@@ -7521,7 +8175,7 @@ print_80000005_ecx(unsigned int  value)
 static void
 print_80000005_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
           { "lines per tag"                           ,  8, 15, NIL_IMAGES },
           { "associativity"                           , 16, 23, NIL_IMAGES },
@@ -7553,7 +8207,7 @@ static ccstring  l2_assoc[1<<4] = { "L2 off (0)",
 static void
 print_80000006_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
           { "instruction associativity"               , 12, 15, l2_assoc },
           { "data # entries"                          , 16, 27, NIL_IMAGES },
@@ -7569,7 +8223,7 @@ print_80000006_eax(unsigned int  value)
 static void
 print_80000006_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
           { "instruction associativity"               , 12, 15, l2_assoc },
           { "data # entries"                          , 16, 27, NIL_IMAGES },
@@ -7585,7 +8239,7 @@ static void
 print_80000006_ecx(unsigned int   value,
                    code_stash_t*  stash)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
           { "lines per tag"                           ,  8, 11, NIL_IMAGES },
           { "associativity"                           , 12, 15, l2_assoc },
@@ -7606,7 +8260,7 @@ print_80000006_ecx(unsigned int   value,
 static void
 print_80000006_edx(unsigned int   value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "line size (bytes)"                       ,  0,  7, NIL_IMAGES },
           { "lines per tag"                           ,  8, 11, NIL_IMAGES },
           { "associativity"                           , 12, 15, l2_assoc },
@@ -7621,7 +8275,7 @@ print_80000006_edx(unsigned int   value)
 static void
 print_80000007_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MCA overflow recovery support"           ,  0,  0, bools },
           { "SUCCOR support"                          ,  1,  1, bools },
           { "HWA: hardware assert support"            ,  2,  2, bools },
@@ -7636,7 +8290,7 @@ print_80000007_ebx(unsigned int  value)
 static void
 print_80000007_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "CmpUnitPwrSampleTimeRatio"               ,  0, 31, NIL_IMAGES },
         };
 
@@ -7648,7 +8302,7 @@ print_80000007_ecx(unsigned int  value)
 static void
 print_80000007_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "TS: temperature sensing diode"           ,  0,  0, bools },
           { "FID: frequency ID control"               ,  1,  1, bools },
           { "VID: voltage ID control"                 ,  2,  2, bools },
@@ -7674,7 +8328,7 @@ print_80000007_edx(unsigned int  value)
 static void
 print_80000008_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "maximum physical address bits"           ,  0,  7, NIL_IMAGES },
           { "maximum linear (virtual) address bits"   ,  8, 15, NIL_IMAGES },
           { "maximum guest physical address bits"     , 16, 23, NIL_IMAGES },
@@ -7688,7 +8342,7 @@ print_80000008_eax(unsigned int  value)
 static void
 print_80000008_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "CLZERO instruction"                      ,  0,  0, bools },
           { "instructions retired count support"      ,  1,  1, bools },
           { "always save/restore error pointers"      ,  2,  2, bools },
@@ -7723,7 +8377,7 @@ print_80000008_ebx(unsigned int  value)
 static void
 print_80000008_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { // bit field 0, 7 is reported by caller
           { "ApicIdCoreIdSize"                        , 12, 15, NIL_IMAGES },
           { "performance time-stamp counter size"     , 16, 17, NIL_IMAGES },
@@ -7736,7 +8390,7 @@ print_80000008_ecx(unsigned int  value)
 static void
 print_80000008_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "max page count for INVLPGB instruction"  ,  0, 15, NIL_IMAGES },
           { "RDPRU instruction max input support"     , 16, 23, NIL_IMAGES },
         };
@@ -7749,7 +8403,7 @@ print_80000008_edx(unsigned int  value)
 static void
 print_8000000a_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "SvmRev: SVM revision"                    ,  0,  7, NIL_IMAGES },
         };
 
@@ -7761,7 +8415,7 @@ print_8000000a_eax(unsigned int  value)
 static void
 print_8000000a_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "nested paging"                           ,  0,  0, bools },
           { "LBR virtualization"                      ,  1,  1, bools },
           { "SVM lock"                                ,  2,  2, bools },
@@ -7798,7 +8452,7 @@ print_8000000a_ebx(unsigned int  value)
 static void
 print_80000019_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
           { "instruction associativity"               , 12, 15, l2_assoc },
           { "data # entries"                          , 16, 27, NIL_IMAGES },
@@ -7813,7 +8467,7 @@ print_80000019_eax(unsigned int  value)
 static void
 print_80000019_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "instruction # entries"                   ,  0, 11, NIL_IMAGES },
           { "instruction associativity"               , 12, 15, l2_assoc },
           { "data # entries"                          , 16, 27, NIL_IMAGES },
@@ -7828,7 +8482,7 @@ print_80000019_ebx(unsigned int  value)
 static void
 print_8000001a_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "128-bit SSE executed full-width"         ,  0,  0, bools },
           { "MOVU* better than MOVL*/MOVH*"           ,  1,  1, bools },
           { "256-bit SSE executed full-width"         ,  2,  2, bools },
@@ -7842,7 +8496,7 @@ print_8000001a_eax(unsigned int  value)
 static void
 print_8000001b_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "IBS feature flags valid"                 ,  0,  0, bools },
           { "IBS fetch sampling"                      ,  1,  1, bools },
           { "IBS execution sampling"                  ,  2,  2, bools },
@@ -7864,7 +8518,7 @@ print_8000001b_eax(unsigned int  value)
 static void
 print_8000001c_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "lightweight profiling"                   ,  0,  0, bools },
           { "LWPVAL instruction"                      ,  1,  1, bools },
           { "instruction retired event"               ,  2,  2, bools },
@@ -7884,7 +8538,7 @@ print_8000001c_eax(unsigned int  value)
 static void
 print_8000001c_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "LWPCB byte size"                         ,  0,  7, NIL_IMAGES },
           { "event record byte size"                  ,  8, 15, NIL_IMAGES },
           { "maximum EventId"                         , 16, 23, NIL_IMAGES },
@@ -7899,7 +8553,7 @@ print_8000001c_ebx(unsigned int  value)
 static void
 print_8000001c_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "latency counter bit size"                ,  0,  4, NIL_IMAGES },
           { "data cache miss address valid"           ,  5,  5, bools },
           { "amount cache latency is rounded"         ,  6,  8, NIL_IMAGES },
@@ -7919,7 +8573,7 @@ print_8000001c_ecx(unsigned int  value)
 static void
 print_8000001c_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "lightweight profiling"                   ,  0,  0, bools },
           { "LWPVAL instruction"                      ,  1,  1, bools },
           { "instruction retired event"               ,  2,  2, bools },
@@ -7944,7 +8598,7 @@ print_8000001d_eax(unsigned int  value)
                                          "instruction (2)",
                                          "unified (3)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "type"                                    ,  0,  4, cache_type },
           { "level"                                   ,  5,  7, NIL_IMAGES },
           { "self-initializing"                       ,  8,  8, bools },
@@ -7959,7 +8613,7 @@ print_8000001d_eax(unsigned int  value)
 static void
 print_8000001d_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "line size in bytes"                      ,  0, 11, MINUS1_IMAGES },
           { "physical line partitions"                , 12, 21, MINUS1_IMAGES },
           { "number of ways"                          , 22, 31, MINUS1_IMAGES },
@@ -7972,7 +8626,7 @@ print_8000001d_ebx(unsigned int  value)
 static void
 print_8000001d_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "write-back invalidate"                   ,  0,  0, bools },
           { "cache inclusive of lower levels"         ,  1,  1, bools },
         };
@@ -8010,7 +8664,7 @@ print_8000001d_synth(const unsigned int  words[])
 static void
 print_8000001e_ebx_f16(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "compute unit ID"                         ,  0,  7, NIL_IMAGES },
           { "cores per compute unit"                  ,  8,  9, MINUS1_IMAGES },
         };
@@ -8023,7 +8677,7 @@ print_8000001e_ebx_f16(unsigned int  value)
 static void
 print_8000001e_ebx_gt_f16(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "core ID"                                 ,  0,  7, NIL_IMAGES },
           { "threads per core"                        ,  8, 15, MINUS1_IMAGES },
         };
@@ -8036,7 +8690,7 @@ print_8000001e_ebx_gt_f16(unsigned int  value)
 static void
 print_8000001e_ecx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "node ID"                                 ,  0,  7, NIL_IMAGES },
           { "nodes per processor"                     ,  8, 10, MINUS1_IMAGES },
         };
@@ -8049,7 +8703,7 @@ print_8000001e_ecx(unsigned int  value)
 static void
 print_8000001f_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "SME: secure memory encryption support"   ,  0,  0, bools },
           { "SEV: secure encrypted virtualize support",  1,  1, bools },
           { "VM page flush MSR support"               ,  2,  2, bools },
@@ -8072,7 +8726,7 @@ print_8000001f_eax(unsigned int  value)
 static void
 print_8000001f_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "encryption bit position in PTE"          ,  0,  5, NIL_IMAGES },
           { "physical address space width reduction"  ,  6, 11, NIL_IMAGES },
           { "number of VM permission levels"          , 12, 15, NIL_IMAGES },
@@ -8084,7 +8738,7 @@ print_8000001f_ebx(unsigned int  value)
 static void
 print_80000020_0_ebx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "memory bandwidth enforcement support"    ,  1,  1, bools },
         };
 
@@ -8095,7 +8749,7 @@ print_80000020_0_ebx(unsigned int  value)
 static void
 print_80000021_eax(unsigned int value)
 {
-   static named_item names[]
+   static const named_item names[]
       = { { "no nested data-breakpoints"              ,  0,  0, bools },
           { "LFENCE always serializing"               ,  2,  2, bools },
           { "SMM paging configuration lock support"   ,  3,  3, bools },
@@ -8111,7 +8765,7 @@ print_80000021_eax(unsigned int value)
 static void
 print_80860001_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "generation"                              ,  8, 11, NIL_IMAGES },
           { "model"                                   ,  4,  7, NIL_IMAGES },
           { "stepping"                                ,  0,  3, NIL_IMAGES },
@@ -8132,7 +8786,7 @@ print_80860001_eax(unsigned int  value)
 static void
 print_80860001_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "recovery CMS active"                     ,  0,  0, bools },
           { "LongRun"                                 ,  1,  1, bools },
           { "LongRun Table Interface LRTI (CMS 4.2)"  ,  3,  3, bools },
@@ -8216,7 +8870,7 @@ print_80860002_eax(unsigned int   value,
 static void
 print_c0000001_edx(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "alternate instruction set"                ,  0,  0, bools }, // sandpile.org
           { "alternate instruction set enabled"        ,  1,  1, bools }, // sandpile.org
           { "random number generator"                  ,  2,  2, bools },
@@ -8245,7 +8899,7 @@ print_c0000002_ebx(unsigned int  value)
           (BIT_EXTRACT_LE(value, 0, 8) << 4) + 700,
           BIT_EXTRACT_LE(value, 0, 8));
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "current clock multipler"                 ,  8, 15, NIL_IMAGES },
           { "clock ratio transition in progress"      , 16, 16, bools },
           { "voltage transition in progress"          , 17, 17, bools },
@@ -8269,7 +8923,7 @@ print_c0000002_ecx(unsigned int  value)
           (BIT_EXTRACT_LE(value, 16, 24) << 4) + 700,
           BIT_EXTRACT_LE(value, 16, 24));
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "highest clock multiplier"                ,  8, 15, NIL_IMAGES },
           { "lowest clock multiplier"                 , 24, 31, NIL_IMAGES },
         };
@@ -8288,7 +8942,7 @@ print_c0000002_edx(unsigned int  value)
                                         "200 MHz (2)",
                                         "166 MHz (3)" };
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "MB reset vector"                         , 14, 14, mb_reset },
           { "APIC cluster ID"                         , 16, 17, NIL_IMAGES },
           { "input front side bus clock"              , 16, 17, bus_clock },
@@ -8303,7 +8957,7 @@ print_c0000002_edx(unsigned int  value)
 static void
 print_c0000004_eax(unsigned int  value)
 {
-   static named_item  names[]
+   static const named_item  names[]
       = { { "thermal monitor temperature"             ,  0,  7, NIL_IMAGES },
         };
 
@@ -8321,7 +8975,7 @@ print_c0000004_ebx(unsigned int  value)
    // This is a mirror of MSR 198h [31:0]
    // If it had been read via rdmsr, this would be eax.
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "current clock ratio"                     ,  8, 15, X2_IMAGES },
           { "clock ratio transition in progress"      , 16, 16, bools },
           { "voltage transition in progress"          , 17, 17, bools },
@@ -8344,7 +8998,7 @@ print_c0000004_ecx(unsigned int  value)
    // This is a mirror of MSR 198h [63:32]
    // If it had been read via rdmsr, this would be edx.
 
-   static named_item  names[]
+   static const named_item  names[]
       = { { "highest supported voltage"               ,  0,  7, NIL_IMAGES },
           { "highest supported clock ratio"           ,  8, 15, X2_IMAGES },
           { "lowest supported voltage"                , 16, 23, NIL_IMAGES },
@@ -8372,7 +9026,17 @@ usage(void)
                                     " FILE instead\n");
    printf("                         of from executions of the cpuid"
                                     " instruction.\n");
-   printf("                         If FILE is '-', read from stdin.\n");
+   printf("                         If FILE is '-', read from stdin.  May be"
+                                    " repeated\n");
+   printf("                         to decode multiple dumps in one"
+                                    " process.  gzip &\n");
+   printf("                         zstd compressed files are decompressed"
+                                    " transparently.\n");
+   printf("            --files-from=LIST\n");
+   printf("                         read filenames to decode, one per line,"
+                                    " from LIST.\n");
+   printf("                         If LIST is '-', read the names from"
+                                    " stdin.\n");
    printf("   -l V,    --leaf=V     display information for the single specified"
                                     " leaf.\n");
    printf("                         If -s/--subleaf is not specified, 0 is"
@@ -8380,6 +9044,14 @@ usage(void)
    printf("   -s V,    --subleaf=V  display information for the single specified"
                                     " subleaf.\n");
    printf("                         It requires -l/--leaf.\n");
+   printf("            --leaves=LIST\n");
+   printf("                         display information for only the leaves in"
+                                    " LIST, a\n");
+   printf("                         comma-separated list of LEAF, LEAF:SUBLEAF,"
+                                    " or\n");
+   printf("                         LEAF:all entries.  LEAF:all walks all of"
+                                    " the leaf's\n");
+   printf("                         subleaves.\n");
    printf("   -h, -H,  --help       display this help information\n");
    printf("   -i,      --inst       use the CPUID instruction: The information"
                                     " it provides\n");
@@ -8395,8 +9067,93 @@ usage(void)
                                     " necessary to be\n");
    printf("                         root.\n");
 #endif
+   printf("            --parallel[=N]\n");
+   printf("                         gather from all CPUs in parallel, using"
+                                    " one pinned\n");
+   printf("                         worker thread per CPU (or N worker"
+                                    " threads), then\n");
+   printf("                         print the results in CPU order\n");
+   printf("            --format=FORMAT\n");
+   printf("                         write output in the specified FORMAT:"
+                                    " text (the\n");
+   printf("                         default), or json (one NDJSON record"
+                                    " per field or\n");
+   printf("                         raw leaf, each tagged with its CPU"
+                                    " number)\n");
+   printf("            --dedup      display full information for one CPU per"
+                                    " distinct\n");
+   printf("                         signature (which includes the topology"
+                                    " leaves and,\n");
+   printf("                         on hybrid parts, the core type), and"
+                                    " compact\n");
+   printf("                         \"same as\" lines carrying the probed"
+                                    " APIC ids for\n");
+   printf("                         the rest\n");
    printf("   -r,      --raw        display raw hex information with no"
                                     " decoding\n");
+   printf("            --raw-binary write raw information to stdout in a"
+                                    " compact binary\n");
+   printf("                         format, which -f/--file accepts in place"
+                                    " of the -r\n");
+   printf("                         text format\n");
+   printf("            --diff=BASELINE\n");
+   printf("                         display only the leaves whose registers"
+                                    " changed\n");
+   printf("                         versus a prior dump (-r text or"
+                                    " --raw-binary\n");
+   printf("                         format), plus a per-CPU summary\n");
+   printf("            --cpuinfo    treat -f/--file input as /proc/cpuinfo"
+                                    " content and\n");
+   printf("                         synthesize leaves 0 & 1 from it (without"
+                                    " -f, read\n");
+   printf("                         /proc/cpuinfo itself); such content is"
+                                    " also\n");
+   printf("                         autodetected with plain -f\n");
+   printf("            --has=NAME   report via the exit status (0/1) whether"
+                                    " the CPU\n");
+   printf("                         supports the single named feature (e.g."
+                                    " avx512f),\n");
+   printf("                         reading only the leaf that carries its"
+                                    " bit\n");
+   printf("            --pool       open each /dev/cpu/N/cpuid once, keep the"
+                                    " fds for\n");
+   printf("                         the life of the process, and read them"
+                                    " via pread\n");
+   printf("                         with no affinity migration\n");
+   printf("            --serve=SOCKET\n");
+   printf("                         gather once, then answer leaf/synth/"
+                                    "decode/has\n");
+   printf("                         queries from the cached snapshot over a"
+                                    " unix\n");
+   printf("                         stream socket until killed\n");
+   printf("            --watch[=SECONDS]\n");
+   printf("                         gather once, then re-read only the"
+                                    " volatile leaves\n");
+   printf("                         (thermal, frequency, hypervisor) each"
+                                    " interval and\n");
+   printf("                         print -/+ pairs for registers that"
+                                    " changed; --leaves\n");
+   printf("                         replaces the watched set\n");
+   printf("            --timing     report per-phase wall time for the default"
+                                    " walk\n");
+   printf("                         (setup, gather by leaf range, decode,"
+                                    " print) as\n");
+   printf("                         machine-readable lines on stderr, one per"
+                                    " CPU\n");
+   printf("            --bench-leaf[=LEAF]\n");
+   printf("                         time the CPUID instruction (or driver"
+                                    " read) itself\n");
+   printf("                         in a calibrated rdtsc loop and report"
+                                    " min/median/p99\n");
+   printf("                         cycles per leaf, per CPU, for the given"
+                                    " leaf or a\n");
+   printf("                         default set spanning the walked ranges\n");
+   printf("            --topology   display only the package/core/thread map,"
+                                    " probing\n");
+   printf("                         just the topology leaves on each CPU, in"
+                                    " parallel\n");
+   printf("                         (--parallel=N limits the worker"
+                                    " threads)\n");
    printf("   -v,      --version    display cpuid version\n");
    printf("\n");
    exit(1);
@@ -8475,13 +9232,23 @@ print_reg_raw (unsigned int        reg,
           words[WORD_ECX], words[WORD_EDX]);
 }
 
-static void 
+static void
 print_reg (unsigned int        reg,
            const unsigned int  words[WORD_NUM],
            boolean             raw,
            unsigned int        try,
            code_stash_t*       stash)
 {
+   /*
+   ** -r output never consults the stash or the decode tables: do_final()
+   ** and print_header() are already no-ops for raw, so the bookkeeping
+   ** below would be pure overhead.  Go straight to the raw line.
+   */
+   if (raw) {
+      print_reg_raw(reg, try, words);
+      return;
+   }
+
    if (reg == 0) {
       if (IS_VENDOR_ID(words, "GenuineIntel")) {
          stash->vendor = VENDOR_INTEL;
@@ -9144,11 +9911,130 @@ print_reg (unsigned int        reg,
 
 #define MAX_CPUS  1024
 
+#ifdef USE_CPUID_MODULE
 static int
-real_setup(unsigned int  cpu,
+real_open_driver(unsigned int  cpu)
+{
+   int    cpuid_fd = -1;
+   char   cpuid_name[20];
+
+   if (cpuid_fd == -1 && cpu == 0) {
+      cpuid_fd = open("/dev/cpuid", O_RDONLY);
+      if (cpuid_fd == -1 && errno != ENOENT) {
+         fprintf(stderr,
+                 "%s: cannot open /dev/cpuid; errno = %d (%s)\n",
+                 program, errno, strerror(errno));
+         explain_dev_cpu_errno();
+      }
+   }
+
+   if (cpuid_fd == -1) {
+      sprintf(cpuid_name, "/dev/cpu/%u/cpuid", cpu);
+      cpuid_fd = open(cpuid_name, O_RDONLY);
+      if (cpuid_fd == -1) {
+         if (cpu > 0) {
+            if (errno == ENXIO)  return -1;
+            if (errno == ENODEV) return -1;
+         }
+         if (errno != ENOENT) {
+            fprintf(stderr,
+                    "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n",
+                    program, cpuid_name, errno, strerror(errno));
+            explain_dev_cpu_errno();
+         }
+      }
+   }
+
+   if (cpuid_fd == -1) {
+      /*
+      ** Lots of Linux's omit the /dev/cpuid or /dev/cpu/%u/cpuid files.
+      ** Try creating a temporary file with mknod.
+      **
+      ** mkstemp is of absolutely no security value here because I can't
+      ** use the actual file it generates, and have to delete it and
+      ** re-create it with mknod.  But I have to use it anyway to
+      ** eliminate errors from smartypants gcc/glibc during the link if I
+      ** attempt to use tempnam.
+      */
+      char  tmpname[20];
+      int   dummy_fd;
+      strcpy(tmpname, "/tmp/cpuidXXXXXX");
+      dummy_fd = mkstemp(tmpname);
+      if (dummy_fd != -1) {
+         close(dummy_fd);
+         remove(tmpname);
+         {
+            int  status = mknod(tmpname,
+                                (S_IFCHR | S_IRUSR),
+                                makedev(CPUID_MAJOR, cpu));
+            if (status == 0) {
+               cpuid_fd = open(tmpname, O_RDONLY);
+               remove(tmpname);
+            }
+         }
+      }
+      if (cpuid_fd == -1) {
+         if (cpu > 0) {
+            if (errno == ENXIO)  return -1;
+            if (errno == ENODEV) return -1;
+         }
+         fprintf(stderr,
+                 "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n",
+                 program, cpuid_name, errno, strerror(errno));
+         explain_dev_cpu_errno();
+      }
+   }
+
+   return cpuid_fd;
+}
+#endif
+
+/*
+** --pool keeps one /dev/cpu/N/cpuid fd per CPU open for the life of the
+** process and services every CPU from the calling thread via pread(), with
+** no sched_setaffinity() migration and no open/close churn.  Each fd is
+** opened through the same retry dance as the plain driver path, but exactly
+** once; real_done() deliberately leaves pooled fds open.
+*/
+static struct {
+   boolean       enabled;
+   int*          fds;
+   unsigned int  count;
+} fd_pool = { FALSE, NULL, 0 };
+
+static int
+fd_pool_get(unsigned int  cpu)
+{
+#ifdef USE_CPUID_MODULE
+   if (cpu >= fd_pool.count) {
+      int*  fds = realloc(fd_pool.fds, (cpu+1) * sizeof(int));
+      if (fds == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      fd_pool.fds = fds;
+      unsigned int  i;
+      for (i = fd_pool.count; i <= cpu; i++) {
+         fd_pool.fds[i] = real_open_driver(i);
+      }
+      fd_pool.count = cpu+1;
+   }
+   return fd_pool.fds[cpu];
+#else
+   (void)cpu;
+   return -1;
+#endif
+}
+
+static int
+real_setup(unsigned int  cpu,
            boolean       one_cpu,
            boolean       inst)
 {
+   if (fd_pool.enabled) {
+      return fd_pool_get(cpu);
+   }
+
    if (inst) {
       if (!one_cpu) {
          /*
@@ -9205,83 +10091,48 @@ real_setup(unsigned int  cpu,
       return USE_INSTRUCTION;
    } else {
 #ifdef USE_CPUID_MODULE
-      int    cpuid_fd = -1;
-      char   cpuid_name[20];
-
-      if (cpuid_fd == -1 && cpu == 0) {
-         cpuid_fd = open("/dev/cpuid", O_RDONLY);
-         if (cpuid_fd == -1 && errno != ENOENT) {
-            fprintf(stderr, 
-                    "%s: cannot open /dev/cpuid; errno = %d (%s)\n", 
-                    program, errno, strerror(errno));
-            explain_dev_cpu_errno();
-         }
-      }
-
-      if (cpuid_fd == -1) {
-         sprintf(cpuid_name, "/dev/cpu/%u/cpuid", cpu);
-         cpuid_fd = open(cpuid_name, O_RDONLY);
-         if (cpuid_fd == -1) {
-            if (cpu > 0) {
-               if (errno == ENXIO)  return -1;
-               if (errno == ENODEV) return -1;
-            }
-            if (errno != ENOENT) {
-               fprintf(stderr, 
-                       "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n", 
-                       program, cpuid_name, errno, strerror(errno));
-               explain_dev_cpu_errno();
-            }
-         }
-      }
-
-      if (cpuid_fd == -1) {
-         /*
-         ** Lots of Linux's omit the /dev/cpuid or /dev/cpu/%u/cpuid files.
-         ** Try creating a temporary file with mknod.
-         **
-         ** mkstemp is of absolutely no security value here because I can't
-         ** use the actual file it generates, and have to delete it and
-         ** re-create it with mknod.  But I have to use it anyway to
-         ** eliminate errors from smartypants gcc/glibc during the link if I
-         ** attempt to use tempnam.
-         */
-         char  tmpname[20];
-         int   dummy_fd;
-         strcpy(tmpname, "/tmp/cpuidXXXXXX");
-         dummy_fd = mkstemp(tmpname);
-         if (dummy_fd != -1) {
-            close(dummy_fd);
-            remove(tmpname);
-            {
-               int  status = mknod(tmpname,
-                                   (S_IFCHR | S_IRUSR),
-                                   makedev(CPUID_MAJOR, cpu));
-               if (status == 0) {
-                  cpuid_fd = open(tmpname, O_RDONLY);
-                  remove(tmpname);
-               }
-            }
-         }
-         if (cpuid_fd == -1) {
-            if (cpu > 0) {
-               if (errno == ENXIO)  return -1;
-               if (errno == ENODEV) return -1;
-            }
-            fprintf(stderr, 
-                    "%s: cannot open /dev/cpuid or %s; errno = %d (%s)\n", 
-                    program, cpuid_name, errno, strerror(errno));
-            explain_dev_cpu_errno();
-         }
-      }
-
-      return cpuid_fd;
+      return real_open_driver(cpu);
 #else
       return -1;
 #endif
    }
 }
 
+/*
+** The cpuid driver hands back one 16-byte record per leaf for each 16-byte
+** chunk of a read, advancing the leaf by one per chunk.  So a single large
+** read fetches a run of consecutive leaves at the same ecx, and real_get()
+** can serve later leaves of the run from a buffer instead of issuing one
+** syscall per (leaf, subleaf) pair.  The buffer is per-thread so that
+** --parallel workers do not share it.  Leaf 2 is never served from the
+** buffer: its ancient form wants the instruction re-executed for each try.
+*/
+#define KERNEL_BATCH  16   /* leaves fetched per /dev/cpu/N/cpuid read */
+
+static __thread struct {
+   int           fd;
+   unsigned int  base;
+   unsigned int  ecx;
+   unsigned int  count;
+   unsigned int  data[KERNEL_BATCH][WORD_NUM];
+} kernel_batch = { -1, 0, 0, 0, {{0}} };
+
+/*
+** The counterpart of real_setup(): release a per-CPU handle.  Pooled fds
+** live for the whole process, so only privately opened ones are closed.
+** The batch buffer is keyed by fd number, and a later open() for another
+** CPU may reuse the number just closed, so any buffered run for this fd
+** is invalidated here.
+*/
+static void
+real_done(int  cpuid_fd)
+{
+   if (cpuid_fd == USE_INSTRUCTION) return;
+   if (fd_pool.enabled) return;
+   if (cpuid_fd == kernel_batch.fd) kernel_batch.fd = -1;
+   close(cpuid_fd);
+}
+
 static int real_get (int           cpuid_fd,
                      unsigned int  reg,
                      unsigned int  words[],
@@ -9306,38 +10157,50 @@ static int real_get (int           cpuid_fd,
             "c" (ecx));
 #endif
    } else {
-      off64_t  result;
       off64_t  offset = ((off64_t)ecx << 32) + reg;
       int      status;
 
-      result = lseek64(cpuid_fd, offset, SEEK_SET);
-      if (result == -1) {
-         if (quiet) {
-            return FALSE;
-         } else {
-            fprintf(stderr,
-                    "%s: unable to seek cpuid file to offset 0x%llx;"
-                    " errno = %d (%s)\n",
-                    program, (long long unsigned)offset, 
-                    errno, strerror(errno));
-            exit(1);
-         }
-      }
-
       unsigned int  old_words[WORD_NUM];
       if (ecx != 0) memcpy(old_words, words, sizeof(old_words));
 
-      status = read(cpuid_fd, words, 16);
-      if (status == -1) {
-         if (quiet) {
-            return FALSE;
+      if (reg != 2
+          && cpuid_fd == kernel_batch.fd
+          && ecx == kernel_batch.ecx
+          && reg >= kernel_batch.base
+          && reg - kernel_batch.base < kernel_batch.count) {
+         memcpy(words, kernel_batch.data[reg - kernel_batch.base],
+                sizeof(unsigned int) * WORD_NUM);
+      } else {
+         /*
+         ** pread() rather than lseek()+read(): one syscall fewer, and no
+         ** shared file position, so pooled fds are safe to use from any
+         ** thread.
+         */
+         status = pread(cpuid_fd, kernel_batch.data,
+                        sizeof(kernel_batch.data), offset);
+         if (status >= 16) {
+            kernel_batch.fd    = cpuid_fd;
+            kernel_batch.base  = reg;
+            kernel_batch.ecx   = ecx;
+            kernel_batch.count = (unsigned int)status / 16;
+            memcpy(words, kernel_batch.data[0],
+                   sizeof(unsigned int) * WORD_NUM);
          } else {
-            fprintf(stderr,
-                    "%s: unable to read cpuid file at offset 0x%llx;"
-                    " errno = %d (%s)\n",
-                    program, (long long unsigned)offset,
-                    errno, strerror(errno));
-            exit(1);
+            /* Fall back to the old one-leaf read. */
+            kernel_batch.fd = -1;
+            status = pread(cpuid_fd, words, 16, offset);
+            if (status == -1) {
+               if (quiet) {
+                  return FALSE;
+               } else {
+                  fprintf(stderr,
+                          "%s: unable to read cpuid file at offset 0x%llx;"
+                          " errno = %d (%s)\n",
+                          program, (long long unsigned)offset,
+                          errno, strerror(errno));
+                  exit(1);
+               }
+            }
          }
       }
 
@@ -9400,523 +10263,3351 @@ print_header (unsigned int  reg,
    }
 }
 
-static void
-do_real_one(unsigned int  reg,
-            unsigned int  try,
-            boolean       one_cpu,
-            boolean       inst,
-            boolean       raw,
-            boolean       debug UNUSED)
+/*
+** walk_real_leaves() performs the complete leaf & subleaf walk for one CPU,
+** invoking the supplied handler for each (leaf, subleaf) pair gathered.  The
+** subleaf iteration rules here are the single authority on what constitutes a
+** full walk; both the serial and the parallel paths in do_real() drive it.
+**
+** The walk needs a little decoded state of its own (the leaf 1 hypervisor
+** bit, and the hypervisor identity from leaf 0x40000000) to know which leaf
+** ranges to visit, so it tracks those locally rather than depending on the
+** handler to maintain a code_stash_t.
+*/
+typedef void (*leaf_handler_t)(unsigned int        reg,
+                               unsigned int        try,
+                               const unsigned int  words[WORD_NUM],
+                               void*               data);
+
+/*
+** The leaf descriptor registry is the single authority on how each
+** subleaf-bearing leaf iterates.  Every leaf's termination rule is one of a
+** few policies, parameterized by which registers it reads:
+**
+**    SUBLEAF_REPEAT  subleaf 0's al is the number of times to re-execute
+**                    the leaf, always with ecx=0 (leaf 2 only).
+**    SUBLEAF_COUNT   subleaf 0's eax is the highest valid subleaf; visit
+**                    0..eax.
+**    SUBLEAF_WHILE   visit subleaves from 0 for as long as the registers
+**                    selected by the live[] masks are non-zero; the
+**                    terminating subleaf is not reported.
+**    SUBLEAF_UNTIL   visit subleaf 0 unconditionally, then subsequent
+**                    subleaves (up to limit) until the live[] registers go
+**                    to zero; the terminating subleaf is reported.
+**    SUBLEAF_MASK    subleaf 0's register word holds a validity bitmask:
+**                    subleaf n (1..limit) is present if bit n-bias is set.
+**    SUBLEAF_XSAVE   leaf 0xd's bespoke rule: the valid subleaf set is the
+**                    catenated xcr0/xss masks spanning subleaves 0 & 1.
+**    SUBLEAF_FIXED   subleaves 0..limit are present unconditionally.
+**
+** walk_one_leaf() interprets the registry for the live paths (the full
+** walk, --leaves, and the gather phases), probe_plan_check_mask() derives
+** from it which registers govern iteration (and so must be re-checked on a
+** plan replay), and do_file() uses the legacy_seq flag to reconstruct try
+** numbers for old-style dumps that omitted them.  New ecx-dependent leaves
+** need only a registry entry.
+*/
+typedef enum {
+   SUBLEAF_REPEAT,
+   SUBLEAF_COUNT,
+   SUBLEAF_WHILE,
+   SUBLEAF_UNTIL,
+   SUBLEAF_MASK,
+   SUBLEAF_XSAVE,
+   SUBLEAF_FIXED
+} subleaf_policy_t;
+
+typedef struct {
+   unsigned int      reg;
+   subleaf_policy_t  policy;
+   unsigned int      live[WORD_NUM];  /* WHILE/UNTIL: liveness masks */
+   unsigned char     word;            /* MASK: word holding validity bits */
+   unsigned char     bias;            /* MASK: bit for subleaf n is n-bias */
+   unsigned int      limit;           /* MASK/UNTIL/FIXED: highest subleaf */
+   boolean           xen_only;        /* subleaves exist only under Xen */
+   boolean           legacy_seq;      /* old-style dumps repeat this leaf */
+} leaf_descriptor_t;
+
+static const leaf_descriptor_t  leaf_descriptors[] = {
+   { 2,          SUBLEAF_REPEAT, { 0 },                  0, 0, 0,
+     FALSE, TRUE  },
+   { 4,          SUBLEAF_WHILE,  { 0x1f, 0, 0, 0 },      0, 0, 0,
+     FALSE, TRUE  },
+   { 7,          SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, TRUE  },
+   { 0xb,        SUBLEAF_WHILE,  { ~0U, ~0U, 0, 0 },     0, 0, 0,
+     FALSE, TRUE  },
+   { 0xd,        SUBLEAF_XSAVE,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0xf,        SUBLEAF_MASK,   { 0 },                  WORD_EDX, 0, 1,
+     FALSE, FALSE },
+   { 0x10,       SUBLEAF_MASK,   { 0 },                  WORD_EBX, 0, 31,
+     FALSE, FALSE },
+   { 0x12,       SUBLEAF_MASK,   { 0 },                  WORD_EAX, 1, 32,
+     FALSE, FALSE },
+   { 0x14,       SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0x17,       SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0x18,       SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0x1d,       SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0x1f,       SUBLEAF_UNTIL,  { 0, 0, 0xff00, 0 },    0, 0, 255,
+     FALSE, FALSE },
+   { 0x20,       SUBLEAF_COUNT,  { 0 },                  0, 0, 0,
+     FALSE, FALSE },
+   { 0x40000003, SUBLEAF_FIXED,  { 0 },                  0, 0, 2,
+     TRUE,  FALSE },
+   { 0x8000001d, SUBLEAF_WHILE,  { 0x1f, 0, 0, 0 },      0, 0, 0,
+     FALSE, TRUE  },
+   // Rules for 0x80000020 loop termination from SKC*.
+   { 0x80000020, SUBLEAF_WHILE,  { ~0U, ~0U, ~0U, ~0U }, 0, 0, 0,
+     FALSE, FALSE },
+};
+
+static const leaf_descriptor_t*
+leaf_descriptor(unsigned int  reg)
 {
-   unsigned int  cpu;
+   unsigned int  i;
+   for (i = 0; i < LENGTH(leaf_descriptors); i++) {
+      if (leaf_descriptors[i].reg == reg) return &leaf_descriptors[i];
+   }
+   return NULL;
+}
 
-   for (cpu = 0;; cpu++) {
-      int            cpuid_fd   = -1;
-      code_stash_t   stash      = NIL_STASH;
+static boolean
+subleaf_live(const leaf_descriptor_t*  desc,
+             const unsigned int        words[WORD_NUM])
+{
+   unsigned int  w;
+   for (w = 0; w < WORD_NUM; w++) {
+      if ((words[w] & desc->live[w]) != 0) return TRUE;
+   }
+   return FALSE;
+}
 
-      if (one_cpu && cpu > 0) break;
+/*
+** walk_one_leaf() performs the subleaf iteration for a single leaf whose
+** subleaf 0 value has already been read into words, invoking the handler
+** for each (leaf, subleaf) pair.  Leaves with no registry entry get exactly
+** one handler call.  The hypervisor identity only matters for leaf
+** 0x40000003, which has subleaves under Xen; callers that have not probed
+** it pass HYPERVISOR_UNKNOWN.
+*/
+static void
+walk_one_leaf(int             cpuid_fd,
+              unsigned int    reg,
+              unsigned int    words[WORD_NUM],
+              hypervisor_t    hypervisor,
+              leaf_handler_t  handler,
+              void*           data)
+{
+   const leaf_descriptor_t*  desc = leaf_descriptor(reg);
+   unsigned int              try;
 
-      cpuid_fd = real_setup(cpu, one_cpu, inst);
-      if (cpuid_fd == -1) break;
+   if (desc == NULL || (desc->xen_only && hypervisor != HYPERVISOR_XEN)) {
+      handler(reg, 0, words, data);
+      return;
+   }
 
-      if (inst && one_cpu) {
-         printf("CPU:\n");
-      } else {
-         printf("CPU %u:\n", cpu);
+   switch (desc->policy) {
+   case SUBLEAF_REPEAT:
+      {
+         unsigned int  max_tries = words[WORD_EAX] & 0xff;
+         try = 0;
+         for (;;) {
+            handler(reg, try, words, data);
+            try++;
+            if (try >= max_tries) break;
+            real_get(cpuid_fd, reg, words, 0, FALSE);
+         }
+      }
+      break;
+   case SUBLEAF_COUNT:
+      {
+         unsigned int  max_tries = 0;
+         try = 0;
+         for (;;) {
+            handler(reg, try, words, data);
+            if (try == 0) {
+               max_tries = words[WORD_EAX];
+            }
+            try++;
+            if (try > max_tries) break;
+            real_get(cpuid_fd, reg, words, try, FALSE);
+         }
+      }
+      break;
+   case SUBLEAF_WHILE:
+      try = 0;
+      while (subleaf_live(desc, words)) {
+         handler(reg, try, words, data);
+         try++;
+         real_get(cpuid_fd, reg, words, try, FALSE);
+      }
+      break;
+   case SUBLEAF_UNTIL:
+      handler(reg, 0, words, data);
+      for (try = 1; try <= desc->limit; try++) {
+         real_get(cpuid_fd, reg, words, try, FALSE);
+         handler(reg, try, words, data);
+         if (!subleaf_live(desc, words)) break;
+      }
+      break;
+   case SUBLEAF_MASK:
+      {
+         unsigned int  mask = words[desc->word];
+         handler(reg, 0, words, data);
+         for (try = 1; try <= desc->limit; try++) {
+            if (mask & (1U << (try - desc->bias))) {
+               real_get(cpuid_fd, reg, words, try, FALSE);
+               handler(reg, try, words, data);
+            }
+         }
+      }
+      break;
+   case SUBLEAF_XSAVE:
+      {
+         /*
+         ** ecx values 0 & 1 are special.
+         **
+         ** Intel:
+         **    For ecx values 2..63, the leaf is present if the corresponding
+         **    bit is present in the bit catenation of 0xd/0/edx + 0xd/0/eax,
+         **    or the bit catenation of 0xd/1/edx + 0xd/1/ecx.
+         ** AMD:
+         **    Only 4 ecx values are defined and it's gappy.  It's unclear
+         **    what the upper bound of any loop would be, so it seems
+         **    inappropriate to use one.
+         */
+         handler(reg, 0, words, data);
+         unsigned long long  valid_xcr0
+            = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_EAX];
+         real_get(cpuid_fd, reg, words, 1, FALSE);
+         handler(reg, 1, words, data);
+         unsigned long long  valid_xss
+            = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_ECX];
+         unsigned long long  valid_tries = valid_xcr0 | valid_xss;
+         for (try = 2; try < 63; try++) {
+            if (valid_tries & (1ull << try)) {
+               real_get(cpuid_fd, reg, words, try, FALSE);
+               handler(reg, try, words, data);
+            }
+         }
+      }
+      break;
+   case SUBLEAF_FIXED:
+      handler(reg, 0, words, data);
+      for (try = 1; try <= desc->limit; try++) {
+         real_get(cpuid_fd, reg, words, try, FALSE);
+         handler(reg, try, words, data);
       }
+      break;
+   }
+}
 
-      unsigned int  words[WORD_NUM];
-      real_get(cpuid_fd, reg, words, try, FALSE);
-      print_reg(reg, words, raw, try, &stash);
+/*
+** --timing instruments each phase of the default walk per CPU -- setup
+** (the real_setup() migration), gather split by leaf range (basic,
+** hypervisor, extended, and probe-plan replay), decode, and print (the
+** out_flush() write) -- and emits one machine-readable line per CPU plus
+** a total to stderr at exit.  This distinguishes sched_setaffinity()
+** migration latency from slow CPUID exits under a hypervisor, from
+** range-probing cost, from decode time, from stdout backpressure.
+** timing.current points at the CPU being walked; the walk hooks are
+** no-ops when it is NULL, so only do_real() pays for them.
+*/
+typedef struct {
+   unsigned long long  setup;
+   unsigned long long  gather_basic;
+   unsigned long long  gather_hv;
+   unsigned long long  gather_ext;
+   unsigned long long  gather_replay;
+   unsigned long long  decode;
+   unsigned long long  print;
+} cpu_timing_t;
+
+static struct {
+   boolean        enabled;
+   cpu_timing_t*  cpus;
+   unsigned int   count;
+   cpu_timing_t*  current;
+} timing = { FALSE, NULL, 0, NULL };
+
+static unsigned long long
+timing_now(void)
+{
+   struct timespec  ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* Charge the time since *mark to the bucket and restart the mark. */
+static void
+timing_charge(unsigned long long*  bucket,
+              unsigned long long*  mark)
+{
+   unsigned long long  now = timing_now();
+   *bucket += now - *mark;
+   *mark    = now;
+}
+
+static cpu_timing_t*
+timing_cpu(unsigned int  cpu)
+{
+   if (cpu >= timing.count) {
+      cpu_timing_t*  cpus = realloc(timing.cpus,
+                                    (cpu+1) * sizeof(cpu_timing_t));
+      if (cpus == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      memset(&cpus[timing.count], 0,
+             (cpu+1 - timing.count) * sizeof(cpu_timing_t));
+      timing.cpus  = cpus;
+      timing.count = cpu+1;
    }
+   return &timing.cpus[cpu];
 }
 
 static void
-do_real(boolean  one_cpu,
-        boolean  inst,
-        boolean  raw,
-        boolean  debug)
+timing_report(void)
 {
+   if (!timing.enabled) return;
+
+   cpu_timing_t  total;
+   memset(&total, 0, sizeof(total));
+
    unsigned int  cpu;
+   for (cpu = 0; cpu < timing.count; cpu++) {
+      const cpu_timing_t*  t = &timing.cpus[cpu];
+      fprintf(stderr,
+              "timing cpu=%u setup_ns=%llu gather_basic_ns=%llu"
+              " gather_hv_ns=%llu gather_ext_ns=%llu"
+              " gather_replay_ns=%llu decode_ns=%llu print_ns=%llu\n",
+              cpu, t->setup, t->gather_basic, t->gather_hv, t->gather_ext,
+              t->gather_replay, t->decode, t->print);
+      total.setup         += t->setup;
+      total.gather_basic  += t->gather_basic;
+      total.gather_hv     += t->gather_hv;
+      total.gather_ext    += t->gather_ext;
+      total.gather_replay += t->gather_replay;
+      total.decode        += t->decode;
+      total.print         += t->print;
+   }
 
-   for (cpu = 0;; cpu++) {
-      int            cpuid_fd   = -1;
-      code_stash_t   stash      = NIL_STASH;
-      unsigned int   max;
-      unsigned int   reg;
+   fprintf(stderr,
+           "timing cpu=all setup_ns=%llu gather_basic_ns=%llu"
+           " gather_hv_ns=%llu gather_ext_ns=%llu"
+           " gather_replay_ns=%llu decode_ns=%llu print_ns=%llu\n",
+           total.setup, total.gather_basic, total.gather_hv,
+           total.gather_ext, total.gather_replay, total.decode,
+           total.print);
+}
 
-      if (one_cpu && cpu > 0) break;
+/*
+** A cpu_snapshot_t holds every (leaf, subleaf) result from one CPU's walk, so
+** that gathering (which may require being pinned to that CPU) can be
+** decoupled from decoding & printing (which can happen anywhere, later, in
+** CPU order).
+*/
+typedef struct {
+   unsigned int  reg;
+   unsigned int  try;
+   unsigned int  words[WORD_NUM];
+} leaf_record_t;
 
-      cpuid_fd = real_setup(cpu, one_cpu, inst);
-      if (cpuid_fd == -1) break;
+typedef struct {
+   leaf_record_t*  records;
+   unsigned int    count;
+   unsigned int    allocated;
+   boolean         present;
+} cpu_snapshot_t;
+
+static void
+snapshot_handler(unsigned int        reg,
+                 unsigned int        try,
+                 const unsigned int  words[WORD_NUM],
+                 void*               data)
+{
+   cpu_snapshot_t*  snapshot = (cpu_snapshot_t*)data;
+
+   if (snapshot->count >= snapshot->allocated) {
+      unsigned int    allocated = (snapshot->allocated == 0
+                                   ? 256 : snapshot->allocated * 2);
+      leaf_record_t*  records   = realloc(snapshot->records,
+                                          allocated * sizeof(leaf_record_t));
+      if (records == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      snapshot->records   = records;
+      snapshot->allocated = allocated;
+   }
 
-      if (inst && one_cpu) {
-         printf("CPU:\n");
-      } else {
-         printf("CPU %u:\n", cpu);
+   leaf_record_t*  record = &snapshot->records[snapshot->count++];
+   record->reg = reg;
+   record->try = try;
+   memcpy(record->words, words, sizeof(record->words));
+}
+
+/*
+** On homogeneous hosts, every CPU yields the same discovery: the same range
+** maxima, the same subleaf counts, and the same trial probes of absent
+** ranges.  So the first full walk a thread performs is recorded as a "probe
+** plan" -- the exact (leaf, subleaf) sequence -- and subsequent walks replay
+** it, reading each tuple directly with no trial probes and no terminating
+** subleaf reads.  The replay is guarded: for every word that drives
+** walk_real_leaves()/walk_one_leaf() iteration (range maxima, subleaf
+** counts, level types, and so on), the fresh value must match the plan's;
+** any mismatch (e.g. hybrid cores with different cache hierarchies)
+** abandons the replay and falls back to a full walk, which then becomes the
+** new plan.  The plan is per-thread, so --parallel workers do not share it.
+**
+** Replayed results are buffered and handed to the handler only once the
+** whole replay has validated, so a mismatch can fall back cleanly even for
+** handlers that print as they go.
+*/
+static __thread struct {
+   leaf_record_t*  records;
+   unsigned int    count;
+   boolean         valid;
+} probe_plan = { NULL, 0, FALSE };
+
+/*
+** Which words of a (leaf, subleaf) tuple drive the walk?  The subleaf cases
+** are derived from the leaf descriptor registry -- exactly the registers a
+** policy reads govern iteration -- plus hand-written cases for the range
+** maxima and the leaf 1 hypervisor bit; everything else (APIC IDs,
+** frequencies, ...) may legitimately vary across CPUs.
+*/
+static unsigned int
+probe_plan_check_mask(unsigned int  reg,
+                      unsigned int  try)
+{
+   switch (reg) {
+   case 0:          return 1 << WORD_EAX;
+   case 1:          return 1 << WORD_ECX;   /* hypervisor bit */
+   case 0x40000000: return ((1 << WORD_EAX) | (1 << WORD_EBX)
+                            | (1 << WORD_ECX) | (1 << WORD_EDX));
+   case 0x20000000:
+   case 0x80000000:
+   case 0x80860000:
+   case 0xc0000000: return 1 << WORD_EAX;
+   }
+
+   const leaf_descriptor_t*  desc = leaf_descriptor(reg);
+   if (desc == NULL) return 0;
+
+   switch (desc->policy) {
+   case SUBLEAF_REPEAT:
+   case SUBLEAF_COUNT:
+      return try == 0 ? 1 << WORD_EAX : 0;
+   case SUBLEAF_WHILE:
+   case SUBLEAF_UNTIL:
+      {
+         unsigned int  mask = 0;
+         unsigned int  w;
+         for (w = 0; w < WORD_NUM; w++) {
+            if (desc->live[w] != 0) mask |= 1 << w;
+         }
+         return mask;
       }
+   case SUBLEAF_MASK:
+      return try == 0 ? 1U << desc->word : 0;
+   case SUBLEAF_XSAVE:
+      return (try == 0 ? (1 << WORD_EAX) | (1 << WORD_EDX)
+              : try == 1 ? (1 << WORD_ECX) | (1 << WORD_EDX)
+              : 0);
+   case SUBLEAF_FIXED:
+      return 0;
+   }
+   return 0;
+}
 
-      max = 0;
-      for (reg = 0; reg <= max; reg++) {
-         unsigned int  words[WORD_NUM];
+static boolean
+replay_probe_plan(int             cpuid_fd,
+                  leaf_handler_t  handler,
+                  void*           data)
+{
+   /*
+   ** The buffer is a per-thread arena, reset (not freed) between replays:
+   ** after the first gather sizes it, the steady-state loop performs no
+   ** heap allocation at all, which keeps batch & server throughput flat
+   ** regardless of allocator behavior.
+   */
+   static __thread cpu_snapshot_t  buffered    = { NULL, 0, 0, FALSE };
+   boolean                         ok          = TRUE;
+   unsigned long long              timing_mark = 0;
+   unsigned int                    i;
 
-         real_get(cpuid_fd, reg, words, 0, FALSE);
+   if (timing.current != NULL) {
+      timing_mark = timing_now();
+   }
 
-         if (reg == 0) {
-            max = words[WORD_EAX];
+   buffered.count = 0;
+
+   for (i = 0; i < probe_plan.count; i++) {
+      const leaf_record_t*  record = &probe_plan.records[i];
+      unsigned int          words[WORD_NUM];
+
+      if (!real_get(cpuid_fd, record->reg, words, record->try, TRUE)) {
+         ok = FALSE;
+         break;
+      }
+
+      unsigned int  mask = probe_plan_check_mask(record->reg, record->try);
+      unsigned int  w;
+      for (w = 0; w < WORD_NUM; w++) {
+         if ((mask & (1 << w)) && words[w] != record->words[w]) {
+            ok = FALSE;
+            break;
          }
+      }
+      if (!ok) break;
 
-         if (reg == 2) {
-            unsigned int  max_tries = words[WORD_EAX] & 0xff;
-            unsigned int  try       = 0;
+      snapshot_handler(record->reg, record->try, words, &buffered);
+   }
 
-            print_header(reg, try, raw);
+   if (ok) {
+      for (i = 0; i < buffered.count; i++) {
+         const leaf_record_t*  record = &buffered.records[i];
+         handler(record->reg, record->try, record->words, data);
+      }
+   }
 
-            for (;;) {
-               print_reg(reg, words, raw, try, &stash);
+   if (timing.current != NULL) {
+      timing_charge(&timing.current->gather_replay, &timing_mark);
+   }
 
-               try++;
-               if (try >= max_tries) break;
+   return ok;
+}
 
-               real_get(cpuid_fd, reg, words, 0, FALSE);
-            }
-         } else if (reg == 4) {
-            unsigned int  try = 0;
-            while ((words[WORD_EAX] & 0x1f) != 0) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               try++;
-               real_get(cpuid_fd, reg, words, try, FALSE);
-            }
-         } else if (reg == 7) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
-            }
-         } else if (reg == 0xb) {
-            unsigned int  try = 0;
-            while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               try++;
-               real_get(cpuid_fd, reg, words, try, FALSE);
-            }
-         } else if (reg == 0xd) {
-            /* 
-            ** ecx values 0 & 1 are special.
-            ** 
-            ** Intel:
-            **    For ecx values 2..63, the leaf is present if the corresponding
-            **    bit is present in the bit catenation of 0xd/0/edx + 0xd/0/eax,
-            **    or the bit catenation of 0xd/1/edx + 0xd/1/ecx.
-            ** AMD:
-            **    Only 4 ecx values are defined and it's gappy.  It's unclear
-            **    what the upper bound of any loop would be, so it seems
-            **    inappropriate to use one.
-            */
-            print_header(reg, 0, raw);
-            print_reg(reg, words, raw, 0, &stash);
-            unsigned long long  valid_xcr0
-               = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_EAX];
-            real_get(cpuid_fd, reg, words, 1, FALSE);
-            print_reg(reg, words, raw, 1, &stash);
-            unsigned long long  valid_xss
-               = ((unsigned long long)words[WORD_EDX] << 32) | words[WORD_ECX];
-            unsigned long long  valid_tries = valid_xcr0 | valid_xss;
-            unsigned int  try;
-            for (try = 2; try < 63; try++) {
-               if (valid_tries & (1ull << try)) {
-                  real_get(cpuid_fd, reg, words, try, FALSE);
-                  print_reg(reg, words, raw, try, &stash);
-               }
+typedef struct {
+   leaf_handler_t  handler;
+   void*           data;
+   cpu_snapshot_t  plan;
+} plan_capture_t;
+
+static void
+plan_capture_handler(unsigned int        reg,
+                     unsigned int        try,
+                     const unsigned int  words[WORD_NUM],
+                     void*               data)
+{
+   plan_capture_t*  capture = (plan_capture_t*)data;
+   snapshot_handler(reg, try, words, &capture->plan);
+   capture->handler(reg, try, words, capture->data);
+}
+
+static void
+walk_full_real_leaves(int             cpuid_fd,
+                      leaf_handler_t  handler,
+                      void*           data)
+{
+   unsigned int        max;
+   unsigned int        reg;
+   unsigned int        val_1_ecx   = 0;
+   hypervisor_t        hypervisor  = HYPERVISOR_UNKNOWN;
+   unsigned long long  timing_mark = 0;
+
+   if (timing.current != NULL) {
+      timing_mark = timing_now();
+   }
+
+   max = 0;
+   for (reg = 0; reg <= max; reg++) {
+      unsigned int  words[WORD_NUM];
+
+      real_get(cpuid_fd, reg, words, 0, FALSE);
+
+      if (reg == 0) {
+         max = words[WORD_EAX];
+      }
+      if (reg == 1) {
+         val_1_ecx = words[WORD_ECX];
+      }
+
+      walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+   }
+
+   if (timing.current != NULL) {
+      timing_charge(&timing.current->gather_basic, &timing_mark);
+   }
+
+   if (BIT_EXTRACT_LE(val_1_ecx, 31, 32)) {
+      max = 0x40000000;
+      for (reg = 0x40000000; reg <= max; reg++) {
+         boolean       success;
+         unsigned int  words[WORD_NUM];
+
+         success = real_get(cpuid_fd, reg, words, 0, TRUE);
+         if (!success) break;
+
+         if (reg == 0x40000000) {
+            max = words[WORD_EAX];
+            if (IS_HYPERVISOR_ID(words, "VMwareVMware")) {
+               hypervisor = HYPERVISOR_VMWARE;
+            } else if (IS_HYPERVISOR_ID(words, "XenVMMXenVMM")) {
+               hypervisor = HYPERVISOR_XEN;
+            } else if (IS_HYPERVISOR_ID(words, "KVMKVMKVM\0\0\0")) {
+               hypervisor = HYPERVISOR_KVM;
+            } else if (IS_HYPERVISOR_ID(words, "Microsoft Hv")) {
+               hypervisor = HYPERVISOR_MICROSOFT;
             }
-         } else if (reg == 0xf) {
-            unsigned int  mask = words[WORD_EDX];
-            print_header(reg, 0, raw);
-            print_reg(reg, words, raw, 0, &stash);
-            if (BIT_EXTRACT_LE(mask, 1, 2)) {
-               real_get(cpuid_fd, reg, words, 1, FALSE);
-               print_reg(reg, words, raw, 1, &stash);
+         }
+
+         walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+
+         if (reg == 0x40000000
+             && hypervisor == HYPERVISOR_KVM
+             && max == 0) {
+            max = 0x40000001;
+         }
+         if (reg == 0x40000000
+             && hypervisor == HYPERVISOR_UNKNOWN
+             && max > 0x40001000) {
+            // Assume some busted cpuid information and stop walking
+            // further 0x4xxxxxxx registers.
+            max = 0x40000000;
+         }
+      }
+   }
+
+   if (timing.current != NULL) {
+      timing_charge(&timing.current->gather_hv, &timing_mark);
+   }
+
+   max = 0x20000000;
+   for (reg = 0x20000000; reg <= max; reg++) {
+      boolean       success;
+      unsigned int  words[WORD_NUM];
+
+      success = real_get(cpuid_fd, reg, words, 0, TRUE);
+      if (!success) break;
+
+      if (reg == 0x20000000) {
+         max = words[WORD_EAX];
+         if (max > 0x20000100) {
+            // Pentium 4 (and probably many early CPUs) don't support this
+            // leaf correctly and return garbage (which appears to be a
+            // replica of the values for the last valid leaf in the
+            // 0x0xxxxxxx range).  As a sanity check to avoid an absurdly
+            // long dump, if the value obviously is out-of-range, just
+            // disable all further 0x2xxxxxxx leaves.
+            max = 0x20000000;
+         }
+      }
+
+      walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+   }
+
+   max = 0x80000000;
+   for (reg = 0x80000000; reg <= max; reg++) {
+      boolean       success;
+      unsigned int  words[WORD_NUM];
+
+      success = real_get(cpuid_fd, reg, words, 0, TRUE);
+      if (!success) break;
+
+      if (reg == 0x80000000) {
+         max = words[WORD_EAX];
+      }
+
+      walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+   }
+
+   max = 0x80860000;
+   for (reg = 0x80860000; reg <= max; reg++) {
+      boolean       success;
+      unsigned int  words[WORD_NUM];
+
+      success = real_get(cpuid_fd, reg, words, 0, TRUE);
+      if (!success) break;
+
+      if (reg == 0x80860000) {
+         max = words[WORD_EAX];
+      }
+
+      walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+   }
+
+   max = 0xc0000000;
+   for (reg = 0xc0000000; reg <= max; reg++) {
+      boolean       success;
+      unsigned int  words[WORD_NUM];
+
+      success = real_get(cpuid_fd, reg, words, 0, TRUE);
+      if (!success) break;
+
+      if (reg == 0xc0000000) {
+         max = words[WORD_EAX];
+      }
+
+      if (max > 0xc0001000) {
+         // Assume some busted cpuid information and stop walking
+         // further 0x4xxxxxxx registers.
+         max = 0xc0000000;
+      }
+
+      walk_one_leaf(cpuid_fd, reg, words, hypervisor, handler, data);
+   }
+
+   if (timing.current != NULL) {
+      timing_charge(&timing.current->gather_ext, &timing_mark);
+   }
+}
+
+static void
+walk_real_leaves(int             cpuid_fd,
+                 leaf_handler_t  handler,
+                 void*           data)
+{
+   if (probe_plan.valid && replay_probe_plan(cpuid_fd, handler, data)) {
+      return;
+   }
+
+   plan_capture_t  capture = { handler, data, { NULL, 0, 0, FALSE } };
+   walk_full_real_leaves(cpuid_fd, plan_capture_handler, &capture);
+
+   /* This walk becomes the plan, superseding any plan it mismatched. */
+   free(probe_plan.records);
+   probe_plan.records = capture.plan.records;
+   probe_plan.count   = capture.plan.count;
+   probe_plan.valid   = TRUE;
+}
+
+typedef struct {
+   boolean        raw;
+   code_stash_t*  stash;
+} print_leaf_data_t;
+
+static void
+print_leaf_handler(unsigned int        reg,
+                   unsigned int        try,
+                   const unsigned int  words[WORD_NUM],
+                   void*               data)
+{
+   print_leaf_data_t*  pld = (print_leaf_data_t*)data;
+   print_header(reg, try, pld->raw);
+   print_reg(reg, words, pld->raw, try, pld->stash);
+}
+
+static void
+replay_snapshot(const cpu_snapshot_t*  snapshot,
+                boolean                raw,
+                boolean                debug)
+{
+   unsigned int  i;
+
+   if (raw) {
+      /* Raw collection touches no code_stash_t at all. */
+      for (i = 0; i < snapshot->count; i++) {
+         const leaf_record_t*  record = &snapshot->records[i];
+         print_reg_raw(record->reg, record->try, record->words);
+      }
+      return;
+   }
+
+   code_stash_t  stash = NIL_STASH;
+
+   for (i = 0; i < snapshot->count; i++) {
+      const leaf_record_t*  record = &snapshot->records[i];
+      print_header(record->reg, record->try, raw);
+      print_reg(record->reg, record->words, raw, record->try, &stash);
+   }
+
+   do_final(raw, debug, &stash);
+}
+
+/*
+** The binary raw dump format (--raw-binary) is a compact, versioned
+** alternative to the -r text format; see cpuid-dump.h, which defines it
+** for both this tool and cpuid-merge.  do_file() recognizes the magic and
+** replays such dumps with no per-line parsing at all.
+*/
+static struct {
+   boolean                enabled;
+   binary_dump_record_t*  records;
+   unsigned int           count;
+   unsigned int           allocated;
+   unsigned int           cpu_count;
+   unsigned int           current_cpu;
+} binary_dump = { FALSE, NULL, 0, 0, 0, 0 };
+
+static void
+binary_dump_start_cpu(unsigned int  cpu)
+{
+   binary_dump.current_cpu = cpu;
+   binary_dump.cpu_count++;
+}
+
+static void
+binary_dump_record(unsigned int        reg,
+                   unsigned int        try,
+                   const unsigned int  words[WORD_NUM])
+{
+   if (binary_dump.count >= binary_dump.allocated) {
+      unsigned int           allocated = (binary_dump.allocated == 0
+                                          ? 256 : binary_dump.allocated * 2);
+      binary_dump_record_t*  records
+         = realloc(binary_dump.records,
+                   allocated * sizeof(binary_dump_record_t));
+      if (records == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      binary_dump.records   = records;
+      binary_dump.allocated = allocated;
+   }
+
+   binary_dump_record_t*  record = &binary_dump.records[binary_dump.count++];
+   record->cpu = binary_dump.current_cpu;
+   record->reg = reg;
+   record->try = try;
+   memcpy(record->words, words, sizeof(record->words));
+}
+
+static void
+binary_dump_handler(unsigned int        reg,
+                    unsigned int        try,
+                    const unsigned int  words[WORD_NUM],
+                    void*               data UNUSED)
+{
+   binary_dump_record(reg, try, words);
+}
+
+static void
+binary_dump_write(void)
+{
+   binary_dump_header_t  header;
+   memcpy(header.magic, BINARY_DUMP_MAGIC, sizeof(header.magic));
+   header.version      = BINARY_DUMP_VERSION;
+   header.cpu_count    = binary_dump.cpu_count;
+   header.record_count = binary_dump.count;
+   header.reserved     = 0;
+
+   if (fwrite(&header, sizeof(header), 1, stdout) != 1
+       || (binary_dump.count > 0
+           && fwrite(binary_dump.records, sizeof(binary_dump_record_t),
+                     binary_dump.count, stdout) != binary_dump.count)) {
+      fprintf(stderr,
+              "%s: unable to write binary dump; errno = %d (%s)\n",
+              program, errno, strerror(errno));
+      exit(1);
+   }
+}
+
+/*
+** Each worker thread walks the CPUs congruent to its index mod the worker
+** count.  real_setup() pins via the sched_setaffinity system service, which
+** on Linux affects only the calling thread, so workers migrate independently
+** of each other.  Results land in per-CPU snapshots; nothing is printed from
+** the workers, so output cannot tear and stays in CPU order.
+*/
+typedef struct {
+   unsigned int     index;
+   unsigned int     stride;
+   unsigned int     num_cpus;
+   boolean          inst;
+   cpu_snapshot_t*  snapshots;
+} gather_worker_t;
+
+static void*
+gather_worker(void*  arg)
+{
+   gather_worker_t*  worker = (gather_worker_t*)arg;
+   unsigned int      cpu;
+
+   for (cpu = worker->index; cpu < worker->num_cpus; cpu += worker->stride) {
+      cpu_snapshot_t*  snapshot = &worker->snapshots[cpu];
+      int              cpuid_fd = real_setup(cpu, FALSE, worker->inst);
+      if (cpuid_fd == -1) continue;
+      walk_real_leaves(cpuid_fd, snapshot_handler, snapshot);
+      snapshot->present = TRUE;
+      real_done(cpuid_fd);
+   }
+
+   return NULL;
+}
+
+static void
+do_real_parallel(unsigned int  num_threads,
+                 boolean       inst,
+                 boolean       raw,
+                 boolean       debug)
+{
+   unsigned int  num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+   if (num_cpus > MAX_CPUS) num_cpus = MAX_CPUS;
+   if (num_threads == 0 || num_threads > num_cpus) num_threads = num_cpus;
+
+   cpu_snapshot_t*   snapshots = calloc(num_cpus,    sizeof(cpu_snapshot_t));
+   gather_worker_t*  workers   = calloc(num_threads, sizeof(gather_worker_t));
+   pthread_t*        threads   = calloc(num_threads, sizeof(pthread_t));
+   if (snapshots == NULL || workers == NULL || threads == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+
+   unsigned int  i;
+   for (i = 0; i < num_threads; i++) {
+      workers[i].index     = i;
+      workers[i].stride    = num_threads;
+      workers[i].num_cpus  = num_cpus;
+      workers[i].inst      = inst;
+      workers[i].snapshots = snapshots;
+
+      int  status = pthread_create(&threads[i], NULL,
+                                   gather_worker, &workers[i]);
+      if (status != 0) {
+         fprintf(stderr,
+                 "%s: unable to create worker thread %u; error = %d (%s)\n",
+                 program, i, status, strerror(status));
+         exit(1);
+      }
+   }
+   for (i = 0; i < num_threads; i++) {
+      pthread_join(threads[i], NULL);
+   }
+
+   unsigned int  cpu;
+   for (cpu = 0; cpu < num_cpus; cpu++) {
+      // Stop at the first absent CPU, just as the serial walk does when
+      // real_setup() fails.
+      if (!snapshots[cpu].present) break;
+      if (binary_dump.enabled) {
+         unsigned int  r;
+         binary_dump_start_cpu(cpu);
+         for (r = 0; r < snapshots[cpu].count; r++) {
+            const leaf_record_t*  record = &snapshots[cpu].records[r];
+            binary_dump_record(record->reg, record->try, record->words);
+         }
+      } else {
+         printf("CPU %u:\n", cpu);
+         replay_snapshot(&snapshots[cpu], raw, debug);
+         out_flush();
+      }
+      free(snapshots[cpu].records);
+   }
+
+   free(snapshots);
+   free(workers);
+   free(threads);
+}
+
+/*
+** --topology derives the host's package/core/thread map without full dumps:
+** each CPU is probed for just the topology leaves (0xb/0x1f on Intel, plus
+** 0x80000001/0x80000008/0x8000001e on AMD), in parallel, and the IDs are
+** carved out of the APIC ID using the same widths that print_apic_synth()
+** derives for the (APIC synth) line.  Where 0xb/0x1f are available, the full
+** 32-bit x2APIC ID from edx is used instead of the 8-bit initial APIC ID in
+** 1/ebx, so IDs stay correct beyond 256 logical CPUs.
+*/
+typedef struct {
+   boolean       present;
+   unsigned int  apic_id;
+   unsigned int  smt_id;
+   unsigned int  core_id;
+   unsigned int  cu_id;
+   boolean       have_cu;
+   unsigned int  pkg_id;
+} topo_record_t;
+
+static void
+topo_probe(int             cpuid_fd,
+           topo_record_t*  topo)
+{
+   code_stash_t  stash = NIL_STASH;
+   unsigned int  words[WORD_NUM];
+
+   real_get(cpuid_fd, 0, words, 0, FALSE);
+   unsigned int  max = words[WORD_EAX];
+   if (IS_VENDOR_ID(words, "GenuineIntel")) {
+      stash.vendor = VENDOR_INTEL;
+   } else if (IS_VENDOR_ID(words, "AuthenticAMD")
+              || IS_VENDOR_ID(words, "HygonGenuine")) {
+      // Hygon's topology leaves are AMD's.
+      stash.vendor = VENDOR_AMD;
+   }
+
+   real_get(cpuid_fd, 1, words, 0, FALSE);
+   stash.val_1_ebx = words[WORD_EBX];
+   stash.val_1_edx = words[WORD_EDX];
+
+   unsigned int  apic_id = BIT_EXTRACT_LE(stash.val_1_ebx, 24, 32);
+
+   if (stash.vendor == VENDOR_INTEL) {
+      unsigned int  try;
+      if (max >= 0x1f) {
+         for (try = 0; try < LENGTH(stash.val_1f_eax); try++) {
+            real_get(cpuid_fd, 0x1f, words, try, FALSE);
+            if (try > 0 && GET_V2_TOPO_LEVEL(words[WORD_ECX]) == 0) break;
+            stash.saw_1f = TRUE;
+            stash.val_1f_eax[try] = words[WORD_EAX];
+            stash.val_1f_ebx[try] = words[WORD_EBX];
+            stash.val_1f_ecx[try] = words[WORD_ECX];
+            apic_id = words[WORD_EDX];
+         }
+      }
+      if (!stash.saw_1f && max >= 0xb) {
+         for (try = 0; try < LENGTH(stash.val_b_eax); try++) {
+            real_get(cpuid_fd, 0xb, words, try, FALSE);
+            if (words[WORD_EAX] == 0 && words[WORD_EBX] == 0) break;
+            stash.saw_b = TRUE;
+            stash.val_b_eax[try] = words[WORD_EAX];
+            apic_id = words[WORD_EDX];
+         }
+      }
+      if (!stash.saw_1f && !stash.saw_b && max >= 4) {
+         real_get(cpuid_fd, 4, words, 0, FALSE);
+         stash.saw_4     = TRUE;
+         stash.val_4_eax = words[WORD_EAX];
+      }
+   } else if (stash.vendor == VENDOR_AMD) {
+      real_get(cpuid_fd, 0x80000000, words, 0, FALSE);
+      unsigned int  max_ext = words[WORD_EAX];
+      if (max_ext >= 0x80000001) {
+         real_get(cpuid_fd, 0x80000001, words, 0, FALSE);
+         stash.val_80000001_eax = words[WORD_EAX];
+      }
+      if (max_ext >= 0x80000008) {
+         real_get(cpuid_fd, 0x80000008, words, 0, FALSE);
+         stash.val_80000008_ecx = words[WORD_ECX];
+      }
+      if (max_ext >= 0x8000001e) {
+         real_get(cpuid_fd, 0x8000001e, words, 0, FALSE);
+         stash.val_8000001e_ebx = words[WORD_EBX];
+         apic_id = words[WORD_EAX];
+      }
+   }
+
+   unsigned int  smt_width  = 0;
+   unsigned int  core_width = 0;
+   unsigned int  cu_width   = 0;
+   // If the leaves describe no topology (single-threaded or pre-topology
+   // CPU), all widths stay 0 and the whole APIC ID is the package ID.
+   apic_synth_widths(&stash, &smt_width, &core_width, &cu_width);
+
+   unsigned int  smt_tail  = smt_width;
+   unsigned int  core_tail = smt_tail + core_width;
+   unsigned int  cu_tail   = core_tail + cu_width;
+
+   topo->apic_id = apic_id;
+   topo->smt_id  = BIT_EXTRACT_LE(apic_id, 0, smt_tail);
+   topo->core_id = BIT_EXTRACT_LE(apic_id, smt_tail, core_tail);
+   topo->cu_id   = BIT_EXTRACT_LE(apic_id, core_tail, cu_tail);
+   topo->have_cu = (cu_width != 0);
+   topo->pkg_id  = (cu_tail < 32 ? apic_id >> cu_tail : 0);
+}
+
+typedef struct {
+   unsigned int    index;
+   unsigned int    stride;
+   unsigned int    num_cpus;
+   boolean         inst;
+   topo_record_t*  topos;
+} topo_worker_t;
+
+static void*
+topo_worker(void*  arg)
+{
+   topo_worker_t*  worker = (topo_worker_t*)arg;
+   unsigned int    cpu;
+
+   for (cpu = worker->index; cpu < worker->num_cpus; cpu += worker->stride) {
+      topo_record_t*  topo     = &worker->topos[cpu];
+      int             cpuid_fd = real_setup(cpu, FALSE, worker->inst);
+      if (cpuid_fd == -1) continue;
+      topo_probe(cpuid_fd, topo);
+      topo->present = TRUE;
+      real_done(cpuid_fd);
+   }
+
+   return NULL;
+}
+
+static void
+do_real_topology(unsigned int  num_threads,
+                 boolean       inst)
+{
+   unsigned int  num_cpus = sysconf(_SC_NPROCESSORS_CONF);
+   if (num_cpus > MAX_CPUS) num_cpus = MAX_CPUS;
+   if (num_threads == 0 || num_threads > num_cpus) num_threads = num_cpus;
+
+   topo_record_t*  topos   = calloc(num_cpus,    sizeof(topo_record_t));
+   topo_worker_t*  workers = calloc(num_threads, sizeof(topo_worker_t));
+   pthread_t*      threads = calloc(num_threads, sizeof(pthread_t));
+   if (topos == NULL || workers == NULL || threads == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+
+   unsigned int  i;
+   for (i = 0; i < num_threads; i++) {
+      workers[i].index    = i;
+      workers[i].stride   = num_threads;
+      workers[i].num_cpus = num_cpus;
+      workers[i].inst     = inst;
+      workers[i].topos    = topos;
+
+      int  status = pthread_create(&threads[i], NULL,
+                                   topo_worker, &workers[i]);
+      if (status != 0) {
+         fprintf(stderr,
+                 "%s: unable to create worker thread %u; error = %d (%s)\n",
+                 program, i, status, strerror(status));
+         exit(1);
+      }
+   }
+   for (i = 0; i < num_threads; i++) {
+      pthread_join(threads[i], NULL);
+   }
+
+   boolean       have_cu = FALSE;
+   unsigned int  cpu;
+   for (cpu = 0; cpu < num_cpus; cpu++) {
+      if (topos[cpu].present && topos[cpu].have_cu) have_cu = TRUE;
+   }
+
+   printf("CPU   PKG_ID%s  CORE_ID  SMT_ID  APIC_ID\n",
+          have_cu ? "  CU_ID" : "");
+   unsigned int  threads_total = 0;
+   for (cpu = 0; cpu < num_cpus; cpu++) {
+      // Stop at the first absent CPU, just as the serial walk does when
+      // real_setup() fails.
+      if (!topos[cpu].present) break;
+      threads_total++;
+      printf("%3u   %6u", cpu, topos[cpu].pkg_id);
+      if (have_cu) {
+         printf("  %5u", topos[cpu].cu_id);
+      }
+      printf("  %7u  %6u  0x%05x\n",
+             topos[cpu].core_id, topos[cpu].smt_id, topos[cpu].apic_id);
+   }
+
+   /*
+   ** The consolidated counts: packages are distinct PKG_IDs, and cores are
+   ** distinct (PKG_ID, CU_ID, CORE_ID) triples.  Counted quadratically; even
+   ** at MAX_CPUS this is trivial next to the probing above.
+   */
+   unsigned int  packages = 0;
+   unsigned int  cores    = 0;
+   for (cpu = 0; cpu < threads_total; cpu++) {
+      unsigned int  prev;
+      for (prev = 0; prev < cpu; prev++) {
+         if (topos[prev].pkg_id == topos[cpu].pkg_id) break;
+      }
+      if (prev == cpu) packages++;
+      for (prev = 0; prev < cpu; prev++) {
+         if (topos[prev].pkg_id  == topos[cpu].pkg_id
+             && topos[prev].cu_id   == topos[cpu].cu_id
+             && topos[prev].core_id == topos[cpu].core_id) break;
+      }
+      if (prev == cpu) cores++;
+   }
+   printf("(topology synth): %u package%s, %u core%s, %u thread%s\n",
+          packages, (packages == 1 ? "" : "s"),
+          cores,    (cores    == 1 ? "" : "s"),
+          threads_total, (threads_total == 1 ? "" : "s"));
+   out_flush();
+
+   free(topos);
+   free(workers);
+   free(threads);
+}
+
+static void
+do_real_one(unsigned int  reg,
+            unsigned int  try,
+            boolean       one_cpu,
+            boolean       inst,
+            boolean       raw,
+            boolean       debug UNUSED)
+{
+   unsigned int  cpu;
+
+   for (cpu = 0;; cpu++) {
+      int            cpuid_fd   = -1;
+      code_stash_t   stash      = NIL_STASH;
+
+      if (one_cpu && cpu > 0) break;
+
+      cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      unsigned int  words[WORD_NUM];
+      real_get(cpuid_fd, reg, words, try, FALSE);
+
+      if (binary_dump.enabled) {
+         binary_dump_start_cpu(cpu);
+         binary_dump_record(reg, try, words);
+         continue;
+      }
+
+      if (inst && one_cpu) {
+         printf("CPU:\n");
+      } else {
+         printf("CPU %u:\n", cpu);
+      }
+
+      print_reg(reg, words, raw, try, &stash);
+      out_flush();
+   }
+}
+
+static void
+do_real(boolean  one_cpu,
+        boolean  inst,
+        boolean  raw,
+        boolean  debug)
+{
+   cpu_snapshot_t  snapshot = { NULL, 0, 0, FALSE };
+   unsigned int    cpu;
+
+   for (cpu = 0;; cpu++) {
+      int                 cpuid_fd    = -1;
+      unsigned long long  timing_mark = 0;
+
+      if (one_cpu && cpu > 0) break;
+
+      if (timing.enabled) {
+         timing_mark = timing_now();
+      }
+
+      cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      /* The slot is created only once the CPU is known to exist. */
+      if (timing.enabled) {
+         timing.current = timing_cpu(cpu);
+         timing_charge(&timing.current->setup, &timing_mark);
+      }
+
+      if (binary_dump.enabled) {
+         binary_dump_start_cpu(cpu);
+         walk_real_leaves(cpuid_fd, binary_dump_handler, NULL);
+         real_done(cpuid_fd);
+         timing.current = NULL;
+         continue;
+      }
+
+      /*
+      ** Gather first, decode & print afterward, as the parallel path does:
+      ** the walk stores every (leaf, subleaf) tuple into the snapshot and
+      ** releases the CPU before any decoding starts, so the time spent
+      ** migrated to each target CPU covers only the raw reads, and the
+      ** snapshot each CPU's output is decoded from is internally
+      ** consistent.  The snapshot buffer is reused across CPUs.
+      */
+      snapshot.count = 0;
+      walk_real_leaves(cpuid_fd, snapshot_handler, &snapshot);
+      real_done(cpuid_fd);
+
+      if (timing.current != NULL) {
+         timing_mark = timing_now();
+      }
+
+      if (inst && one_cpu) {
+         printf("CPU:\n");
+      } else {
+         printf("CPU %u:\n", cpu);
+      }
+      replay_snapshot(&snapshot, raw, debug);
+
+      if (timing.current != NULL) {
+         timing_charge(&timing.current->decode, &timing_mark);
+      }
+
+      out_flush();
+
+      if (timing.current != NULL) {
+         timing_charge(&timing.current->print, &timing_mark);
+         timing.current = NULL;
+      }
+   }
+
+   timing_report();
+
+   free(snapshot.records);
+}
+
+/*
+** --leaves support: fetch a caller-chosen subset of leaves per CPU without
+** paying for the full walk.  Each spec is LEAF, LEAF:SUBLEAF, or LEAF:all;
+** the last reuses walk_one_leaf()'s subleaf iteration rules.
+*/
+typedef struct {
+   unsigned int  reg;
+   unsigned int  try;
+   boolean       all;
+} leaf_spec_t;
+
+static leaf_spec_t*  leaf_specs          = NULL;
+static unsigned int  leaf_spec_count     = 0;
+static unsigned int  leaf_spec_allocated = 0;
+
+static void
+parse_leaf_specs(cstring  arg)
+{
+   cstring  p = arg;
+   while (*p != '\0') {
+      errno = 0;
+      char*          endptr = NULL;
+      unsigned long  reg    = strtoul(p, &endptr, 0);
+      if (errno != 0 || endptr == p) goto bad;
+      unsigned long  try  = 0;
+      boolean        all  = FALSE;
+      cstring        rest = endptr;
+      if (*rest == ':') {
+         p = rest + 1;
+         if (strncmp(p, "all", 3) == 0) {
+            all  = TRUE;
+            rest = p + 3;
+         } else {
+            errno = 0;
+            try = strtoul(p, &endptr, 0);
+            if (errno != 0 || endptr == p) goto bad;
+            rest = endptr;
+         }
+      }
+      if (*rest == ',') {
+         p = rest + 1;
+         if (*p == '\0') goto bad;
+      } else if (*rest == '\0') {
+         p = rest;
+      } else {
+         goto bad;
+      }
+
+      if (leaf_spec_count == leaf_spec_allocated) {
+         leaf_spec_allocated = (leaf_spec_allocated == 0
+                                ? 8 : leaf_spec_allocated * 2);
+         leaf_spec_t*  specs = realloc(leaf_specs,
+                                       leaf_spec_allocated
+                                       * sizeof(leaf_spec_t));
+         if (specs == NULL) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
+         }
+         leaf_specs = specs;
+      }
+      leaf_specs[leaf_spec_count].reg = reg;
+      leaf_specs[leaf_spec_count].try = try;
+      leaf_specs[leaf_spec_count].all = all;
+      leaf_spec_count++;
+   }
+   return;
+
+bad:
+   fprintf(stderr,
+           "%s: argument to --leaves not understood: %s\n",
+           program, arg);
+   exit(1);
+}
+
+static void
+do_real_leaves(boolean  one_cpu,
+               boolean  inst,
+               boolean  raw)
+{
+   unsigned int  cpu;
+
+   for (cpu = 0;; cpu++) {
+      int                cpuid_fd = -1;
+      code_stash_t       stash    = NIL_STASH;
+      print_leaf_data_t  pld;
+      unsigned int       i;
+
+      if (one_cpu && cpu > 0) break;
+
+      cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      if (binary_dump.enabled) {
+         binary_dump_start_cpu(cpu);
+      } else if (inst && one_cpu) {
+         printf("CPU:\n");
+      } else {
+         printf("CPU %u:\n", cpu);
+      }
+
+      pld.raw   = raw;
+      pld.stash = &stash;
+
+      for (i = 0; i < leaf_spec_count; i++) {
+         const leaf_spec_t*  spec = &leaf_specs[i];
+         unsigned int        words[WORD_NUM];
+
+         if (spec->all) {
+            real_get(cpuid_fd, spec->reg, words, 0, FALSE);
+            if (binary_dump.enabled) {
+               walk_one_leaf(cpuid_fd, spec->reg, words, HYPERVISOR_UNKNOWN,
+                             binary_dump_handler, NULL);
+            } else {
+               walk_one_leaf(cpuid_fd, spec->reg, words, HYPERVISOR_UNKNOWN,
+                             print_leaf_handler, &pld);
             }
-         } else if (reg == 0x10) {
-            unsigned int  mask = words[WORD_EBX];
-            print_header(reg, 0, raw);
-            print_reg(reg, words, raw, 0, &stash);
-            unsigned int  try;
-            for (try = 1; try < 32; try++) {
-               if (mask & (1 << try)) {
-                  real_get(cpuid_fd, reg, words, try, FALSE);
-                  print_reg(reg, words, raw, try, &stash);
-               }
+         } else {
+            real_get(cpuid_fd, spec->reg, words, spec->try, FALSE);
+            if (binary_dump.enabled) {
+               binary_dump_record(spec->reg, spec->try, words);
+            } else {
+               print_header(spec->reg, spec->try, raw);
+               print_reg(spec->reg, words, raw, spec->try, &stash);
             }
-         } else if (reg == 0x12) {
-            unsigned int  mask = words[WORD_EAX];
-            print_header(reg, 0, raw);
-            print_reg(reg, words, raw, 0, &stash);
-            unsigned int  try;
-            for (try = 1; try < 33; try++) {
-               if (mask & (1 << (try-1))) {
-                  real_get(cpuid_fd, reg, words, try, FALSE);
-                  print_reg(reg, words, raw, try, &stash);
-               }
+         }
+      }
+
+      if (!binary_dump.enabled) out_flush();
+      real_done(cpuid_fd);
+   }
+}
+
+/*
+** --dedup support: on homogeneous machines, every CPU returns the same
+** data except for the APIC & topology leaves.  One CPU per distinct
+** signature is enumerated & printed in full; the rest are probed with
+** just the signature leaves and reported as compact
+** "CPU A..B: same as CPU R" runs, each carrying the probed APIC ids so
+** the per-CPU topology information is not lost to the deduplication.
+**
+** The signature is leaves 0 & 1 plus the topology leaves 0xb & 0x1f,
+** and on hybrid parts (leaf 7 edx bit 15) the leaf 0x1a core type, so
+** that P- & E-cores -- which report identical family/model/stepping in
+** leaf 1 -- are enumerated separately.  The per-CPU identifiers (the
+** initial APIC id byte in leaf 1 ebx, and the x2APIC id in leaf 0xb &
+** 0x1f edx) are excluded from the comparison and reported instead.
+*/
+#define DEDUP_TOPO_LEVELS  8
+
+typedef struct {
+   unsigned int  leaf0[WORD_NUM];
+   unsigned int  leaf1[WORD_NUM];         /* initial APIC id byte masked */
+   unsigned int  core_type;               /* leaf 0x1a eax; 0 if not hybrid */
+   unsigned int  topo_b[DEDUP_TOPO_LEVELS][WORD_NUM];    /* edx masked */
+   unsigned int  topo_1f[DEDUP_TOPO_LEVELS][WORD_NUM];   /* edx masked */
+} dedup_sig_t;
+
+typedef struct {
+   unsigned int  cpu;
+   dedup_sig_t   sig;
+} dedup_ref_t;
+
+static void
+dedup_probe(int            cpuid_fd,
+            dedup_sig_t*   sig,
+            unsigned int*  apic_id)
+{
+   unsigned int  words[WORD_NUM];
+   unsigned int  level;
+
+   bzero(sig, sizeof(*sig));
+
+   real_get(cpuid_fd, 0, sig->leaf0, 0, FALSE);
+   real_get(cpuid_fd, 1, sig->leaf1, 0, FALSE);
+   *apic_id = sig->leaf1[WORD_EBX] >> 24;
+   sig->leaf1[WORD_EBX] &= 0x00ffffff;
+
+   unsigned int  max = sig->leaf0[WORD_EAX];
+
+   if (max >= 0x1a) {
+      real_get(cpuid_fd, 7, words, 0, FALSE);
+      if (BIT_EXTRACT_LE(words[WORD_EDX], 15, 16)) {
+         real_get(cpuid_fd, 0x1a, words, 0, FALSE);
+         sig->core_type = words[WORD_EAX];
+      }
+   }
+
+   if (max >= 0xb) {
+      for (level = 0; level < DEDUP_TOPO_LEVELS; level++) {
+         real_get(cpuid_fd, 0xb, words, level, FALSE);
+         *apic_id = words[WORD_EDX];   /* x2APIC id, same at every level */
+         words[WORD_EDX] = 0;
+         memcpy(sig->topo_b[level], words, sizeof(words));
+         if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
+      }
+   }
+   if (max >= 0x1f) {
+      for (level = 0; level < DEDUP_TOPO_LEVELS; level++) {
+         real_get(cpuid_fd, 0x1f, words, level, FALSE);
+         *apic_id = words[WORD_EDX];
+         words[WORD_EDX] = 0;
+         memcpy(sig->topo_1f[level], words, sizeof(words));
+         if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
+      }
+   }
+}
+
+static void
+print_same_run(unsigned int         start,
+               unsigned int         end,
+               unsigned int         ref,
+               const unsigned int*  apic_ids)
+{
+   unsigned int  i;
+
+   if (start == end) {
+      printf("CPU %u: same as CPU %u (apic id", start, ref);
+   } else {
+      printf("CPU %u..%u: same as CPU %u (apic ids", start, end, ref);
+   }
+   for (i = 0; i <= end - start; i++) {
+      printf(" 0x%x", apic_ids[i]);
+   }
+   printf(")\n");
+   out_flush();
+}
+
+static void
+do_real_dedup(boolean  inst,
+              boolean  raw,
+              boolean  debug)
+{
+   dedup_ref_t*   refs           = NULL;
+   unsigned int   ref_count      = 0;
+   unsigned int   ref_alloc      = 0;
+   unsigned int   run_start      = 0;
+   unsigned int   run_end        = 0;
+   unsigned int   run_ref        = 0;
+   boolean        in_run         = FALSE;
+   unsigned int*  run_apics      = NULL;
+   unsigned int   run_apic_alloc = 0;
+   unsigned int   cpu;
+
+   for (cpu = 0;; cpu++) {
+      int           cpuid_fd = real_setup(cpu, FALSE, inst);
+      dedup_sig_t   sig;
+      unsigned int  apic_id;
+      unsigned int  r;
+
+      if (cpuid_fd == -1) break;
+
+      dedup_probe(cpuid_fd, &sig, &apic_id);
+
+      for (r = 0; r < ref_count; r++) {
+         if (memcmp(&sig, &refs[r].sig, sizeof(sig)) == 0) {
+            break;
+         }
+      }
+
+      if (r < ref_count) {
+         if (in_run && run_ref == refs[r].cpu) {
+            run_end = cpu;
+         } else {
+            if (in_run) print_same_run(run_start, run_end, run_ref,
+                                       run_apics);
+            run_start = cpu;
+            run_end   = cpu;
+            run_ref   = refs[r].cpu;
+            in_run    = TRUE;
+         }
+         unsigned int  run_length = cpu - run_start + 1;
+         if (run_length > run_apic_alloc) {
+            run_apic_alloc = (run_apic_alloc == 0 ? 16 : run_apic_alloc * 2);
+            unsigned int*  new_apics
+               = realloc(run_apics, run_apic_alloc * sizeof(unsigned int));
+            if (new_apics == NULL) {
+               fprintf(stderr, "%s: out of memory\n", program);
+               exit(1);
             }
-         } else if (reg == 0x14) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
+            run_apics = new_apics;
+         }
+         run_apics[run_length - 1] = apic_id;
+      } else {
+         if (in_run) {
+            print_same_run(run_start, run_end, run_ref, run_apics);
+            in_run = FALSE;
+         }
+
+         code_stash_t       stash = NIL_STASH;
+         print_leaf_data_t  pld;
+
+         printf("CPU %u:\n", cpu);
+         pld.raw   = raw;
+         pld.stash = &stash;
+         walk_real_leaves(cpuid_fd, print_leaf_handler, &pld);
+         do_final(raw, debug, &stash);
+         out_flush();
+
+         if (ref_count == ref_alloc) {
+            ref_alloc = (ref_alloc == 0 ? 4 : ref_alloc * 2);
+            dedup_ref_t*  new_refs = realloc(refs,
+                                             ref_alloc * sizeof(dedup_ref_t));
+            if (new_refs == NULL) {
+               fprintf(stderr, "%s: out of memory\n", program);
+               exit(1);
             }
-         } else if (reg == 0x17) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
+            refs = new_refs;
+         }
+         refs[ref_count].cpu = cpu;
+         refs[ref_count].sig = sig;
+         ref_count++;
+      }
+
+      real_done(cpuid_fd);
+   }
+
+   if (in_run) print_same_run(run_start, run_end, run_ref, run_apics);
+
+   free(run_apics);
+   free(refs);
+}
+
+static void
+do_file_binary_mem(ccstring     filename,
+                   const void*  base,
+                   size_t       size,
+                   boolean      raw,
+                   boolean      debug)
+{
+   if (size < sizeof(binary_dump_header_t)) {
+      fprintf(stderr, "%s: binary dump %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   const binary_dump_header_t*  header = (const binary_dump_header_t*)base;
+   if (header->version != BINARY_DUMP_VERSION) {
+      fprintf(stderr,
+              "%s: binary dump %s has unsupported version %u\n",
+              program, filename, header->version);
+      exit(1);
+   }
+   if (sizeof(binary_dump_header_t)
+       + (size_t)header->record_count * sizeof(binary_dump_record_t) > size) {
+      fprintf(stderr, "%s: binary dump %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   const binary_dump_record_t*  records
+      = (const binary_dump_record_t*)((const char*)base
+                                      + sizeof(binary_dump_header_t));
+
+   boolean       seen_cpu = FALSE;
+   unsigned int  last_cpu = 0;
+   code_stash_t  stash    = NIL_STASH;
+   unsigned int  i;
+
+   for (i = 0; i < header->record_count; i++) {
+      const binary_dump_record_t*  record = &records[i];
+
+      if (!seen_cpu || record->cpu != last_cpu) {
+         if (seen_cpu && !binary_dump.enabled) {
+            do_final(raw, debug, &stash);
+            out_flush();
+         }
+         seen_cpu = TRUE;
+         last_cpu = record->cpu;
+         if (binary_dump.enabled) {
+            binary_dump_start_cpu(record->cpu);
+         } else {
+            static code_stash_t  empty_stash = NIL_STASH;
+            stash = empty_stash;
+            printf("CPU %u:\n", record->cpu);
+         }
+      }
+
+      if (binary_dump.enabled) {
+         binary_dump_record(record->reg, record->try, record->words);
+      } else {
+         print_header(record->reg, record->try, raw);
+         print_reg(record->reg, record->words, raw, record->try, &stash);
+      }
+   }
+
+   if (seen_cpu && !binary_dump.enabled) {
+      do_final(raw, debug, &stash);
+   }
+}
+
+static void
+do_file_binary(ccstring  filename,
+               int       fd,
+               boolean   raw,
+               boolean   debug)
+{
+   struct stat  st;
+   if (fstat(fd, &st) == -1) {
+      fprintf(stderr,
+              "%s: unable to stat %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+   size_t  size = st.st_size;
+
+   void*  base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (base == MAP_FAILED) {
+      fprintf(stderr,
+              "%s: unable to mmap %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+
+   do_file_binary_mem(filename, base, size, raw, debug);
+
+   munmap(base, size);
+}
+
+/*
+** Transparent decompression for -f inputs.  Compressed dumps are detected
+** by their magic bytes and piped through the matching external
+** decompressor, with the whole decompressed stream buffered in memory; no
+** temporary file is involved.  The external tools are used rather than
+** linking zlib/libzstd so that cpuid keeps building with no library
+** dependencies.
+*/
+static cstring
+dump_decompressor(const char*  magic)
+{
+   if (memcmp(magic, "\x1f\x8b",         2) == 0) return "gzip";
+   if (memcmp(magic, "\x28\xb5\x2f\xfd", 4) == 0) return "zstd";
+   return NULL;
+}
+
+static char*
+slurp_decompressed(ccstring  filename,
+                   int       fd,
+                   ccstring  decompressor,
+                   size_t*   size)
+{
+   int  pipe_fds[2];
+   if (pipe(pipe_fds) == -1) {
+      fprintf(stderr,
+              "%s: unable to create a pipe; errno = %d (%s)\n",
+              program, errno, strerror(errno));
+      exit(1);
+   }
+
+   lseek(fd, 0, SEEK_SET);
+
+   pid_t  child = fork();
+   if (child == -1) {
+      fprintf(stderr,
+              "%s: unable to fork; errno = %d (%s)\n",
+              program, errno, strerror(errno));
+      exit(1);
+   }
+   if (child == 0) {
+      dup2(fd, STDIN_FILENO);
+      dup2(pipe_fds[1], STDOUT_FILENO);
+      close(pipe_fds[0]);
+      close(pipe_fds[1]);
+      execlp(decompressor, decompressor, "-dc", (char*)NULL);
+      fprintf(stderr,
+              "%s: unable to run %s to decompress %s; errno = %d (%s)\n",
+              program, decompressor, filename, errno, strerror(errno));
+      _exit(1);
+   }
+   close(pipe_fds[1]);
+
+   size_t  allocated = 64 * 1024;
+   size_t  length    = 0;
+   char*   buffer    = malloc(allocated);
+   if (buffer == NULL) {
+      fprintf(stderr, "%s: out of memory\n", program);
+      exit(1);
+   }
+   for (;;) {
+      if (length == allocated) {
+         allocated *= 2;
+         char*  new_buffer = realloc(buffer, allocated);
+         if (new_buffer == NULL) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
+         }
+         buffer = new_buffer;
+      }
+      ssize_t  got = read(pipe_fds[0], buffer + length, allocated - length);
+      if (got == -1) {
+         if (errno == EINTR) continue;
+         fprintf(stderr,
+                 "%s: unable to read decompressed data from %s;"
+                 " errno = %d (%s)\n",
+                 program, filename, errno, strerror(errno));
+         exit(1);
+      }
+      if (got == 0) break;
+      length += got;
+   }
+   close(pipe_fds[0]);
+
+   int  child_status;
+   waitpid(child, &child_status, 0);
+   if (!WIFEXITED(child_status) || WEXITSTATUS(child_status) != 0
+       || length == 0) {
+      fprintf(stderr,
+              "%s: %s was unable to decompress %s\n",
+              program, decompressor, filename);
+      exit(1);
+   }
+
+   *size = length;
+   return buffer;
+}
+
+/*
+** /proc/cpuinfo input (--cpuinfo, or autodetected in do_file()).  This is
+** the bundled cpuinfo2cpuid perl script reimplemented in-process: the
+** vendor_id, cpu family, model & stepping fields are collected (as in the
+** script, the last processor block wins) and synthesized into just leaf 0
+** and leaf 1, which is enough for the synth lines.  The leaf 0 registers
+** are emitted only for the vendors the script knows (Intel & AMD).
+*/
+static boolean  cpuinfo_input = FALSE;
+
+static void
+do_file_cpuinfo(FILE*     file,
+                ccstring  filename,
+                cstring   first_line,
+                boolean   raw,
+                boolean   debug)
+{
+   char          vendor[12+1+1] = "";
+   unsigned int  family         = 0;
+   unsigned int  model          = 0;
+   unsigned int  stepping       = 0;
+
+   char     buffer[120];
+   cstring  ptr = first_line;
+   for (;;) {
+      if (ptr != NULL) {
+         sscanf(ptr, "vendor_id : %13s", vendor);
+         sscanf(ptr, "cpu family : %u", &family);
+         /* " " never matches the space in "model name", so this is safe */
+         sscanf(ptr, "model : %u", &model);
+         sscanf(ptr, "stepping : %u", &stepping);
+      }
+      ptr = fgets(buffer, LENGTH(buffer), file);
+      if (ptr == NULL) {
+         if (errno != 0 && !feof(file)) {
+            fprintf(stderr,
+                    "%s: unable to read a line of text from %s;"
+                    " errno = %d (%s)\n",
+                    program, filename, errno, strerror(errno));
+            exit(1);
+         }
+         break;
+      }
+   }
+
+   unsigned int  xfamily = family / 16;
+   unsigned int  xmodel  = model  / 16;
+   family %= 16;
+   model  %= 16;
+   unsigned int  eax = (((xfamily  & 0xff) << 20)
+                        | ((xmodel   & 0xf) << 16)
+                        | ((family   & 0xf) <<  8)
+                        | ((model    & 0xf) <<  4)
+                        | ((stepping & 0xf) <<  0));
+
+   code_stash_t  stash = NIL_STASH;
+   if (binary_dump.enabled) {
+      binary_dump_start_cpu(binary_dump.cpu_count);
+   } else {
+      printf("CPU:\n");
+   }
+
+   boolean       intel = (strcmp(vendor, "GenuineIntel") == 0);
+   boolean       amd   = (strcmp(vendor, "AuthenticAMD") == 0);
+   unsigned int  words[WORD_NUM];
+   if (intel || amd) {
+      words[WORD_EAX] = 1;
+      memcpy(&words[WORD_EBX], &vendor[0], 4);
+      memcpy(&words[WORD_EDX], &vendor[4], 4);
+      memcpy(&words[WORD_ECX], &vendor[8], 4);
+      if (binary_dump.enabled) {
+         binary_dump_record(0, 0, words);
+      } else {
+         print_reg(0, words, raw, 0, &stash);
+      }
+   }
+
+   words[WORD_EAX] = eax;
+   words[WORD_EBX] = 0;
+   words[WORD_ECX] = 0;
+   words[WORD_EDX] = 0;
+   if (binary_dump.enabled) {
+      binary_dump_record(1, 0, words);
+   } else {
+      print_reg(1, words, raw, 0, &stash);
+      do_final(raw, debug, &stash);
+   }
+}
+
+static void
+do_file(ccstring  filename,
+        boolean   raw,
+        boolean   debug)
+{
+   boolean       seen_cpu    = FALSE;
+   boolean       seen_leaf   = FALSE;
+   unsigned int  cpu         = -1;
+   /*
+   ** legacy_tries reconstructs try (a.k.a. ecx) values for cpuid's old-style
+   ** method of dumping raw leaves, which lacked an explicit indication of
+   ** the try number: leaves flagged legacy_seq in the descriptor registry
+   ** appear as consecutive repeated lines and are numbered sequentially.
+   ** More modern ecx-dependent leaves never appeared in such dumps and need
+   ** no entry here.
+   */
+   unsigned int  legacy_tries[LENGTH(leaf_descriptors)] = { 0 };
+   code_stash_t  stash       = NIL_STASH;
+
+   FILE*   file;
+   char*   decompressed      = NULL;
+   size_t  decompressed_size = 0;
+   if (strcmp(filename, "-") == 0) {
+      file = stdin;
+   } else {
+      int  fd = open(filename, O_RDONLY);
+      if (fd == -1) {
+         fprintf(stderr,
+                 "%s: unable to open %s; errno = %d (%s)\n",
+                 program, filename, errno, strerror(errno));
+         exit(1);
+      }
+
+      char     magic[8];
+      ssize_t  magic_size = read(fd, magic, sizeof(magic));
+      if (magic_size == (ssize_t)sizeof(magic)
+          && memcmp(magic, BINARY_DUMP_MAGIC, sizeof(magic)) == 0) {
+         do_file_binary(filename, fd, raw, debug);
+         close(fd);
+         return;
+      }
+
+      ccstring  decompressor = (magic_size >= 4 ? dump_decompressor(magic)
+                                                : NULL);
+      if (decompressor != NULL) {
+         decompressed = slurp_decompressed(filename, fd, decompressor,
+                                           &decompressed_size);
+         close(fd);
+         if (decompressed_size >= sizeof(magic)
+             && memcmp(decompressed, BINARY_DUMP_MAGIC,
+                       sizeof(magic)) == 0) {
+            do_file_binary_mem(filename, decompressed, decompressed_size,
+                               raw, debug);
+            free(decompressed);
+            return;
+         }
+         file = fmemopen(decompressed, decompressed_size, "r");
+      } else {
+         lseek(fd, 0, SEEK_SET);
+         file = fdopen(fd, "r");
+      }
+      if (file == NULL) {
+         fprintf(stderr,
+                 "%s: unable to open %s; errno = %d (%s)\n",
+                 program, filename, errno, strerror(errno));
+         exit(1);
+      }
+   }
+
+   if (cpuinfo_input) {
+      do_file_cpuinfo(file, filename, NULL, raw, debug);
+      if (file != stdin) fclose(file);
+      free(decompressed);
+      return;
+   }
+
+   while (!feof(file)) {
+      char          buffer[88];
+      char*         ptr;
+      int           status;
+      unsigned int  reg;
+      unsigned int  try;
+      unsigned int  words[WORD_NUM];
+
+      ptr = fgets(buffer, LENGTH(buffer), file);
+      if (ptr == NULL && errno == 0) break;
+      if (ptr == NULL) {
+         if (errno != EPIPE) {
+            fprintf(stderr,
+                    "%s: unable to read a line of text from %s;"
+                    " errno = %d (%s)\n",
+                    program, filename, errno, strerror(errno));
+         }
+         exit(1);
+      }
+
+      status = sscanf(ptr, "CPU %u:\r", &cpu);
+      if (status == 1 || strcmp(ptr, "CPU:\n") == SAME) {
+         if (seen_cpu && !binary_dump.enabled) {
+            do_final(raw, debug, &stash);
+            out_flush();
+         }
+
+         seen_cpu = TRUE;
+
+         if (binary_dump.enabled) {
+            binary_dump_start_cpu(status == 1 ? cpu : binary_dump.cpu_count);
+         } else if (status == 1) {
+            printf("CPU %u:\n", cpu);
+         } else {
+            printf("CPU:\n");
+         }
+         memset(legacy_tries, 0, sizeof(legacy_tries));
+         {
+            static code_stash_t  empty_stash = NIL_STASH;
+            stash = empty_stash;
+         }
+         continue;
+      }
+
+      status = sscanf(ptr,
+                      "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
+                      &reg, &try,
+                      &words[WORD_EAX], &words[WORD_EBX],
+                      &words[WORD_ECX], &words[WORD_EDX]);
+      if (status == 6) {
+         seen_leaf = TRUE;
+         if (binary_dump.enabled) {
+            binary_dump_record(reg, try, words);
+         } else {
+            print_header(reg, try, raw);
+            print_reg(reg, words, raw, try, &stash);
+         }
+         continue;
+      }
+      status = sscanf(ptr,
+                      "   0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
+                      &reg, 
+                      &words[WORD_EAX], &words[WORD_EBX],
+                      &words[WORD_ECX], &words[WORD_EDX]);
+      if (status == 5) {
+         seen_leaf = TRUE;
+         const leaf_descriptor_t*  desc       = leaf_descriptor(reg);
+         boolean                   legacy_seq = (desc != NULL
+                                                 && desc->legacy_seq);
+         if (legacy_seq) {
+            try = legacy_tries[desc - leaf_descriptors]++;
+         } else {
+            try = 0;
+         }
+         if (binary_dump.enabled) {
+            binary_dump_record(reg, try, words);
+         } else {
+            if (legacy_seq) {
                print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
             }
-         } else if (reg == 0x18) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
+            print_reg(reg, words, raw, try, &stash);
+         }
+         continue;
+      }
+
+      if (!seen_cpu && !seen_leaf
+          && (strncmp(ptr, "processor", 9) == 0
+              || strncmp(ptr, "vendor_id", 9) == 0)) {
+         /* This is /proc/cpuinfo content, not a dump. */
+         do_file_cpuinfo(file, filename, ptr, raw, debug);
+         if (file != stdin) fclose(file);
+         free(decompressed);
+         return;
+      }
+
+      fprintf(stderr,
+              "%s: unexpected input with -f option: %s\n",
+              program, ptr);
+      exit(1);
+   }
+
+   if (seen_cpu && !binary_dump.enabled) {
+      do_final(raw, debug, &stash);
+   }
+
+   if (file != stdin) {
+      fclose(file);
+   }
+   free(decompressed);
+}
+
+/*
+** --diff=BASELINE loads a prior dump (either the --raw-binary format or the
+** -r text format), performs the normal walk of each live CPU, and prints
+** only the (leaf, subleaf) tuples whose registers differ from the baseline,
+** plus a one-line per-CPU summary.  Lines are prefixed "-" (baseline value)
+** and "+" (current value); tuples absent from one side appear with only one
+** of the two.
+*/
+typedef struct {
+   cpu_snapshot_t*  snapshots;   /* indexed by CPU number */
+   unsigned int     count;
+} baseline_t;
+
+static cpu_snapshot_t*
+baseline_cpu(baseline_t*   baseline,
+             unsigned int  cpu)
+{
+   if (cpu >= baseline->count) {
+      cpu_snapshot_t*  snapshots = realloc(baseline->snapshots,
+                                           (cpu+1) * sizeof(cpu_snapshot_t));
+      if (snapshots == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      memset(&snapshots[baseline->count], 0,
+             (cpu+1 - baseline->count) * sizeof(cpu_snapshot_t));
+      baseline->snapshots = snapshots;
+      baseline->count     = cpu+1;
+   }
+   return &baseline->snapshots[cpu];
+}
+
+static void
+load_baseline_binary(ccstring     filename,
+                     int          fd,
+                     baseline_t*  baseline)
+{
+   struct stat  st;
+   if (fstat(fd, &st) == -1) {
+      fprintf(stderr,
+              "%s: unable to stat %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+   size_t  size = st.st_size;
+   if (size < sizeof(binary_dump_header_t)) {
+      fprintf(stderr, "%s: binary dump %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   void*  base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (base == MAP_FAILED) {
+      fprintf(stderr,
+              "%s: unable to mmap %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+
+   const binary_dump_header_t*  header = (const binary_dump_header_t*)base;
+   if (header->version != BINARY_DUMP_VERSION) {
+      fprintf(stderr,
+              "%s: binary dump %s has unsupported version %u\n",
+              program, filename, header->version);
+      exit(1);
+   }
+   if (sizeof(binary_dump_header_t)
+       + (size_t)header->record_count * sizeof(binary_dump_record_t) > size) {
+      fprintf(stderr, "%s: binary dump %s is truncated\n", program, filename);
+      exit(1);
+   }
+
+   const binary_dump_record_t*  records
+      = (const binary_dump_record_t*)((const char*)base
+                                      + sizeof(binary_dump_header_t));
+
+   unsigned int  i;
+   for (i = 0; i < header->record_count; i++) {
+      cpu_snapshot_t*  snapshot = baseline_cpu(baseline, records[i].cpu);
+      snapshot->present = TRUE;
+      snapshot_handler(records[i].reg, records[i].try, records[i].words,
+                       snapshot);
+   }
+
+   munmap(base, size);
+}
+
+static void
+load_baseline(ccstring     filename,
+              baseline_t*  baseline)
+{
+   int  fd = open(filename, O_RDONLY);
+   if (fd == -1) {
+      fprintf(stderr,
+              "%s: unable to open %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+
+   char  magic[8];
+   if (read(fd, magic, sizeof(magic)) == (ssize_t)sizeof(magic)
+       && memcmp(magic, BINARY_DUMP_MAGIC, sizeof(magic)) == 0) {
+      load_baseline_binary(filename, fd, baseline);
+      close(fd);
+      return;
+   }
+
+   lseek(fd, 0, SEEK_SET);
+   FILE*  file = fdopen(fd, "r");
+   if (file == NULL) {
+      fprintf(stderr,
+              "%s: unable to open %s; errno = %d (%s)\n",
+              program, filename, errno, strerror(errno));
+      exit(1);
+   }
+
+   cpu_snapshot_t*  snapshot = NULL;
+   unsigned int     next_cpu = 0;
+
+   while (!feof(file)) {
+      char          buffer[88];
+      char*         ptr;
+      int           status;
+      unsigned int  cpu;
+      unsigned int  reg;
+      unsigned int  try;
+      unsigned int  words[WORD_NUM];
+
+      ptr = fgets(buffer, LENGTH(buffer), file);
+      if (ptr == NULL && errno == 0) break;
+      if (ptr == NULL) {
+         fprintf(stderr,
+                 "%s: unable to read a line of text from %s;"
+                 " errno = %d (%s)\n",
+                 program, filename, errno, strerror(errno));
+         exit(1);
+      }
+
+      status = sscanf(ptr, "CPU %u:\r", &cpu);
+      if (status == 1 || strcmp(ptr, "CPU:\n") == SAME) {
+         if (status != 1) cpu = next_cpu;
+         snapshot = baseline_cpu(baseline, cpu);
+         snapshot->present = TRUE;
+         next_cpu = cpu + 1;
+         continue;
+      }
+
+      status = sscanf(ptr,
+                      "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
+                      &reg, &try,
+                      &words[WORD_EAX], &words[WORD_EBX],
+                      &words[WORD_ECX], &words[WORD_EDX]);
+      if (status == 6) {
+         if (snapshot == NULL) {
+            snapshot = baseline_cpu(baseline, 0);
+            snapshot->present = TRUE;
+            next_cpu = 1;
+         }
+         snapshot_handler(reg, try, words, snapshot);
+         continue;
+      }
+
+      fprintf(stderr,
+              "%s: unexpected input with --diff option: %s\n",
+              program, ptr);
+      exit(1);
+   }
+
+   fclose(file);
+}
+
+typedef struct {
+   const cpu_snapshot_t*  baseline;   /* NULL if CPU absent from baseline */
+   boolean*               matched;    /* per baseline record */
+   unsigned int           cursor;
+   unsigned int           unchanged;
+   unsigned int           changed;
+   unsigned int           added;
+} diff_data_t;
+
+static void
+print_diff_line(char                tag,
+                unsigned int        reg,
+                unsigned int        try,
+                const unsigned int  words[WORD_NUM])
+{
+   printf(" %c 0x%08x 0x%02x: eax=0x%08x ebx=0x%08x ecx=0x%08x edx=0x%08x\n",
+          tag, reg, try,
+          words[WORD_EAX], words[WORD_EBX],
+          words[WORD_ECX], words[WORD_EDX]);
+}
+
+/*
+** Baseline records are stored in walk order, so a live walk nearly always
+** matches the record right at the cursor; the wrap-around scan only runs
+** when leaves appeared or vanished.
+*/
+static const leaf_record_t*
+diff_find(diff_data_t*  diff,
+          unsigned int  reg,
+          unsigned int  try)
+{
+   const cpu_snapshot_t*  baseline = diff->baseline;
+   if (baseline == NULL) return NULL;
+
+   unsigned int  i;
+   for (i = diff->cursor; i < baseline->count; i++) {
+      if (!diff->matched[i]
+          && baseline->records[i].reg == reg
+          && baseline->records[i].try == try) {
+         diff->matched[i] = TRUE;
+         diff->cursor     = i + 1;
+         return &baseline->records[i];
+      }
+   }
+   for (i = 0; i < diff->cursor && i < baseline->count; i++) {
+      if (!diff->matched[i]
+          && baseline->records[i].reg == reg
+          && baseline->records[i].try == try) {
+         diff->matched[i] = TRUE;
+         return &baseline->records[i];
+      }
+   }
+   return NULL;
+}
+
+static void
+diff_handler(unsigned int        reg,
+             unsigned int        try,
+             const unsigned int  words[WORD_NUM],
+             void*               data)
+{
+   diff_data_t*          diff   = (diff_data_t*)data;
+   const leaf_record_t*  record = diff_find(diff, reg, try);
+
+   if (record == NULL) {
+      print_diff_line('+', reg, try, words);
+      diff->added++;
+   } else if (memcmp(record->words, words, sizeof(record->words)) != SAME) {
+      print_diff_line('-', reg, try, record->words);
+      print_diff_line('+', reg, try, words);
+      diff->changed++;
+   } else {
+      diff->unchanged++;
+   }
+}
+
+static void
+do_real_diff(ccstring  filename,
+             boolean   one_cpu,
+             boolean   inst)
+{
+   baseline_t  baseline = { NULL, 0 };
+   load_baseline(filename, &baseline);
+
+   unsigned int  cpu;
+   for (cpu = 0;; cpu++) {
+      if (one_cpu && cpu > 0) break;
+
+      int  cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      diff_data_t  diff = { NULL, NULL, 0, 0, 0, 0 };
+      if (cpu < baseline.count && baseline.snapshots[cpu].present) {
+         diff.baseline = &baseline.snapshots[cpu];
+         diff.matched  = calloc(diff.baseline->count, sizeof(boolean));
+         if (diff.matched == NULL) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
+         }
+      }
+
+      printf("CPU %u:\n", cpu);
+      walk_real_leaves(cpuid_fd, diff_handler, &diff);
+
+      unsigned int  removed = 0;
+      if (diff.baseline != NULL) {
+         unsigned int  i;
+         for (i = 0; i < diff.baseline->count; i++) {
+            if (!diff.matched[i]) {
+               print_diff_line('-', diff.baseline->records[i].reg,
+                               diff.baseline->records[i].try,
+                               diff.baseline->records[i].words);
+               removed++;
             }
-         } else if (reg == 0x1d) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
+         }
+      }
+      printf("   (diff summary): %u leaves unchanged, %u changed,"
+             " %u added, %u removed\n",
+             diff.unchanged, diff.changed, diff.added, removed);
+      out_flush();
+
+      free(diff.matched);
+      real_done(cpuid_fd);
+   }
+
+   for (; cpu < baseline.count; cpu++) {
+      if (baseline.snapshots[cpu].present) {
+         printf("CPU %u:\n", cpu);
+         printf("   (diff summary): CPU absent; %u leaves removed\n",
+                baseline.snapshots[cpu].count);
+      }
+   }
+   out_flush();
+
+   for (cpu = 0; cpu < baseline.count; cpu++) {
+      free(baseline.snapshots[cpu].records);
+   }
+   free(baseline.snapshots);
+}
+
+/*
+** --watch[=SECONDS] monitors the leaves whose registers legitimately change
+** at runtime.  One full gather per CPU establishes the baseline (and the
+** watched tuples' starting values are printed), then each tick re-reads
+** only the watched tuples -- a handful of real_get() calls instead of a
+** full walk -- and prints diff-style -/+ line pairs for registers that
+** changed since the previous tick.  The default watched set is the
+** thermal & power leaf (6), the frequency leaves (0x15, 0x16), and the
+** hypervisor 0x40000000 range; --leaves, when given alongside --watch,
+** replaces that set.  Runs until killed.
+*/
+static boolean
+watch_volatile(unsigned int  reg,
+               unsigned int  try)
+{
+   if (leaf_spec_count > 0) {
+      unsigned int  s;
+      for (s = 0; s < leaf_spec_count; s++) {
+         if (leaf_specs[s].reg == reg
+             && (leaf_specs[s].all || leaf_specs[s].try == try)) {
+            return TRUE;
+         }
+      }
+      return FALSE;
+   }
+
+   return (reg == 0x6 || reg == 0x15 || reg == 0x16
+           || (reg >= 0x40000000 && reg <= 0x400000ff));
+}
+
+static void
+do_real_watch(unsigned int  interval,
+              boolean       one_cpu,
+              boolean       inst)
+{
+   cpu_snapshot_t*  snapshots = NULL;
+   unsigned int     num_cpus  = 0;
+   unsigned int     cpu;
+
+   for (cpu = 0;; cpu++) {
+      if (one_cpu && cpu > 0) break;
+
+      int  cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      cpu_snapshot_t*  grown = realloc(snapshots,
+                                       (cpu+1) * sizeof(cpu_snapshot_t));
+      if (grown == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
+      }
+      snapshots = grown;
+      num_cpus  = cpu+1;
+
+      memset(&snapshots[cpu], 0, sizeof(snapshots[cpu]));
+      walk_real_leaves(cpuid_fd, snapshot_handler, &snapshots[cpu]);
+      real_done(cpuid_fd);
+   }
+
+   if (num_cpus == 0) {
+      fprintf(stderr, "%s: unable to gather from any CPU\n", program);
+      exit(1);
+   }
+
+   for (cpu = 0; cpu < num_cpus; cpu++) {
+      boolean       seen = FALSE;
+      unsigned int  i;
+      for (i = 0; i < snapshots[cpu].count; i++) {
+         const leaf_record_t*  record = &snapshots[cpu].records[i];
+         if (!watch_volatile(record->reg, record->try)) continue;
+         if (!seen) {
+            printf("CPU %u:\n", cpu);
+            seen = TRUE;
+         }
+         print_reg_raw(record->reg, record->try, record->words);
+      }
+   }
+   out_flush();
+
+   for (;;) {
+      sleep(interval);
+
+      for (cpu = 0; cpu < num_cpus; cpu++) {
+         int  cpuid_fd = real_setup(cpu, one_cpu, inst);
+         if (cpuid_fd == -1) continue;
+
+         boolean       seen = FALSE;
+         unsigned int  i;
+         for (i = 0; i < snapshots[cpu].count; i++) {
+            leaf_record_t*  record = &snapshots[cpu].records[i];
+            if (!watch_volatile(record->reg, record->try)) continue;
+
+            unsigned int  words[WORD_NUM];
+            if (!real_get(cpuid_fd, record->reg, words, record->try, TRUE)) {
+               continue;
             }
-         } else if (reg == 0x1f) {
-            print_header(reg, 0, raw);
-            print_reg(reg, words, raw, 0, &stash);
-            unsigned int  try;
-            for (try = 1; try < 256; try++) {
-               real_get(cpuid_fd, reg, words, try, FALSE);
-               print_reg(reg, words, raw, try, &stash);
-               if (BIT_EXTRACT_LE(words[WORD_ECX], 8, 16) == 0) break;
+            if (memcmp(record->words, words, sizeof(words)) == SAME) {
+               continue;
             }
-         } else if (reg == 0x20) {
-            unsigned int  try = 0;
-            unsigned int  max_tries;
-            for (;;) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               if (try == 0) {
-                  max_tries = words[WORD_EAX];
-               }
-               try++;
-               if (try > max_tries) break;
-               real_get(cpuid_fd, reg, words, try, FALSE);
+
+            if (!seen) {
+               printf("CPU %u:\n", cpu);
+               seen = TRUE;
             }
-         } else {
-            print_reg(reg, words, raw, 0, &stash);
+            print_diff_line('-', record->reg, record->try, record->words);
+            print_diff_line('+', record->reg, record->try, words);
+            memcpy(record->words, words, sizeof(record->words));
          }
+
+         real_done(cpuid_fd);
       }
 
-      if (BIT_EXTRACT_LE(stash.val_1_ecx, 31, 32)) {
-         max = 0x40000000;
-         for (reg = 0x40000000; reg <= max; reg++) {
-            boolean       success;
-            unsigned int  words[WORD_NUM];
+      out_flush();
+   }
+}
 
-            success = real_get(cpuid_fd, reg, words, 0, TRUE);
-            if (!success) break;
+/*
+** --serve=SOCKET turns cpuid into a resident query server: one full gather
+** of every CPU into in-memory snapshots, then queries are answered from the
+** cache over a unix stream socket with no re-enumeration.  The protocol is
+** line-oriented, one query per line (CPU defaults to 0, numbers accept 0x):
+**
+**    leaf LEAF [SUBLEAF [CPU]]   the raw hex line for one (leaf, subleaf)
+**    synth [CPU]                 the one-line (synth) description
+**    decode [CPU]                the full decoded text for the CPU
+**    raw [CPU]                   the full raw dump for the CPU
+**    has NAME [CPU]              true/false: some decoded field whose name
+**                                contains NAME (case-blind) is true
+**    refresh                     re-gather every CPU
+**
+** Every reply ends with a line containing a single ".".  Replies are
+** composed in the regular output buffer and written to the client instead
+** of stdout.
+*/
+static struct {
+   cpu_snapshot_t*  snapshots;
+   unsigned int     count;       /* CPUs found by the last gather */
+   unsigned int     allocated;   /* high-water entry count */
+} serve_cache = { NULL, 0, 0 };
 
-            if (reg == 0x40000000) {
-               max = words[WORD_EAX];
-            }
+static void
+serve_gather(boolean  inst)
+{
+   /*
+   ** On refresh, the per-CPU record arrays are reset and reused, not freed
+   ** and regrown: once the first gather has sized them, a long-lived server
+   ** refreshing periodically performs no steady-state heap allocation.
+   */
+   unsigned int  cpu;
+   for (cpu = 0; cpu < serve_cache.allocated; cpu++) {
+      serve_cache.snapshots[cpu].count   = 0;
+      serve_cache.snapshots[cpu].present = FALSE;
+   }
+   serve_cache.count = 0;
 
-            if (reg == 0x40000003 && stash.hypervisor == HYPERVISOR_XEN) {
-               unsigned int  try = 0;
-               while (try <= 2) {
-                  print_header(reg, try, raw);
-                  print_reg(reg, words, raw, try, &stash);
-                  try++;
-                  real_get(cpuid_fd, reg, words, try, FALSE);
-               }
-            } else {
-               print_reg(reg, words, raw, 0, &stash);
-            }
+   for (cpu = 0;; cpu++) {
+      int  cpuid_fd = real_setup(cpu, FALSE, inst);
+      if (cpuid_fd == -1) break;
 
-            if (reg == 0x40000000
-                && stash.hypervisor == HYPERVISOR_KVM
-                && max == 0) {
-               max = 0x40000001;
-            }
-            if (reg == 0x40000000
-                && stash.hypervisor == HYPERVISOR_UNKNOWN
-                && max > 0x40001000) {
-               // Assume some busted cpuid information and stop walking
-               // further 0x4xxxxxxx registers.
-               max = 0x40000000;
-            }
+      if (cpu >= serve_cache.allocated) {
+         cpu_snapshot_t*  snapshots
+            = realloc(serve_cache.snapshots,
+                      (cpu+1) * sizeof(cpu_snapshot_t));
+         if (snapshots == NULL) {
+            fprintf(stderr, "%s: out of memory\n", program);
+            exit(1);
          }
+         memset(&snapshots[serve_cache.allocated], 0,
+                (cpu+1 - serve_cache.allocated) * sizeof(cpu_snapshot_t));
+         serve_cache.snapshots = snapshots;
+         serve_cache.allocated = cpu+1;
       }
 
-      max = 0x20000000;
-      for (reg = 0x20000000; reg <= max; reg++) {
-         boolean       success;
-         unsigned int  words[WORD_NUM];
+      cpu_snapshot_t*  snapshot = &serve_cache.snapshots[cpu];
+      walk_real_leaves(cpuid_fd, snapshot_handler, snapshot);
+      snapshot->present = TRUE;
+      real_done(cpuid_fd);
+      serve_cache.count = cpu+1;
+   }
 
-         success = real_get(cpuid_fd, reg, words, 0, TRUE);
-         if (!success) break;
+   if (serve_cache.count == 0) {
+      fprintf(stderr, "%s: unable to gather from any CPU\n", program);
+      exit(1);
+   }
+}
 
-         if (reg == 0x20000000) {
-            max = words[WORD_EAX];
-            if (max > 0x20000100) {
-               // Pentium 4 (and probably many early CPUs) don't support this
-               // leaf correctly and return garbage (which appears to be a
-               // replica of the values for the last valid leaf in the
-               // 0x0xxxxxxx range).  As a sanity check to avoid an absurdly
-               // long dump, if the value obviously is out-of-range, just
-               // disable all further 0x2xxxxxxx leaves.
-               max = 0x20000000;
+static void
+serve_reply(int  client)
+{
+   out_append(".\n", 2);
+
+   size_t  offset = 0;
+   while (offset < out_length) {
+      ssize_t  written = write(client,
+                               out_buffer + offset, out_length - offset);
+      if (written == -1) {
+         if (errno == EINTR) continue;
+         break;   /* client went away; drop the reply, keep serving */
+      }
+      offset += written;
+   }
+   out_length = 0;
+}
+
+static boolean
+serve_parse_num(cstring        text,
+                unsigned int*  value)
+{
+   errno = 0;
+   char*          endptr = NULL;
+   unsigned long  val    = strtoul(text, &endptr, 0);
+   if (errno != 0 || endptr == text || *endptr != '\0') return FALSE;
+   *value = val;
+   return TRUE;
+}
+
+/*
+** Scan the composed decode text for a "name = value" field line whose name
+** contains the given string (case-blind) and whose value is true.
+*/
+static boolean
+serve_buffer_has(ccstring  name)
+{
+   size_t  name_len = strlen(name);
+   size_t  start    = 0;
+
+   while (start < out_length) {
+      size_t  end = start;
+      while (end < out_length && out_buffer[end] != '\n') end++;
+
+      const char*  line = &out_buffer[start];
+      size_t       len  = end - start;
+      size_t       eq;
+      for (eq = 0; eq + 3 <= len; eq++) {
+         if (memcmp(&line[eq], " = ", 3) == SAME) break;
+      }
+      if (eq + 3 <= len
+          && len - (eq+3) >= 4 && memcmp(&line[eq+3], "true", 4) == SAME) {
+         size_t  i;
+         for (i = 0; i + name_len <= eq; i++) {
+            if (strncasecmp(&line[i], name, name_len) == SAME) return TRUE;
+         }
+      }
+
+      start = end + 1;
+   }
+   return FALSE;
+}
+
+static void
+serve_client(int      client,
+             boolean  inst)
+{
+   FILE*  in = fdopen(client, "r");
+   if (in == NULL) {
+      close(client);
+      return;
+   }
+
+   char  line[256];
+   while (fgets(line, LENGTH(line), in) != NULL) {
+      char*  cmd  = strtok(line, " \t\r\n");
+      char*  arg1 = strtok(NULL, " \t\r\n");
+      char*  arg2 = strtok(NULL, " \t\r\n");
+      char*  arg3 = strtok(NULL, " \t\r\n");
+
+      if (cmd == NULL) continue;
+
+      if (strcmp(cmd, "quit") == 0) break;
+
+      if (strcmp(cmd, "refresh") == 0) {
+         serve_gather(inst);
+         printf("ok\n");
+         serve_reply(client);
+         continue;
+      }
+
+      if (strcmp(cmd, "leaf") != 0 && strcmp(cmd, "synth") != 0
+          && strcmp(cmd, "decode") != 0 && strcmp(cmd, "raw") != 0
+          && strcmp(cmd, "has") != 0) {
+         printf("error: unrecognized query: %s\n", cmd);
+         serve_reply(client);
+         continue;
+      }
+
+      /* All remaining queries end with an optional CPU number. */
+      cstring  cpu_arg = (strcmp(cmd, "leaf") == 0 ? arg3
+                          : strcmp(cmd, "has") == 0 ? arg2
+                          : arg1);
+      unsigned int  cpu = 0;
+      if (cpu_arg != NULL && !serve_parse_num(cpu_arg, &cpu)) {
+         printf("error: CPU number not understood: %s\n", cpu_arg);
+         serve_reply(client);
+         continue;
+      }
+      if (cpu >= serve_cache.count) {
+         printf("error: no such CPU: %u\n", cpu);
+         serve_reply(client);
+         continue;
+      }
+      const cpu_snapshot_t*  snapshot = &serve_cache.snapshots[cpu];
+
+      if (strcmp(cmd, "leaf") == 0) {
+         unsigned int  leaf    = 0;
+         unsigned int  subleaf = 0;
+         if (arg1 == NULL || !serve_parse_num(arg1, &leaf)
+             || (arg2 != NULL && !serve_parse_num(arg2, &subleaf))) {
+            printf("error: leaf query not understood\n");
+            serve_reply(client);
+            continue;
+         }
+         unsigned int  r;
+         for (r = 0; r < snapshot->count; r++) {
+            if (snapshot->records[r].reg == leaf
+                && snapshot->records[r].try == subleaf) {
+               print_reg_raw(leaf, subleaf, snapshot->records[r].words);
+               break;
             }
          }
+         if (r == snapshot->count) {
+            printf("error: leaf not present\n");
+         }
+      } else if (strcmp(cmd, "synth") == 0) {
+         code_stash_t  stash = NIL_STASH;
+         out_muted = TRUE;
+         unsigned int  r;
+         for (r = 0; r < snapshot->count; r++) {
+            print_reg(snapshot->records[r].reg, snapshot->records[r].words,
+                      FALSE, snapshot->records[r].try, &stash);
+         }
+         do_final(FALSE, FALSE, &stash);
+         out_muted = FALSE;
+         cstring  synth = decode_synth(stash.val_1_eax, stash.vendor, &stash);
+         printf("%s\n", synth != NULL ? synth : "unknown");
+      } else if (strcmp(cmd, "decode") == 0) {
+         replay_snapshot(snapshot, FALSE, FALSE);
+      } else if (strcmp(cmd, "raw") == 0) {
+         replay_snapshot(snapshot, TRUE, FALSE);
+      } else if (strcmp(cmd, "has") == 0) {
+         if (arg1 == NULL) {
+            printf("error: has query not understood\n");
+            serve_reply(client);
+            continue;
+         }
+         replay_snapshot(snapshot, FALSE, FALSE);
+         boolean  result = serve_buffer_has(arg1);
+         out_length = 0;   /* the decode text was only scanned, not sent */
+         printf("%s\n", bools[result]);
+      }
+      serve_reply(client);
+   }
+
+   fclose(in);
+}
+
+static void
+do_real_serve(ccstring  path,
+              boolean   inst)
+{
+   /*
+   ** A client that closes its socket before reading the reply would
+   ** otherwise raise SIGPIPE on the write and kill the daemon; with the
+   ** signal ignored, write() fails with EPIPE and serve_reply()'s
+   ** client-went-away path drops the reply and keeps serving.
+   */
+   signal(SIGPIPE, SIG_IGN);
+
+   serve_gather(inst);
+
+   int  sock = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (sock == -1) {
+      fprintf(stderr,
+              "%s: unable to create socket; errno = %d (%s)\n",
+              program, errno, strerror(errno));
+      exit(1);
+   }
+
+   struct sockaddr_un  addr;
+   memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   if (strlen(path) >= sizeof(addr.sun_path)) {
+      fprintf(stderr, "%s: socket path too long: %s\n", program, path);
+      exit(1);
+   }
+   strcpy(addr.sun_path, path);
+
+   /* Replace any stale socket left by a previous instance. */
+   unlink(path);
+
+   if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) == -1
+       || listen(sock, 8) == -1) {
+      fprintf(stderr,
+              "%s: unable to listen on %s; errno = %d (%s)\n",
+              program, path, errno, strerror(errno));
+      exit(1);
+   }
+
+   for (;;) {
+      int  client = accept(sock, NULL, NULL);
+      if (client == -1) {
+         if (errno == EINTR) continue;
+         fprintf(stderr,
+                 "%s: unable to accept connection; errno = %d (%s)\n",
+                 program, errno, strerror(errno));
+         exit(1);
+      }
+      serve_client(client, inst);
+   }
+}
+
+
+/*
+** --has NAME answers one feature predicate with the exit status: 0 if the
+** CPU reports the feature, 1 if not (2 for usage errors).  The name maps
+** through a sorted table to its (leaf, subleaf, register, bit), and only
+** that leaf plus its range maximum are read: no full walk, no text for the
+** caller to parse.  Names are the /proc/cpuinfo-style short forms,
+** compared case-blind.  The range maximum is checked first because
+** out-of-range basic leaves echo the highest basic leaf rather than
+** returning zeros on many CPUs.
+*/
+typedef struct {
+   ccstring      name;
+   unsigned int  reg;
+   unsigned int  try;
+   unsigned int  word;
+   unsigned int  bit;
+} feature_bit_t;
+
+static const feature_bit_t  feature_bits[] = {
+   { "3dnow",               0x80000001, 0, WORD_EDX, 31 },
+   { "3dnowext",            0x80000001, 0, WORD_EDX, 30 },
+   { "3dnowprefetch",       0x80000001, 0, WORD_ECX,  8 },
+   { "acpi",                0x00000001, 0, WORD_EDX, 22 },
+   { "adx",                 0x00000007, 0, WORD_EBX, 19 },
+   { "aes",                 0x00000001, 0, WORD_ECX, 25 },
+   { "amx_bf16",            0x00000007, 0, WORD_EDX, 22 },
+   { "amx_int8",            0x00000007, 0, WORD_EDX, 25 },
+   { "amx_tile",            0x00000007, 0, WORD_EDX, 24 },
+   { "apic",                0x00000001, 0, WORD_EDX,  9 },
+   { "avx",                 0x00000001, 0, WORD_ECX, 28 },
+   { "avx2",                0x00000007, 0, WORD_EBX,  5 },
+   { "avx512_4fmaps",       0x00000007, 0, WORD_EDX,  3 },
+   { "avx512_4vnniw",       0x00000007, 0, WORD_EDX,  2 },
+   { "avx512bf16",          0x00000007, 1, WORD_EAX,  5 },
+   { "avx512bitalg",        0x00000007, 0, WORD_ECX, 12 },
+   { "avx512bw",            0x00000007, 0, WORD_EBX, 30 },
+   { "avx512cd",            0x00000007, 0, WORD_EBX, 28 },
+   { "avx512dq",            0x00000007, 0, WORD_EBX, 17 },
+   { "avx512er",            0x00000007, 0, WORD_EBX, 27 },
+   { "avx512f",             0x00000007, 0, WORD_EBX, 16 },
+   { "avx512fp16",          0x00000007, 0, WORD_EDX, 23 },
+   { "avx512ifma",          0x00000007, 0, WORD_EBX, 21 },
+   { "avx512pf",            0x00000007, 0, WORD_EBX, 26 },
+   { "avx512vbmi",          0x00000007, 0, WORD_ECX,  1 },
+   { "avx512vbmi2",         0x00000007, 0, WORD_ECX,  6 },
+   { "avx512vl",            0x00000007, 0, WORD_EBX, 31 },
+   { "avx512vnni",          0x00000007, 0, WORD_ECX, 11 },
+   { "avx512vp2intersect",  0x00000007, 0, WORD_EDX,  8 },
+   { "avx512vpopcntdq",     0x00000007, 0, WORD_ECX, 14 },
+   { "avx_vnni",            0x00000007, 1, WORD_EAX,  4 },
+   { "bmi1",                0x00000007, 0, WORD_EBX,  3 },
+   { "bmi2",                0x00000007, 0, WORD_EBX,  8 },
+   { "cet_ibt",             0x00000007, 0, WORD_EDX, 20 },
+   { "cet_ss",              0x00000007, 0, WORD_ECX,  7 },
+   { "cldemote",            0x00000007, 0, WORD_ECX, 25 },
+   { "clflushopt",          0x00000007, 0, WORD_EBX, 23 },
+   { "clfsh",               0x00000001, 0, WORD_EDX, 19 },
+   { "clwb",                0x00000007, 0, WORD_EBX, 24 },
+   { "cmov",                0x00000001, 0, WORD_EDX, 15 },
+   { "cx16",                0x00000001, 0, WORD_ECX, 13 },
+   { "cx8",                 0x00000001, 0, WORD_EDX,  8 },
+   { "dca",                 0x00000001, 0, WORD_ECX, 18 },
+   { "de",                  0x00000001, 0, WORD_EDX,  2 },
+   { "ds",                  0x00000001, 0, WORD_EDX, 21 },
+   { "dtes64",              0x00000001, 0, WORD_ECX,  2 },
+   { "enqcmd",              0x00000007, 0, WORD_ECX, 29 },
+   { "erms",                0x00000007, 0, WORD_EBX,  9 },
+   { "est",                 0x00000001, 0, WORD_ECX,  7 },
+   { "f16c",                0x00000001, 0, WORD_ECX, 29 },
+   { "fma",                 0x00000001, 0, WORD_ECX, 12 },
+   { "fma4",                0x80000001, 0, WORD_ECX, 16 },
+   { "fpu",                 0x00000001, 0, WORD_EDX,  0 },
+   { "fsgsbase",            0x00000007, 0, WORD_EBX,  0 },
+   { "fsrm",                0x00000007, 0, WORD_EDX,  4 },
+   { "fxsr",                0x00000001, 0, WORD_EDX, 24 },
+   { "gfni",                0x00000007, 0, WORD_ECX,  8 },
+   { "hle",                 0x00000007, 0, WORD_EBX,  4 },
+   { "htt",                 0x00000001, 0, WORD_EDX, 28 },
+   { "hybrid",              0x00000007, 0, WORD_EDX, 15 },
+   { "hypervisor",          0x00000001, 0, WORD_ECX, 31 },
+   { "invpcid",             0x00000007, 0, WORD_EBX, 10 },
+   { "invtsc",              0x80000007, 0, WORD_EDX,  8 },
+   { "la57",                0x00000007, 0, WORD_ECX, 16 },
+   { "lahf_lm",             0x80000001, 0, WORD_ECX,  0 },
+   { "lm",                  0x80000001, 0, WORD_EDX, 29 },
+   { "lzcnt",               0x80000001, 0, WORD_ECX,  5 },
+   { "mca",                 0x00000001, 0, WORD_EDX, 14 },
+   { "mce",                 0x00000001, 0, WORD_EDX,  7 },
+   { "mmx",                 0x00000001, 0, WORD_EDX, 23 },
+   { "mmxext",              0x80000001, 0, WORD_EDX, 22 },
+   { "monitor",             0x00000001, 0, WORD_ECX,  3 },
+   { "movbe",               0x00000001, 0, WORD_ECX, 22 },
+   { "movdir64b",           0x00000007, 0, WORD_ECX, 28 },
+   { "movdiri",             0x00000007, 0, WORD_ECX, 27 },
+   { "mpx",                 0x00000007, 0, WORD_EBX, 14 },
+   { "msr",                 0x00000001, 0, WORD_EDX,  5 },
+   { "mtrr",                0x00000001, 0, WORD_EDX, 12 },
+   { "nx",                  0x80000001, 0, WORD_EDX, 20 },
+   { "osxsave",             0x00000001, 0, WORD_ECX, 27 },
+   { "pae",                 0x00000001, 0, WORD_EDX,  6 },
+   { "pat",                 0x00000001, 0, WORD_EDX, 16 },
+   { "pbe",                 0x00000001, 0, WORD_EDX, 31 },
+   { "pcid",                0x00000001, 0, WORD_ECX, 17 },
+   { "pclmulqdq",           0x00000001, 0, WORD_ECX,  1 },
+   { "pconfig",             0x00000007, 0, WORD_EDX, 18 },
+   { "pdcm",                0x00000001, 0, WORD_ECX, 15 },
+   { "pdpe1gb",             0x80000001, 0, WORD_EDX, 26 },
+   { "pge",                 0x00000001, 0, WORD_EDX, 13 },
+   { "pku",                 0x00000007, 0, WORD_ECX,  3 },
+   { "popcnt",              0x00000001, 0, WORD_ECX, 23 },
+   { "pse",                 0x00000001, 0, WORD_EDX,  3 },
+   { "pse36",               0x00000001, 0, WORD_EDX, 17 },
+   { "psn",                 0x00000001, 0, WORD_EDX, 18 },
+   { "rdpid",               0x00000007, 0, WORD_ECX, 22 },
+   { "rdrand",              0x00000001, 0, WORD_ECX, 30 },
+   { "rdseed",              0x00000007, 0, WORD_EBX, 18 },
+   { "rdtscp",              0x80000001, 0, WORD_EDX, 27 },
+   { "rtm",                 0x00000007, 0, WORD_EBX, 11 },
+   { "sep",                 0x00000001, 0, WORD_EDX, 11 },
+   { "serialize",           0x00000007, 0, WORD_EDX, 14 },
+   { "sgx",                 0x00000007, 0, WORD_EBX,  2 },
+   { "sha",                 0x00000007, 0, WORD_EBX, 29 },
+   { "smap",                0x00000007, 0, WORD_EBX, 20 },
+   { "smep",                0x00000007, 0, WORD_EBX,  7 },
+   { "smx",                 0x00000001, 0, WORD_ECX,  6 },
+   { "ss",                  0x00000001, 0, WORD_EDX, 27 },
+   { "sse",                 0x00000001, 0, WORD_EDX, 25 },
+   { "sse2",                0x00000001, 0, WORD_EDX, 26 },
+   { "sse3",                0x00000001, 0, WORD_ECX,  0 },
+   { "sse4_1",              0x00000001, 0, WORD_ECX, 19 },
+   { "sse4_2",              0x00000001, 0, WORD_ECX, 20 },
+   { "sse4a",               0x80000001, 0, WORD_ECX,  6 },
+   { "ssse3",               0x00000001, 0, WORD_ECX,  9 },
+   { "svm",                 0x80000001, 0, WORD_ECX,  2 },
+   { "syscall",             0x80000001, 0, WORD_EDX, 11 },
+   { "tbm",                 0x80000001, 0, WORD_ECX, 21 },
+   { "tm",                  0x00000001, 0, WORD_EDX, 29 },
+   { "tm2",                 0x00000001, 0, WORD_ECX,  8 },
+   { "tsc",                 0x00000001, 0, WORD_EDX,  4 },
+   { "tsxldtrk",            0x00000007, 0, WORD_EDX, 16 },
+   { "umip",                0x00000007, 0, WORD_ECX,  2 },
+   { "vaes",                0x00000007, 0, WORD_ECX,  9 },
+   { "vme",                 0x00000001, 0, WORD_EDX,  1 },
+   { "vmx",                 0x00000001, 0, WORD_ECX,  5 },
+   { "vpclmulqdq",          0x00000007, 0, WORD_ECX, 10 },
+   { "waitpkg",             0x00000007, 0, WORD_ECX,  5 },
+   { "x2apic",              0x00000001, 0, WORD_ECX, 21 },
+   { "xgetbv1",             0x0000000d, 1, WORD_EAX,  2 },
+   { "xop",                 0x80000001, 0, WORD_ECX, 11 },
+   { "xsave",               0x00000001, 0, WORD_ECX, 26 },
+   { "xsavec",              0x0000000d, 1, WORD_EAX,  1 },
+   { "xsaveopt",            0x0000000d, 1, WORD_EAX,  0 },
+   { "xsaves",              0x0000000d, 1, WORD_EAX,  3 },
+};
+
+static int
+feature_bit_compare(const void*  key,
+                    const void*  member)
+{
+   return strcasecmp((const char*)key,
+                     ((const feature_bit_t*)member)->name);
+}
+
+static void
+do_real_has(ccstring  name,
+            boolean   inst)
+{
+   const feature_bit_t*  feature
+      = (const feature_bit_t*)bsearch(name, feature_bits,
+                                      LENGTH(feature_bits),
+                                      sizeof(feature_bit_t),
+                                      feature_bit_compare);
+   if (feature == NULL) {
+      fprintf(stderr, "%s: feature name not known: %s\n", program, name);
+      exit(2);
+   }
+
+   int  cpuid_fd = real_setup(0, TRUE, inst);
+   if (cpuid_fd == -1) {
+      fprintf(stderr, "%s: unable to read CPUID information\n", program);
+      exit(2);
+   }
+
+   unsigned int  base = feature->reg & 0x80000000;
+   unsigned int  words[WORD_NUM];
+   real_get(cpuid_fd, base, words, 0, FALSE);
+
+   boolean  has = FALSE;
+   if (words[WORD_EAX] >= feature->reg) {
+      real_get(cpuid_fd, feature->reg, words, feature->try, TRUE);
+      has = ((words[feature->word] >> feature->bit) & 1) != 0;
+   }
+
+   real_done(cpuid_fd);
+   exit(has ? 0 : 1);
+}
+
+/*
+** --bench-leaf[=LEAF] measures the latency of the CPUID instruction itself
+** (or of the kernel driver read, with -k).  On bare metal a CPUID is on the
+** order of 100 cycles; under a hypervisor every CPUID is a VM exit whose
+** cost varies wildly by hypervisor and by leaf.  Each sampled call is timed
+** individually with serialized rdtsc, the sample count is calibrated per
+** leaf so a pathologically slow leaf doesn't stall the run, and min,
+** median, and p99 cycles are reported per leaf per CPU: the tail is what
+** matters when sizing anything that performs full walks in bulk.
+*/
+
+#define BENCH_MIN_SAMPLES    100
+#define BENCH_MAX_SAMPLES    10000
+#define BENCH_TARGET_CYCLES  50000000ULL   /* ~20ms/leaf at 2.5GHz */
+
+static unsigned long long
+bench_rdtsc(void)
+{
+   unsigned int  lo;
+   unsigned int  hi;
+   /* The lfence keeps the timestamp from drifting into the timed call. */
+   asm volatile("lfence ; rdtsc" : "=a" (lo), "=d" (hi));
+   return ((unsigned long long)hi << 32) | lo;
+}
+
+static int
+bench_sample_compare(const void*  left,
+                     const void*  right)
+{
+   unsigned long long  l = *(const unsigned long long*)left;
+   unsigned long long  r = *(const unsigned long long*)right;
+   return l < r ? -1 : l > r ? 1 : 0;
+}
+
+static void
+bench_one_leaf(int           cpuid_fd,
+               unsigned int  reg)
+{
+   static unsigned long long  samples[BENCH_MAX_SAMPLES];
+   unsigned int               words[WORD_NUM];
+   unsigned int               i;
+
+   if (!real_get(cpuid_fd, reg, words, 0, TRUE)) {
+      printf("   0x%08x: unreadable\n", reg);
+      return;
+   }
+
+   /*
+   ** Calibrate: estimate the per-call cost from a short warm loop, then
+   ** size the sample count to a bounded cycle budget.  The driver's batch
+   ** buffer is invalidated before every call so the kernel path pays its
+   ** syscall each time rather than being served from the cache.
+   */
+   for (i = 0; i < 8; i++) {
+      kernel_batch.fd = -1;
+      real_get(cpuid_fd, reg, words, 0, TRUE);
+   }
+   unsigned long long  start = bench_rdtsc();
+   for (i = 0; i < 16; i++) {
+      kernel_batch.fd = -1;
+      real_get(cpuid_fd, reg, words, 0, TRUE);
+   }
+   unsigned long long  estimate = (bench_rdtsc() - start) / 16;
+   if (estimate == 0) estimate = 1;
+
+   unsigned long long  budget = BENCH_TARGET_CYCLES / estimate;
+   unsigned int        count  = (budget > BENCH_MAX_SAMPLES
+                                 ? BENCH_MAX_SAMPLES
+                                 : budget < BENCH_MIN_SAMPLES
+                                 ? BENCH_MIN_SAMPLES
+                                 : (unsigned int)budget);
+
+   for (i = 0; i < count; i++) {
+      kernel_batch.fd = -1;
+      unsigned long long  before = bench_rdtsc();
+      real_get(cpuid_fd, reg, words, 0, TRUE);
+      samples[i] = bench_rdtsc() - before;
+   }
+
+   qsort(samples, count, sizeof(samples[0]), bench_sample_compare);
+   printf("   0x%08x: min=%llu median=%llu p99=%llu cycles (%u samples)\n",
+          reg, samples[0], samples[count/2], samples[(count*99)/100], count);
+}
+
+/*
+** The default set covers one leaf per interesting class: the range maxima,
+** the always-read feature leaves, a repeating leaf (2), subleaf-heavy
+** leaves (7, 0xb, 0xd, 0x8000001d), and the hypervisor base (which on bare
+** metal merely echoes garbage, and under a hypervisor is often the most
+** expensive exit of all).
+*/
+static const unsigned int  bench_default_leaves[] = {
+   0x0, 0x1, 0x2, 0x7, 0xb, 0xd,
+   0x40000000,
+   0x80000000, 0x80000001, 0x8000001d,
+};
+
+static void
+do_real_bench(boolean       one_cpu,
+              boolean       inst,
+              boolean       have_leaf,
+              unsigned int  leaf)
+{
+   unsigned int  cpu;
+
+   for (cpu = 0;; cpu++) {
+      int  cpuid_fd = -1;
+
+      if (one_cpu && cpu > 0) break;
+
+      cpuid_fd = real_setup(cpu, one_cpu, inst);
+      if (cpuid_fd == -1) break;
+
+      if (inst && one_cpu) {
+         printf("CPU:\n");
+      } else {
+         printf("CPU %u:\n", cpu);
+      }
+
+      if (have_leaf) {
+         bench_one_leaf(cpuid_fd, leaf);
+      } else {
+         unsigned int  i;
+         for (i = 0; i < LENGTH(bench_default_leaves); i++) {
+            bench_one_leaf(cpuid_fd, bench_default_leaves[i]);
+         }
+      }
+
+      real_done(cpuid_fd);
+      out_flush();
+   }
+}
+
+/*
+** libcpuid entry points (see libcpuid.h).  These wrap the same walk &
+** decode machinery the tool itself uses; "make lib" builds the whole file
+** into libcpuid.so.  The decode routines fill in their code_stash_t via
+** print_reg() with the output engine muted, rather than teaching every
+** print routine a quiet mode.
+*/
+struct cpuid_snapshot {
+   cpu_snapshot_t  snap;
+};
+
+struct cpuid_info {
+   code_stash_t  stash;
+   char          vendor[12+1];
+   char          synth[1024];
+};
+
+int
+cpuid_gather(unsigned int        cpu,
+             cpuid_snapshot_t**  snapshot_p)
+{
+   if (program == NULL) program = "libcpuid";
+
+   cpuid_snapshot_t*  snapshot = calloc(1, sizeof(cpuid_snapshot_t));
+   if (snapshot == NULL) return -1;
+
+   int  cpuid_fd = real_setup(cpu, FALSE, TRUE);
+   if (cpuid_fd == -1) {
+      free(snapshot);
+      return -1;
+   }
+
+   walk_real_leaves(cpuid_fd, snapshot_handler, &snapshot->snap);
+   snapshot->snap.present = TRUE;
+   real_done(cpuid_fd);
+
+   *snapshot_p = snapshot;
+   return 0;
+}
+
+void
+cpuid_snapshot_free(cpuid_snapshot_t*  snapshot)
+{
+   if (snapshot == NULL) return;
+   free(snapshot->snap.records);
+   free(snapshot);
+}
 
-         print_reg(reg, words, raw, 0, &stash);
+unsigned int
+cpuid_snapshot_record_count(const cpuid_snapshot_t*  snapshot)
+{
+   return snapshot->snap.count;
+}
+
+int
+cpuid_snapshot_record(const cpuid_snapshot_t*  snapshot,
+                      unsigned int             index,
+                      unsigned int*            leaf,
+                      unsigned int*            subleaf,
+                      unsigned int             words[WORD_NUM])
+{
+   if (index >= snapshot->snap.count) return -1;
+   const leaf_record_t*  record = &snapshot->snap.records[index];
+   *leaf    = record->reg;
+   *subleaf = record->try;
+   memcpy(words, record->words, sizeof(record->words));
+   return 0;
+}
+
+int
+cpuid_snapshot_leaf(const cpuid_snapshot_t*  snapshot,
+                    unsigned int             leaf,
+                    unsigned int             subleaf,
+                    unsigned int             words[WORD_NUM])
+{
+   unsigned int  r;
+   for (r = 0; r < snapshot->snap.count; r++) {
+      const leaf_record_t*  record = &snapshot->snap.records[r];
+      if (record->reg == leaf && record->try == subleaf) {
+         memcpy(words, record->words, sizeof(record->words));
+         return 0;
       }
+   }
+   return -1;
+}
 
-      max = 0x80000000;
-      for (reg = 0x80000000; reg <= max; reg++) {
-         boolean       success;
-         unsigned int  words[WORD_NUM];
+int
+cpuid_decode(const cpuid_snapshot_t*  snapshot,
+             cpuid_info_t**           info_p)
+{
+   if (program == NULL) program = "libcpuid";
+
+   cpuid_info_t*  info = malloc(sizeof(cpuid_info_t));
+   if (info == NULL) return -1;
+
+   code_stash_t  nil_stash = NIL_STASH;
+   info->stash     = nil_stash;
+   info->vendor[0] = '\0';
+   info->synth[0]  = '\0';
 
-         success = real_get(cpuid_fd, reg, words, 0, TRUE);
-         if (!success) break;
+   out_muted = TRUE;
+   unsigned int  r;
+   for (r = 0; r < snapshot->snap.count; r++) {
+      const leaf_record_t*  record = &snapshot->snap.records[r];
+      print_reg(record->reg, record->words, FALSE, record->try,
+                &info->stash);
+   }
+   /* do_final() performs the brand & MP analyses that fill in the rest of
+   ** the stash; its printing is muted along with print_reg's. */
+   do_final(FALSE, FALSE, &info->stash);
+   out_muted = FALSE;
+
+   unsigned int  words[WORD_NUM];
+   if (cpuid_snapshot_leaf(snapshot, 0, 0, words) == 0) {
+      memcpy(&info->vendor[0], &words[WORD_EBX], 4);
+      memcpy(&info->vendor[4], &words[WORD_EDX], 4);
+      memcpy(&info->vendor[8], &words[WORD_ECX], 4);
+      info->vendor[12] = '\0';
+   }
 
-         if (reg == 0x80000000) {
-            max = words[WORD_EAX];
-         }
+   cstring  synth = decode_synth(info->stash.val_1_eax, info->stash.vendor,
+                                 &info->stash);
+   if (synth != NULL) {
+      strncpy(info->synth, synth, sizeof(info->synth) - 1);
+      info->synth[sizeof(info->synth) - 1] = '\0';
+   }
 
-         if (reg == 0x8000001d) {
-            unsigned int  try = 0;
-            while ((words[WORD_EAX] & 0x1f) != 0) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               try++;
-               real_get(cpuid_fd, reg, words, try, FALSE);
-            }
-         } else if (reg == 0x80000020) {
-            // Rules for loop termination from SKC*.
-            unsigned int  try = 0;
-            while (words[WORD_EAX] != 0 || words[WORD_EBX] != 0 ||
-                   words[WORD_ECX] != 0 || words[WORD_EDX] != 0) {
-               print_header(reg, try, raw);
-               print_reg(reg, words, raw, try, &stash);
-               try++;
-               real_get(cpuid_fd, reg, words, try, FALSE);
-            }
-         } else {
-            print_reg(reg, words, raw, 0, &stash);
-         }
-      }
+   *info_p = info;
+   return 0;
+}
 
-      max = 0x80860000;
-      for (reg = 0x80860000; reg <= max; reg++) {
-         boolean       success;
-         unsigned int  words[WORD_NUM];
+void
+cpuid_info_free(cpuid_info_t*  info)
+{
+   free(info);
+}
 
-         success = real_get(cpuid_fd, reg, words, 0, TRUE);
-         if (!success) break;
+const char*
+cpuid_info_vendor(const cpuid_info_t*  info)
+{
+   return info->vendor;
+}
 
-         if (reg == 0x80860000) {
-            max = words[WORD_EAX];
-         }
+const char*
+cpuid_info_brand(const cpuid_info_t*  info)
+{
+   return info->stash.brand;
+}
 
-         print_reg(reg, words, raw, 0, &stash);
-      }
+const char*
+cpuid_info_synth(const cpuid_info_t*  info)
+{
+   return info->synth;
+}
 
-      max = 0xc0000000;
-      for (reg = 0xc0000000; reg <= max; reg++) {
-         boolean       success;
-         unsigned int  words[WORD_NUM];
+unsigned int
+cpuid_info_family(const cpuid_info_t*  info)
+{
+   unsigned int  val  = info->stash.val_1_eax;
+   unsigned int  base = (val >> 8) & 0xf;
+   unsigned int  ext  = (val >> 20) & 0xff;
+   return base == 0xf ? base + ext : base;
+}
 
-         success = real_get(cpuid_fd, reg, words, 0, TRUE);
-         if (!success) break;
+unsigned int
+cpuid_info_model(const cpuid_info_t*  info)
+{
+   unsigned int  val         = info->stash.val_1_eax;
+   unsigned int  base_family = (val >> 8) & 0xf;
+   unsigned int  base        = (val >> 4) & 0xf;
+   unsigned int  ext         = (val >> 16) & 0xf;
+   return (base_family == 6 || base_family == 0xf) ? (ext << 4) + base
+                                                   : base;
+}
 
-         if (reg == 0xc0000000) {
-            max = words[WORD_EAX];
-         }
+unsigned int
+cpuid_info_stepping(const cpuid_info_t*  info)
+{
+   return info->stash.val_1_eax & 0xf;
+}
 
-         if (max > 0xc0001000) {
-            // Assume some busted cpuid information and stop walking
-            // further 0x4xxxxxxx registers.
-            max = 0xc0000000;
-         }
+static cstring*      file_names     = NULL;
+static unsigned int  file_count     = 0;
+static unsigned int  file_allocated = 0;
 
-         print_reg(reg, words, raw, 0, &stash);
+static void
+add_file_name(cstring  filename)
+{
+   if (file_count == file_allocated) {
+      file_allocated = (file_allocated == 0 ? 16 : file_allocated * 2);
+      cstring*  names = realloc(file_names,
+                                file_allocated * sizeof(cstring));
+      if (names == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
       }
-      
-      do_final(raw, debug, &stash);
-
-      close(cpuid_fd);
+      file_names = names;
    }
+   file_names[file_count++] = filename;
 }
 
 static void
-do_file(ccstring  filename,
-        boolean   raw,
-        boolean   debug)
+add_files_from(ccstring  listname)
 {
-   boolean       seen_cpu    = FALSE;
-   unsigned int  cpu         = -1;
-   /*
-   ** The try* variables are a kludge to deal with those leaves that depended on
-   ** the try (a.k.a. ecx) values that existed with cpuid's old-style method of
-   ** dumping raw leaves, which lacked an explicit indication of the try number.
-   ** It is not necessary to add more kludges for more modern ecx-dependent
-   ** leaves.
-   */
-   unsigned int  try2        = -1;
-   unsigned int  try4        = -1;
-   unsigned int  try7        = -1;
-   unsigned int  tryb        = -1;
-   unsigned int  try8000001d = -1;
-   code_stash_t  stash       = NIL_STASH;
-
-   FILE*  file;
-   if (strcmp(filename, "-") == 0) {
-      file = stdin;
+   FILE*  list;
+   if (strcmp(listname, "-") == 0) {
+      list = stdin;
    } else {
-      file = fopen(filename, "r");
-      if (file == NULL) {
+      list = fopen(listname, "r");
+      if (list == NULL) {
          fprintf(stderr,
                  "%s: unable to open %s; errno = %d (%s)\n",
-                 program, filename, errno, strerror(errno));
+                 program, listname, errno, strerror(errno));
          exit(1);
       }
    }
 
-   while (!feof(file)) {
-      char          buffer[88];
-      char*         ptr;
-      int           status;
-      unsigned int  reg;
-      unsigned int  try;
-      unsigned int  words[WORD_NUM];
-
-      ptr = fgets(buffer, LENGTH(buffer), file);
-      if (ptr == NULL && errno == 0) break;
-      if (ptr == NULL) {
-         if (errno != EPIPE) {
-            fprintf(stderr,
-                    "%s: unable to read a line of text from %s;"
-                    " errno = %d (%s)\n",
-                    program, filename, errno, strerror(errno));
-         }
-         exit(1);
-      }
-
-      status = sscanf(ptr, "CPU %u:\r", &cpu);
-      if (status == 1 || strcmp(ptr, "CPU:\n") == SAME) {
-         if (seen_cpu) {
-            do_final(raw, debug, &stash);
-         }
-
-         seen_cpu = TRUE;
-
-         if (status == 1) {
-            printf("CPU %u:\n", cpu);
-         } else {
-            printf("CPU:\n");
-         }
-         try2        = 0;
-         try4        = 0;
-         try7        = 0;
-         tryb        = 0;
-         try8000001d = 0;
-         {
-            static code_stash_t  empty_stash = NIL_STASH;
-            stash = empty_stash;
-         }
-         continue;
-      }
-
-      status = sscanf(ptr,
-                      "   0x%x 0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
-                      &reg, &try,
-                      &words[WORD_EAX], &words[WORD_EBX],
-                      &words[WORD_ECX], &words[WORD_EDX]);
-      if (status == 6) {
-         print_header(reg, try, raw);
-         print_reg(reg, words, raw, try, &stash);
-         continue;
+   char  buffer[4096];
+   while (fgets(buffer, sizeof(buffer), list) != NULL) {
+      size_t  length = strlen(buffer);
+      while (length > 0
+             && (buffer[length-1] == '\n' || buffer[length-1] == '\r')) {
+         buffer[--length] = '\0';
       }
-      status = sscanf(ptr,
-                      "   0x%x: eax=0x%x ebx=0x%x ecx=0x%x edx=0x%x\r",
-                      &reg, 
-                      &words[WORD_EAX], &words[WORD_EBX],
-                      &words[WORD_ECX], &words[WORD_EDX]);
-      if (status == 5) {
-         if (reg == 2) {
-            print_header(reg, try2, raw);
-            print_reg(reg, words, raw, try2++, &stash);
-         } else if (reg == 4) {
-            print_header(reg, try4, raw);
-            print_reg(reg, words, raw, try4++, &stash);
-         } else if (reg == 7) {
-            print_header(reg, try7, raw);
-            print_reg(reg, words, raw, try7++, &stash);
-         } else if (reg == 0xb) {
-            print_header(reg, tryb, raw);
-            print_reg(reg, words, raw, tryb++, &stash);
-         } else if (reg == 0x8000001d) {
-            print_header(reg, try8000001d, raw);
-            print_reg(reg, words, raw, try8000001d++, &stash);
-         } else {
-            print_reg(reg, words, raw, 0, &stash);
-         }
-         continue;
+      if (length == 0) continue;
+      char*  name = malloc(length + 1);
+      if (name == NULL) {
+         fprintf(stderr, "%s: out of memory\n", program);
+         exit(1);
       }
-
-      fprintf(stderr,
-              "%s: unexpected input with -f option: %s\n",
-              program, ptr);
-      exit(1);
-   }
-
-   if (seen_cpu) {
-      do_final(raw, debug, &stash);
+      memcpy(name, buffer, length + 1);
+      add_file_name(name);
    }
 
-   if (file != stdin) {
-      fclose(file);
-   }
+   if (list != stdin) fclose(list);
 }
 
 int
@@ -9935,6 +13626,21 @@ main(int     argc,
       { "version", no_argument,       NULL, 'v'  },
       { "leaf",    required_argument, NULL, 'l'  },
       { "subleaf", required_argument, NULL, 's'  },
+      { "parallel", optional_argument, NULL, 'P' },
+      { "raw-binary", no_argument,     NULL, 'B' },
+      { "format",  required_argument, NULL, 'F'  },
+      { "files-from", required_argument, NULL, 'A' },
+      { "dedup",   no_argument,       NULL, 'D'  },
+      { "leaves",  required_argument, NULL, 'E'  },
+      { "topology", no_argument,      NULL, 'T'  },
+      { "diff",    required_argument, NULL, 'X'  },
+      { "serve",   required_argument, NULL, 'S'  },
+      { "pool",    no_argument,       NULL, 'O'  },
+      { "cpuinfo", no_argument,       NULL, 'I'  },
+      { "has",     required_argument, NULL, 'G'  },
+      { "watch",   optional_argument, NULL, 'W'  },
+      { "timing",  no_argument,       NULL, 'J'  },
+      { "bench-leaf", optional_argument, NULL, 'L' },
       { NULL,      no_argument,       NULL, '\0' }
    };
 
@@ -9943,12 +13649,23 @@ main(int     argc,
    boolean        opt_kernel      = FALSE;
    boolean        opt_raw         = FALSE;
    boolean        opt_debug       = FALSE;
-   cstring        opt_filename    = NULL;
    boolean        opt_version     = FALSE;
    boolean        opt_leaf        = FALSE;
    unsigned long  opt_leaf_val    = 0;
    boolean        opt_subleaf     = FALSE;
    unsigned long  opt_subleaf_val = 0;
+   boolean        opt_parallel     = FALSE;
+   unsigned long  opt_parallel_val = 0;
+   boolean        opt_dedup        = FALSE;
+   boolean        opt_topology     = FALSE;
+   cstring        opt_diff         = NULL;
+   cstring        opt_serve        = NULL;
+   cstring        opt_has          = NULL;
+   boolean        opt_watch        = FALSE;
+   unsigned long  opt_watch_val    = 1;
+   boolean        opt_bench        = FALSE;
+   boolean        opt_bench_leaf   = FALSE;
+   unsigned long  opt_bench_val    = 0;
 
    program = strrchr(argv[0], '/');
    if (program == NULL) {
@@ -9957,6 +13674,8 @@ main(int     argc,
       program++;
    }
 
+   atexit(out_flush);
+
    opterr = 0;
 
    for (;;) {
@@ -9987,7 +13706,16 @@ main(int     argc,
          opt_debug = TRUE;
          break;
       case 'f':
-         opt_filename = optarg;
+         add_file_name(optarg);
+         break;
+      case 'A':
+         add_files_from(optarg);
+         break;
+      case 'D':
+         opt_dedup = TRUE;
+         break;
+      case 'E':
+         parse_leaf_specs(optarg);
          break;
       case 'v':
          opt_version = TRUE;
@@ -10020,6 +13748,85 @@ main(int     argc,
             }
          }
          break;
+      case 'B':
+         binary_dump.enabled = TRUE;
+         break;
+      case 'T':
+         opt_topology = TRUE;
+         break;
+      case 'X':
+         opt_diff = optarg;
+         break;
+      case 'S':
+         opt_serve = optarg;
+         break;
+      case 'O':
+         fd_pool.enabled = TRUE;
+         break;
+      case 'I':
+         cpuinfo_input = TRUE;
+         break;
+      case 'G':
+         opt_has = optarg;
+         break;
+      case 'W':
+         opt_watch = TRUE;
+         if (optarg != NULL) {
+            errno = 0;
+            char* endptr = NULL;
+            opt_watch_val = strtoul(optarg, &endptr, 0);
+            if (errno != 0 || *endptr != '\0' || opt_watch_val == 0) {
+               fprintf(stderr,
+                       "%s: argument to --watch not understood: %s\n",
+                       program, argv[optind-1]);
+               exit(1);
+            }
+         }
+         break;
+      case 'J':
+         timing.enabled = TRUE;
+         break;
+      case 'L':
+         opt_bench = TRUE;
+         if (optarg != NULL) {
+            errno = 0;
+            char* endptr = NULL;
+            opt_bench_val = strtoul(optarg, &endptr, 0);
+            if (errno != 0 || *endptr != '\0') {
+               fprintf(stderr,
+                       "%s: argument to --bench-leaf not understood: %s\n",
+                       program, argv[optind-1]);
+               exit(1);
+            }
+            opt_bench_leaf = TRUE;
+         }
+         break;
+      case 'F':
+         if (strcmp(optarg, "text") == 0) {
+            out_format = FORMAT_TEXT;
+         } else if (strcmp(optarg, "json") == 0) {
+            out_format = FORMAT_JSON;
+         } else {
+            fprintf(stderr,
+                    "%s: argument to --format not understood: %s\n",
+                    program, argv[optind-1]);
+            exit(1);
+         }
+         break;
+      case 'P':
+         opt_parallel = TRUE;
+         if (optarg != NULL) {
+            errno = 0;
+            char* endptr = NULL;
+            opt_parallel_val = strtoul(optarg, &endptr, 0);
+            if (errno != 0 || *endptr != '\0' || opt_parallel_val == 0) {
+               fprintf(stderr,
+                       "%s: argument to --parallel not understood: %s\n",
+                       program, argv[optind-1]);
+               exit(1);
+            }
+         }
+         break;
       case '?':
       default:
          if (optopt == '\0') {
@@ -10040,14 +13847,31 @@ main(int     argc,
       /*NOTREACHED*/
    }
 
+   // --cpuinfo with no input files reads the real /proc/cpuinfo.
+   if (cpuinfo_input && file_count == 0) {
+      add_file_name("/proc/cpuinfo");
+   }
+
 #ifndef USE_CPUID_MODULE
    if (opt_kernel) {
       fprintf(stderr, "%s: unrecognized argument: -k\n", program);
       usage();
       /*NOTREACHED*/
    }
+   if (fd_pool.enabled) {
+      fprintf(stderr, "%s: unrecognized argument: --pool\n", program);
+      usage();
+      /*NOTREACHED*/
+   }
 #endif
 
+   if (fd_pool.enabled && opt_inst) {
+      fprintf(stderr,
+              "%s: -i/--inst and --pool are incompatible options\n",
+              program);
+      exit(1);
+   }
+
    if (opt_inst && opt_kernel) {
       fprintf(stderr,
               "%s: -i/--inst and -k/--kernel are incompatible options\n", 
@@ -10055,7 +13879,7 @@ main(int     argc,
       exit(1);
    }
 
-   if (opt_filename != NULL && opt_leaf) {
+   if (file_count > 0 && opt_leaf) {
       fprintf(stderr,
               "%s: -f/--file and -l/--leaf are incompatible options\n",
               program);
@@ -10069,20 +13893,187 @@ main(int     argc,
       exit(1);
    }
 
+   if (out_format == FORMAT_JSON && binary_dump.enabled) {
+      fprintf(stderr,
+              "%s: --format=json and --raw-binary are incompatible options\n",
+              program);
+      exit(1);
+   }
+
+   if (opt_parallel && opt_one_cpu) {
+      fprintf(stderr,
+              "%s: --parallel and -1/--one-cpu are incompatible options\n",
+              program);
+      exit(1);
+   }
+
+   if (binary_dump.enabled && file_count > 1) {
+      fprintf(stderr,
+              "%s: --raw-binary accepts only one -f/--file input\n",
+              program);
+      exit(1);
+   }
+
+   if (opt_parallel && file_count > 0) {
+      fprintf(stderr,
+              "%s: --parallel and -f/--file are incompatible options\n",
+              program);
+      exit(1);
+   }
+
+   if (opt_parallel && opt_leaf) {
+      fprintf(stderr,
+              "%s: --parallel and -l/--leaf are incompatible options\n",
+              program);
+      exit(1);
+   }
+
+   if (leaf_spec_count > 0
+       && (opt_leaf || file_count > 0 || opt_parallel)) {
+      fprintf(stderr,
+              "%s: --leaves is incompatible with -l/--leaf, -f/--file, and"
+              " --parallel\n",
+              program);
+      exit(1);
+   }
+
+   if (opt_dedup
+       && (opt_one_cpu || opt_leaf || leaf_spec_count > 0 || file_count > 0
+           || opt_parallel || binary_dump.enabled)) {
+      fprintf(stderr,
+              "%s: --dedup is incompatible with -1/--one-cpu, -l/--leaf,"
+              " -f/--file,\n%s: --parallel, and --raw-binary\n",
+              program, program);
+      exit(1);
+   }
+
+   if (opt_serve != NULL
+       && (opt_one_cpu || opt_raw || opt_leaf || leaf_spec_count > 0
+           || file_count > 0 || opt_dedup || opt_parallel || opt_topology
+           || opt_diff != NULL || binary_dump.enabled
+           || out_format == FORMAT_JSON)) {
+      fprintf(stderr,
+              "%s: --serve is incompatible with every other mode option\n",
+              program);
+      exit(1);
+   }
+
+   if (opt_has != NULL
+       && (opt_one_cpu || opt_raw || opt_leaf || leaf_spec_count > 0
+           || file_count > 0 || opt_dedup || opt_parallel || opt_topology
+           || opt_diff != NULL || opt_serve != NULL || binary_dump.enabled
+           || out_format == FORMAT_JSON)) {
+      fprintf(stderr,
+              "%s: --has is incompatible with every other mode option\n",
+              program);
+      exit(2);
+   }
+
+   if (opt_watch
+       && (opt_raw || opt_leaf || file_count > 0 || opt_dedup
+           || opt_parallel || opt_topology || opt_diff != NULL
+           || opt_serve != NULL || opt_has != NULL || binary_dump.enabled
+           || out_format == FORMAT_JSON)) {
+      fprintf(stderr,
+              "%s: --watch is compatible only with -1/--one-cpu, -i/-k,"
+              " --pool,\n%s: and --leaves\n",
+              program, program);
+      exit(1);
+   }
+
+   if (opt_bench
+       && (opt_raw || opt_leaf || leaf_spec_count > 0 || file_count > 0
+           || opt_dedup || opt_parallel || opt_topology || opt_diff != NULL
+           || opt_serve != NULL || opt_has != NULL || opt_watch
+           || timing.enabled || binary_dump.enabled
+           || out_format == FORMAT_JSON)) {
+      fprintf(stderr,
+              "%s: --bench-leaf is compatible only with -1/--one-cpu, -i/-k,"
+              " and --pool\n",
+              program);
+      exit(1);
+   }
+
+   if (timing.enabled
+       && (opt_leaf || leaf_spec_count > 0 || file_count > 0 || opt_dedup
+           || opt_parallel || opt_topology || opt_diff != NULL
+           || opt_serve != NULL || opt_has != NULL || opt_watch)) {
+      fprintf(stderr,
+              "%s: --timing instruments only the default walk; it is"
+              " compatible only\n%s: with -1/--one-cpu, -i/-k, -r/--raw,"
+              " and --raw-binary\n",
+              program, program);
+      exit(1);
+   }
+
+   if (opt_diff != NULL
+       && (opt_raw || opt_leaf || leaf_spec_count > 0 || file_count > 0
+           || opt_dedup || opt_parallel || opt_topology
+           || binary_dump.enabled)) {
+      fprintf(stderr,
+              "%s: --diff is incompatible with -r/--raw, -l/--leaf, --leaves,"
+              " -f/--file,\n%s: --dedup, --parallel, --topology, and"
+              " --raw-binary\n",
+              program, program);
+      exit(1);
+   }
+
+   if (opt_topology
+       && (opt_one_cpu || opt_raw || opt_leaf || leaf_spec_count > 0
+           || file_count > 0 || opt_dedup || binary_dump.enabled)) {
+      fprintf(stderr,
+              "%s: --topology is incompatible with -1/--one-cpu, -r/--raw,"
+              " -l/--leaf,\n%s: --leaves, -f/--file, --dedup, and"
+              " --raw-binary\n",
+              program, program);
+      exit(1);
+   }
+
    // Default to -i.  So use inst unless -k is specified.
    boolean  inst = !opt_kernel;
 
    if (opt_version) {
       printf("cpuid version %s\n", XSTR(VERSION));
    } else {
-      if (opt_filename != NULL) {
-         do_file(opt_filename, opt_raw, opt_debug);
+      if (opt_has != NULL) {
+         do_real_has(opt_has, inst);
+         /*NOTREACHED*/
+      }
+      if (file_count > 0) {
+         unsigned int  f;
+         for (f = 0; f < file_count; f++) {
+            if (file_count > 1) {
+               printf("==> %s <==\n", file_names[f]);
+            }
+            do_file(file_names[f], opt_raw, opt_debug);
+            out_flush();
+         }
       } else if (opt_leaf) {
          do_real_one(opt_leaf_val, opt_subleaf_val,
                      opt_one_cpu, inst, opt_raw, opt_debug);
+      } else if (opt_bench) {
+         do_real_bench(opt_one_cpu, inst, opt_bench_leaf, opt_bench_val);
+      } else if (opt_watch) {
+         do_real_watch(opt_watch_val, opt_one_cpu, inst);
+      } else if (leaf_spec_count > 0) {
+         do_real_leaves(opt_one_cpu, inst, opt_raw);
+      } else if (opt_serve != NULL) {
+         do_real_serve(opt_serve, inst);
+      } else if (opt_diff != NULL) {
+         do_real_diff(opt_diff, opt_one_cpu, inst);
+      } else if (opt_topology) {
+         do_real_topology(opt_parallel_val, inst);
+      } else if (opt_dedup) {
+         do_real_dedup(inst, opt_raw, opt_debug);
+      } else if (opt_parallel) {
+         do_real_parallel(opt_parallel_val, inst, opt_raw, opt_debug);
       } else {
          do_real(opt_one_cpu, inst, opt_raw, opt_debug);
       }
+
+      if (binary_dump.enabled) {
+         binary_dump_write();
+      }
    }
 
    exit(0);
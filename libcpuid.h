@@ -0,0 +1,98 @@
+/*
+** libcpuid.h - public interface to cpuid's gather & decode machinery.
+**
+** This is a thin, stable C API over the same code that the cpuid tool
+** itself uses, for callers that want CPUID information in-process instead
+** of paying fork+exec per query.  Build the library with "make lib".
+**
+** Typical use:
+**
+**    cpuid_snapshot_t*  snapshot;
+**    cpuid_info_t*      info;
+**    if (cpuid_gather(0, &snapshot) == 0
+**        && cpuid_decode(snapshot, &info) == 0) {
+**       printf("%s\n", cpuid_info_synth(info));
+**       cpuid_info_free(info);
+**    }
+**    cpuid_snapshot_free(snapshot);
+**
+** The library is not thread-safe: the decode machinery shares static
+** buffers.  Serialize calls if used from multiple threads.
+*/
+
+/*
+** Copyright 2020 by Todd Allen.
+**
+** This program is free software; you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation; either version 2 of the License, or
+** (at your option) any later version.
+**
+** This program is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this program; if not, write to the Free Software
+** Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307,
+** USA.
+*/
+
+#ifndef LIBCPUID_H
+#define LIBCPUID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct cpuid_snapshot  cpuid_snapshot_t;  /* raw (leaf, subleaf) data */
+typedef struct cpuid_info      cpuid_info_t;      /* decoded summary */
+
+/*
+** Gather the full leaf & subleaf walk for the specified logical CPU into a
+** new snapshot.  Returns 0 on success, or -1 if the CPU does not exist or
+** cannot be probed.
+*/
+int   cpuid_gather(unsigned int        cpu,
+                   cpuid_snapshot_t**  snapshot);
+void  cpuid_snapshot_free(cpuid_snapshot_t*  snapshot);
+
+/*
+** Raw access to snapshot records, each a (leaf, subleaf) pair with its four
+** register words in eax, ebx, ecx, edx order.  cpuid_snapshot_record walks
+** by index; cpuid_snapshot_leaf looks up one (leaf, subleaf) pair.  Both
+** return 0 on success, or -1 if the record is not present.
+*/
+unsigned int  cpuid_snapshot_record_count(const cpuid_snapshot_t*  snapshot);
+int           cpuid_snapshot_record(const cpuid_snapshot_t*  snapshot,
+                                    unsigned int             index,
+                                    unsigned int*            leaf,
+                                    unsigned int*            subleaf,
+                                    unsigned int             words[4]);
+int           cpuid_snapshot_leaf(const cpuid_snapshot_t*  snapshot,
+                                  unsigned int             leaf,
+                                  unsigned int             subleaf,
+                                  unsigned int             words[4]);
+
+/*
+** Decode a snapshot into a summary.  Returns 0 on success, -1 on failure.
+** The strings returned by the accessors are owned by the cpuid_info_t and
+** remain valid until cpuid_info_free.
+*/
+int   cpuid_decode(const cpuid_snapshot_t*  snapshot,
+                   cpuid_info_t**           info);
+void  cpuid_info_free(cpuid_info_t*  info);
+
+const char*   cpuid_info_vendor(const cpuid_info_t*  info);   /* e.g. "GenuineIntel" */
+const char*   cpuid_info_brand(const cpuid_info_t*  info);    /* brand string, "" if none */
+const char*   cpuid_info_synth(const cpuid_info_t*  info);    /* same as the (synth) line */
+unsigned int  cpuid_info_family(const cpuid_info_t*  info);   /* synth family */
+unsigned int  cpuid_info_model(const cpuid_info_t*  info);    /* synth model */
+unsigned int  cpuid_info_stepping(const cpuid_info_t*  info);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif